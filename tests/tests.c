@@ -4,6 +4,7 @@
 #include "../utf8str.h"
 #include "munit/munit.h"
 
+#include <pthread.h>
 #include <stdio.h>
 
 MunitResult TestNew(const MunitParameter params[], void* data) {
@@ -61,6 +62,83 @@ MunitResult TestNewSetCap(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestNewFromBytes(const MunitParameter params[], void* data) {
+	Str* s;
+
+	/* not zero-terminated */
+	s = StrNewFromBytes("Größe!!!", 7);
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 5);
+	munit_assert_size(s->size, ==, 8);
+	munit_assert_true(!strcmp("Größe", s->arr));
+	StrDel(s);
+
+	/* empty */
+	s = StrNewFromBytes("", 0);
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 0);
+	munit_assert_size(s->size, ==, 1);
+	munit_assert_true(!strcmp("", s->arr));
+	StrDel(s);
+
+	/* longer than the initial capacity, mixing ASCII and non-ASCII blocks */
+	char buf[1024];
+	size_t i, n = 0;
+	for (i = 0; i < 100; ++i) {
+		memcpy(&buf[n], "abcdefgh", 8); n += 8;
+		if (i % 3 == 0) { memcpy(&buf[n], "💖", 4); n += 4; }
+	}
+	s = StrNewFromBytes(buf, n);
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 834);
+	munit_assert_size(s->size, ==, n + 1);
+	munit_assert_size(s->cap, >=, n + 1);
+	munit_assert_true(!memcmp(buf, s->arr, n));
+	StrDel(s);
+
+	/* invalid: truncated, stray continuation, overlong, too large, zero byte */
+	munit_assert_null(StrNewFromBytes("\xe6\x9d\xb1\xe4", 4));
+	munit_assert_null(StrNewFromBytes("ab\x80", 3));
+	munit_assert_null(StrNewFromBytes("\xc0\x80", 2));
+	munit_assert_null(StrNewFromBytes("\xe0\x80\xaf", 3));
+	munit_assert_null(StrNewFromBytes("\xf4\x90\x80\x80", 4));
+	munit_assert_null(StrNewFromBytes("\xf8\x88\x80\x80\x80", 5));
+	munit_assert_null(StrNewFromBytes("a\0b", 3));
+
+	return MUNIT_OK;
+}
+
+MunitResult TestNewStrict(const MunitParameter params[], void* data) {
+	Str* s;
+
+	s = StrNewStrict("Дякую");
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 5);
+	munit_assert_size(s->size, ==, 11);
+	munit_assert_true(!strcmp("Дякую", s->arr));
+	StrDel(s);
+
+	s = StrNewStrict(0);
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 0);
+	StrDel(s);
+
+	/* surrogates are only rejected in strict mode */
+	s = StrNew("lone \xed\xa0\x80 surrogate");
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 16);
+	StrDel(s);
+	munit_assert_null(StrNewStrict("lone \xed\xa0\x80 surrogate"));
+	munit_assert_null(StrNewFromBytesStrict("\xed\xbf\xbf", 3));
+
+	s = StrNewFromBytesStrict("\xed\x9f\xbf\xee\x80\x80", 6);
+	munit_assert_not_null(s);
+	munit_assert_size(s->length, ==, 2);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestIsNull(const MunitParameter params[], void* data) {
 	Str* s;
 
@@ -133,6 +211,109 @@ MunitResult TestEqual(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestCompare(const MunitParameter params[], void* data) {
+	Str* s; Str* t;
+	size_t i;
+
+	/* equal */
+	s = StrNew("Hello!");
+	t = StrNew("Hello!");
+	munit_assert_int(StrCompare(s, t, &i), ==, 0);
+	munit_assert_size(i, ==, 6);
+	StrDel(s); StrDel(t);
+
+	/* difference inside a character */
+	s = StrNew("Ελλάδα");
+	t = StrNew("Ελλαδα");
+	munit_assert_int(StrCompare(s, t, &i), <, 0); /* U+03AC < U+03B1 */
+	munit_assert_size(i, ==, 3);
+	munit_assert_int(StrCompare(t, s, 0), >, 0);
+	StrDel(s); StrDel(t);
+
+	/* code point order, not UTF-16 order */
+	s = StrNew("a\xef\xbf\xbd");
+	t = StrNew("a🗼");
+	munit_assert_int(StrCompare(s, t, &i), <, 0);
+	munit_assert_size(i, ==, 1);
+	StrDel(s); StrDel(t);
+
+	/* præfix */
+	s = StrNew("東京都");
+	t = StrNew("東京");
+	munit_assert_int(StrCompare(s, t, &i), >, 0);
+	munit_assert_size(i, ==, 2);
+	munit_assert_int(StrCompare(t, s, &i), <, 0);
+	munit_assert_size(i, ==, 2);
+	StrDel(s); StrDel(t);
+
+	/* long strings, differing at every position past the SIMD blocks */
+	s = StrNew(0);
+	for (i = 0; i < 100; ++i) StrAddChar(s, i % 2 ? L'ō' : 'o');
+	for (i = 0; i < 100; ++i) {
+		size_t d;
+		Str* const rest = StrDrop(s, i + 1);
+		t = StrTake(s, i);
+		StrAddChar(t, L'ő');
+		StrAdd(t, rest);
+		StrDel(rest);
+		munit_assert_int(StrCompare(s, t, &d), <, 0);
+		munit_assert_size(d, ==, i);
+		munit_assert_int(StrViewCompare(StrViewOf(t), StrViewOf(s), &d), >, 0);
+		munit_assert_size(d, ==, i);
+		StrDel(t);
+	}
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestValidate(const MunitParameter params[], void* data) {
+	size_t off = 12345;
+
+	munit_assert_int(StrValidate("", 0, &off), ==, 1);
+	munit_assert_int(StrValidate("Ölçü ☃ 💖", 16, &off), ==, 1);
+	munit_assert_size(off, ==, 12345);
+	/* zero bytes are valid UTF-8 */
+	munit_assert_int(StrValidate("a\0b", 3, 0), ==, 1);
+
+	/* stray continuation byte */
+	munit_assert_int(StrValidate("ab\x80", 3, &off), ==, 0);
+	munit_assert_size(off, ==, 2);
+	/* overlong */
+	munit_assert_int(StrValidate("x\xc1\xbf", 3, &off), ==, 0);
+	munit_assert_size(off, ==, 1);
+	munit_assert_int(StrValidate("\xf0\x8f\xbf\xbf", 4, &off), ==, 0);
+	munit_assert_size(off, ==, 0);
+	/* surrogate */
+	munit_assert_int(StrValidate("ab\xed\xb0\x80", 5, &off), ==, 0);
+	munit_assert_size(off, ==, 2);
+	/* above U+10FFFF */
+	munit_assert_int(StrValidate("\xf4\x90\x80\x80", 4, &off), ==, 0);
+	munit_assert_size(off, ==, 0);
+	/* truncated */
+	munit_assert_int(StrValidate("东京\xe4\xba", 8, &off), ==, 0);
+	munit_assert_size(off, ==, 6);
+
+	/* errors far into long input, across block boundaries */
+	char buf[300];
+	size_t i;
+	for (i = 0; i < 100; ++i) memcpy(&buf[3*i], "東", 3);
+	munit_assert_int(StrValidate(buf, 300, &off), ==, 1);
+	buf[201] = (char)0x80;
+	munit_assert_int(StrValidate(buf, 300, &off), ==, 0);
+	munit_assert_size(off, ==, 201);
+	memcpy(&buf[198], "\xed\xa0\x80", 3);
+	munit_assert_int(StrValidate(buf, 300, &off), ==, 0);
+	munit_assert_size(off, ==, 198);
+	munit_assert_int(StrValidate(buf, 299, &off), ==, 0);
+	munit_assert_size(off, ==, 198);
+	memcpy(&buf[198], "東東", 6);
+	munit_assert_int(StrValidate(buf, 299, &off), ==, 0);
+	munit_assert_size(off, ==, 297);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestLength(const MunitParameter params[], void* data) {
 	Str* s;
 
@@ -269,6 +450,101 @@ MunitResult TestFindChar(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestCountChar(const MunitParameter params[], void* data) {
+	Str* s;
+	size_t i;
+
+	s = StrNew("A: x = y ∧ x ≠ 0 → y ≠ 0");
+	munit_assert_size(StrCountChar(s, L'≠'), ==, 2);
+	munit_assert_size(StrCountChar(s, ' '), ==, 11);
+	munit_assert_size(StrCountChar(s, L'→'), ==, 1);
+	munit_assert_size(StrCountChar(s, L'च'), ==, 0);
+	munit_assert_size(StrCountChar(s, 0), ==, 0);
+	munit_assert_size(StrCountChar(s, 0x110000), ==, 0);
+	StrDel(s);
+
+	/* long string, spanning many blocks */
+	s = StrNew(0);
+	for (i = 0; i < 10000; ++i) {
+		StrAddChars(s, i % 3 ? "行\n" : "🗼\n");
+	}
+	munit_assert_size(StrCountChar(s, '\n'), ==, 10000);
+	munit_assert_size(StrCountChar(s, L'行'), ==, 6666);
+	munit_assert_size(StrCountChar(s, 0x1f5fc), ==, 3334);
+	munit_assert_size(StrFindChar(s, 0x1f5fb), ==, -1);
+	StrAddChar(s, 0x1f5fb);
+	munit_assert_size(StrFindChar(s, 0x1f5fb), ==, 20000);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestFind(const MunitParameter params[], void* data) {
+	Str* s = StrNew("A: x = y ∧ x ≠ 0 → y ≠ 0");
+	Str* t = StrNew("≠ 0");
+	Str* u = StrNew(0);
+	size_t byte, i;
+
+	munit_assert_size(StrFind(s, t, 0, &byte), ==, 13);
+	munit_assert_size(byte, ==, 15);
+	munit_assert_size(StrFind(s, t, 13, 0), ==, 13);
+	munit_assert_size(StrFind(s, t, 14, &byte), ==, 21);
+	munit_assert_size(byte, ==, 27);
+	munit_assert_size(StrFind(s, t, 22, 0), ==, -1);
+	munit_assert_size(StrFind(s, t, 100, 0), ==, -1);
+	munit_assert_size(StrFindLast(s, t, -1, &byte), ==, 21);
+	munit_assert_size(byte, ==, 27);
+	munit_assert_size(StrFindLast(s, t, 23, 0), ==, 13);
+	munit_assert_size(StrFindLast(s, t, 15, 0), ==, -1);
+	munit_assert_size(StrFindLast(s, t, 16, 0), ==, 13);
+
+	/* empty needle */
+	munit_assert_size(StrFind(s, u, 5, &byte), ==, 5);
+	munit_assert_size(byte, ==, 5);
+	munit_assert_size(StrFind(u, u, 0, 0), ==, 0);
+	munit_assert_size(StrFindLast(s, u, 10, 0), ==, 10);
+	munit_assert_size(StrFind(u, t, 0, 0), ==, -1);
+	StrDel(t);
+	StrDel(s);
+
+	/* emoji, in a long haystack with many false candidates */
+	s = StrNew(0);
+	for (i = 0; i < 1000; ++i) StrAddChars(s, "🗼🗻");
+	StrAddChars(s, "🗼🗼🗻");
+	t = StrNew("🗼🗼🗻");
+	munit_assert_size(StrFind(s, t, 0, &byte), ==, 2000);
+	munit_assert_size(byte, ==, 8000);
+	munit_assert_size(StrFindLast(s, t, -1, 0), ==, 2000);
+	StrDel(t);
+
+	/* periodic needles */
+	t = StrNew("🗼🗻🗼🗻🗼");
+	munit_assert_size(StrFind(s, t, 1, 0), ==, 2);
+	munit_assert_size(StrFindLast(s, t, -1, 0), ==, 1996);
+	munit_assert_size(StrFindLast(s, t, 1000, 0), ==, 994);
+	StrDel(t);
+	StrDel(s);
+
+	/* worst case for the candidate filter */
+	s = StrNew(0);
+	t = StrNew(0);
+	for (i = 0; i < 100000; ++i) StrAddChar(s, L'é');
+	for (i = 0; i < 1000; ++i) StrAddChar(t, L'é');
+	StrAddChar(t, L'è');
+	StrAddChar(t, L'é');
+	munit_assert_size(StrFind(s, t, 0, 0), ==, -1);
+	munit_assert_size(StrFindLast(s, t, -1, 0), ==, -1);
+	StrAddChar(s, L'è');
+	StrAddChar(s, L'é');
+	munit_assert_size(StrFind(s, t, 0, 0), ==, 99000);
+	munit_assert_size(StrFindLast(s, t, -1, 0), ==, 99000);
+	StrDel(t);
+	StrDel(s);
+	StrDel(u);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestAt(const MunitParameter params[], void* data) {
 	Str* s;
 
@@ -293,6 +569,101 @@ MunitResult TestAt(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+unsigned int LongChar(size_t i) {
+	if (i % 3 == 0) return 0x4e00 + i;
+	if (i % 3 == 1) return 'a' + i % 26;
+	return 0x1f600 + i % 64;
+}
+
+MunitResult TestAtLong(const MunitParameter params[], void* data) {
+	Str* s = StrNew(0);
+	size_t i;
+
+	/* long enough to need the index */
+	for (i = 0; i < 1000; ++i) StrAddChar(s, LongChar(i));
+	for (i = 0; i < 1000; ++i) munit_assert_uint(StrAt(s, i), ==, LongChar(i));
+	munit_assert_uint(StrAt(s, 1000), ==, 0);
+
+	/* trimming and adding again moves characters */
+	StrTrim(s, 500);
+	munit_assert_uint(StrAt(s, 499), ==, LongChar(499));
+	munit_assert_uint(StrAt(s, 500), ==, 0);
+	for (i = 0; i < 500; ++i) StrAddChar(s, 'z');
+	munit_assert_uint(StrAt(s, 499), ==, LongChar(499));
+	munit_assert_uint(StrAt(s, 500), ==, 'z');
+	munit_assert_uint(StrAt(s, 999), ==, 'z');
+	StrAddChars(s, "ÿ");
+	munit_assert_uint(StrAt(s, 1000), ==, L'ÿ');
+	for (i = 0; i < 500; ++i) munit_assert_uint(StrAt(s, i), ==, LongChar(i));
+
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestCharToByte(const MunitParameter params[], void* data) {
+	Str* s = StrNew("aé東💖");
+	munit_assert_size(StrCharToByte(s, 0), ==, 0);
+	munit_assert_size(StrCharToByte(s, 1), ==, 1);
+	munit_assert_size(StrCharToByte(s, 2), ==, 3);
+	munit_assert_size(StrCharToByte(s, 3), ==, 6);
+	munit_assert_size(StrCharToByte(s, 4), ==, 10);
+	munit_assert_size(StrCharToByte(s, 5), ==, -1);
+
+	const size_t offsets[] = { 0, 1, 3, 6 };
+	size_t i;
+	for (i = 0; i < 300; ++i) StrAddChars(s, "aé東💖");
+	for (i = 0; i <= 1204; ++i)
+		munit_assert_size(StrCharToByte(s, i), ==, (i/4) * 10 + offsets[i%4]);
+	munit_assert_size(StrCharToByte(s, 1205), ==, -1);
+	StrDel(s);
+
+	s = StrNew("ASCII only");
+	munit_assert_size(StrCharToByte(s, 6), ==, 6);
+	munit_assert_size(StrCharToByte(s, 10), ==, 10);
+	munit_assert_size(StrCharToByte(s, 11), ==, -1);
+	StrDel(s);
+
+	s = StrNew(0);
+	munit_assert_size(StrCharToByte(s, 0), ==, 0);
+	munit_assert_size(StrCharToByte(s, 1), ==, -1);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestByteToChar(const MunitParameter params[], void* data) {
+	Str* s = StrNew("aé東💖");
+	munit_assert_size(StrByteToChar(s, 0), ==, 0);
+	munit_assert_size(StrByteToChar(s, 1), ==, 1);
+	munit_assert_size(StrByteToChar(s, 2), ==, 1);
+	munit_assert_size(StrByteToChar(s, 5), ==, 2);
+	munit_assert_size(StrByteToChar(s, 9), ==, 3);
+	munit_assert_size(StrByteToChar(s, 10), ==, 4);
+	munit_assert_size(StrByteToChar(s, 11), ==, -1);
+
+	const size_t indices[] = { 0, 1, 1, 2, 2, 2, 3, 3, 3, 3 };
+	size_t i;
+	for (i = 0; i < 300; ++i) StrAddChars(s, "aé東💖");
+	/* in both directions, so that lookups land before and after the end of
+	 * the index */
+	for (i = 0; i < 3010; ++i) {
+		const size_t j = 3009 - i;
+		munit_assert_size(StrByteToChar(s, j), ==, (j/10) * 4 + indices[j%10]);
+		munit_assert_size(StrByteToChar(s, i), ==, (i/10) * 4 + indices[i%10]);
+	}
+	munit_assert_size(StrByteToChar(s, 3010), ==, 1204);
+	munit_assert_size(StrByteToChar(s, 3011), ==, -1);
+	StrDel(s);
+
+	s = StrNew(0);
+	munit_assert_size(StrByteToChar(s, 0), ==, 0);
+	munit_assert_size(StrByteToChar(s, 1), ==, -1);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestFirst(const MunitParameter params[], void* data) {
 	Str* s;
 
@@ -364,6 +735,13 @@ MunitResult TestCopy(const MunitParameter params[], void* data) {
 	/* it is an actual copy - still exists after s is deleted */
 	munit_assert_true(!strcmp("Ingen ko på isen!", t->arr));
 
+	/* the copy is sized for the characters, not the capacity of s */
+	munit_assert_true(StrReserve(t, 4096));
+	s = StrCopy(t);
+	munit_assert_size(s->cap, <, 4096);
+	munit_assert_true(!strcmp("Ingen ko på isen!", s->arr));
+	StrDel(s);
+
 	StrDel(t);
 
 	return MUNIT_OK;
@@ -744,6 +1122,174 @@ MunitResult TestAdd(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestAddBytes(const MunitParameter params[], void* data) {
+	int ret;
+	Str* s = StrNewSetCap(4);
+
+	ret = StrAddBytes(s, "Ψ = ", 5);
+	munit_assert_int(ret, ==, 1);
+	munit_assert_size(s->length, ==, 4);
+	munit_assert_size(s->size, ==, 6);
+	munit_assert_size(s->cap, ==, 8);
+	munit_assert_true(!strcmp("Ψ = ", s->arr));
+
+	/* only the given bytes are added */
+	ret = StrAddBytes(s, "αβγδ", 4);
+	munit_assert_int(ret, ==, 1);
+	munit_assert_size(s->length, ==, 6);
+	munit_assert_size(s->size, ==, 10);
+	munit_assert_size(s->cap, ==, 16);
+	munit_assert_true(!strcmp("Ψ = αβ", s->arr));
+
+	/* nothing is added on failure */
+	ret = StrAddBytes(s, "γ\xce", 3);
+	munit_assert_int(ret, ==, 0);
+	munit_assert_size(s->length, ==, 6);
+	munit_assert_size(s->size, ==, 10);
+	munit_assert_true(!strcmp("Ψ = αβ", s->arr));
+
+	ret = StrAddBytes(s, "", 0);
+	munit_assert_int(ret, ==, 1);
+	munit_assert_size(s->length, ==, 6);
+	munit_assert_size(s->size, ==, 10);
+
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestCodepoints(const MunitParameter params[], void* data) {
+	const uint32_t cps[] = { 'T', 0x14d, 'k', 'y', 0x14d, ' ', 0x6771, 0x4eac,
+		0x90fd, ' ', 0x1f5fc, '!' };
+	uint32_t out[100];
+	Str* s = StrNew("→ ");
+	Str* t;
+	size_t i;
+
+	munit_assert_true(StrAddCodepoints(s, cps, 12));
+	munit_assert_true(!strcmp("→ Tōkyō 東京都 🗼!", s->arr));
+	munit_assert_size(s->length, ==, 14);
+	munit_assert_true(StrAddCodepoints(s, cps, 0));
+	munit_assert_size(s->length, ==, 14);
+
+	/* invalid code points are rejected, leaving s unchanged */
+	out[0] = 'a';
+	out[1] = 0x110000;
+	munit_assert_false(StrAddCodepoints(s, out, 2));
+	out[1] = 0;
+	munit_assert_false(StrAddCodepoints(s, out, 2));
+	munit_assert_true(!strcmp("→ Tōkyō 東京都 🗼!", s->arr));
+
+	/* decoding, possibly into too small an array */
+	munit_assert_size(StrDecodeUTF32(s, out, 100), ==, 14);
+	munit_assert_uint(out[0], ==, 0x2192);
+	munit_assert_true(!memcmp(out + 2, cps, sizeof(cps)));
+	out[3] = 0;
+	munit_assert_size(StrDecodeUTF32(s, out, 3), ==, 14);
+	munit_assert_uint(out[2], ==, 'T');
+	munit_assert_uint(out[3], ==, 0);
+	StrDel(s);
+
+	/* long strings, through the block paths */
+	for (i = 0; i < 100; ++i) out[i] = i % 10 ? 'a' + i % 26 : 0x3b1 + i % 25;
+	s = StrNew(0);
+	t = StrNew(0);
+	munit_assert_true(StrAddCodepoints(s, out, 100));
+	for (i = 0; i < 100; ++i) StrAddChar(t, out[i]);
+	munit_assert_true(StrEqual(s, t));
+	memset(out, 0, sizeof(out));
+	munit_assert_size(StrDecodeUTF32(s, out, 100), ==, 100);
+	for (i = 0; i < 100; ++i) munit_assert_uint(out[i], ==, StrAt(t, i));
+	StrDel(t);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestUTF16(const MunitParameter params[], void* data) {
+	/* "Tōkyō 🗼!" */
+	const uint16_t units[] = { 'T', 0x14d, 'k', 'y', 0x14d, ' ', 0xd83d, 0xddfc,
+		'!' };
+	uint16_t out[64], bad[3];
+	size_t err = 0, i;
+	Str* s = StrNewFromUTF16(units, 9, &err);
+	munit_assert_not_null(s);
+	munit_assert_true(!strcmp("Tōkyō 🗼!", s->arr));
+	munit_assert_size(s->length, ==, 8);
+
+	munit_assert_size(StrToUTF16(s, out, 64, 0), ==, 9);
+	munit_assert_true(!memcmp(units, out, sizeof(units)));
+	/* a surrogate pair is not split */
+	out[6] = 0;
+	munit_assert_size(StrToUTF16(s, out, 7, 0), ==, 9);
+	munit_assert_uint(out[6], ==, 0);
+	StrDel(s);
+
+	/* invalid UTF-16 */
+	bad[0] = 'a'; bad[1] = 0xdc00; bad[2] = 'b';
+	munit_assert_null(StrNewFromUTF16(bad, 3, &err));
+	munit_assert_size(err, ==, 1);
+	bad[1] = 0xd800;
+	munit_assert_null(StrNewFromUTF16(bad, 3, &err));
+	munit_assert_size(err, ==, 1);
+	munit_assert_null(StrNewFromUTF16(bad, 2, &err));
+	munit_assert_size(err, ==, 1);
+	bad[1] = 0;
+	munit_assert_null(StrNewFromUTF16(bad, 3, &err));
+	munit_assert_size(err, ==, 1);
+
+	/* surrogate code points cannot be converted */
+	s = StrNew("ab\xed\xa0\x80");
+	munit_assert_size(StrToUTF16(s, out, 64, &err), ==, -1);
+	munit_assert_size(err, ==, 2);
+	StrDel(s);
+
+	/* long, through the block paths */
+	for (i = 0; i < 64; ++i) out[i] = i % 9 ? 'a' + i % 26 : 0x3b1 + i % 25;
+	s = StrNewFromUTF16(out, 64, 0);
+	munit_assert_size(s->length, ==, 64);
+	for (i = 0; i < 64; ++i) munit_assert_uint(StrAt(s, i), ==, out[i]);
+	memset(out, 0, sizeof(out));
+	munit_assert_size(StrToUTF16(s, out, 64, 0), ==, 64);
+	for (i = 0; i < 64; ++i) munit_assert_uint(StrAt(s, i), ==, out[i]);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestLatin1(const MunitParameter params[], void* data) {
+	char out[64];
+	size_t err = 0, i;
+	Str* s = StrNewFromLatin1("Ma\xefs \xe0 l'\xe9t\xe9", 12, &err);
+	munit_assert_not_null(s);
+	munit_assert_true(!strcmp("Maïs à l'été", s->arr));
+	munit_assert_size(s->length, ==, 12);
+	munit_assert_size(StrToLatin1(s, out, 64, 0), ==, 12);
+	munit_assert_true(!memcmp("Ma\xefs \xe0 l'\xe9t\xe9", out, 12));
+	StrDel(s);
+
+	munit_assert_null(StrNewFromLatin1("ab\0c", 4, &err));
+	munit_assert_size(err, ==, 2);
+
+	/* characters above U+00FF cannot be converted */
+	s = StrNew("café → bar");
+	munit_assert_size(StrToLatin1(s, out, 64, &err), ==, -1);
+	munit_assert_size(err, ==, 5);
+	StrDel(s);
+
+	/* long, through the block paths */
+	s = StrNew(0);
+	for (i = 0; i < 50; ++i) StrAddChar(s, i % 7 ? 'a' + i % 26 : 0xc0 + i % 64);
+	munit_assert_size(StrToLatin1(s, out, 64, 0), ==, 50);
+	for (i = 0; i < 50; ++i) munit_assert_uint((unsigned char)out[i], ==, StrAt(s, i));
+	Str* t = StrNewFromLatin1(out, 50, 0);
+	munit_assert_true(StrEqual(s, t));
+	StrDel(t);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestTrim(const MunitParameter params[], void* data) {
 	int ret;
 	Str* s = StrNew("printf(\"ə\");\n");
@@ -792,6 +1338,671 @@ MunitResult TestTrim(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestInsert(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tōkyō-to");
+	Str* t = StrNew(" 東京都");
+	Str* u = StrNew(0);
+	size_t i;
+
+	munit_assert_true(StrInsert(s, 5, t));
+	munit_assert_true(!strcmp("Tōkyō 東京都-to", s->arr));
+	munit_assert_size(s->length, ==, 12);
+	munit_assert_false(StrInsert(s, 13, t));
+	munit_assert_true(StrInsert(s, 12, t));
+	munit_assert_true(StrErase(s, 12, 100));
+	munit_assert_true(StrErase(s, 9, 12));
+	munit_assert_true(!strcmp("Tōkyō 東京都", s->arr));
+	munit_assert_false(StrErase(s, 5, 4));
+	munit_assert_true(StrErase(s, 3, 3));
+
+	munit_assert_true(StrReplaceRange(s, 0, 5, u));
+	munit_assert_true(!strcmp(" 東京都", s->arr));
+	munit_assert_true(StrReplaceRange(s, 0, 1, s));
+	munit_assert_true(!strcmp(" 東京都東京都", s->arr));
+	munit_assert_size(s->length, ==, 7);
+	munit_assert_true(StrReplaceRange(s, 1, 4, t));
+	munit_assert_true(!strcmp("  東京都東京都", s->arr));
+	munit_assert_size(s->length, ==, 8);
+	munit_assert_uint(StrAt(s, 7), ==, L'都');
+	StrDel(s);
+
+	/* edits in a long string keep lookups right */
+	s = StrNew(0);
+	for (i = 0; i < 1000; ++i) StrAddChar(s, i % 2 ? L'ō' : 'o');
+	munit_assert_uint(StrAt(s, 999), ==, L'ō');
+	munit_assert_true(StrErase(s, 10, 510));
+	munit_assert_size(s->length, ==, 500);
+	munit_assert_uint(StrAt(s, 499), ==, L'ō');
+	munit_assert_true(StrInsert(s, 100, t));
+	munit_assert_uint(StrAt(s, 101), ==, L'東');
+	munit_assert_uint(StrAt(s, 104), ==, 'o');
+	munit_assert_uint(StrAt(s, 503), ==, L'ō');
+	munit_assert_size(StrCharToByte(s, 503), ==, s->size - 3);
+	StrDel(s);
+
+	StrDel(u);
+	StrDel(t);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestReplaceAll(const MunitParameter params[], void* data) {
+	Str* s = StrNew("{n} is {n}, not {ñ}{n}");
+	Str* from = StrNew("{n}");
+	Str* to = StrNew("東京");
+	Str* empty = StrNew(0);
+	Str* t = StrReplaceAll(s, from, to);
+	Str* u;
+	size_t i;
+
+	munit_assert_not_null(t);
+	munit_assert_true(!strcmp("東京 is 東京, not {ñ}東京", t->arr));
+	munit_assert_size(t->length, ==, 19);
+	u = StrReplaceAll(t, to, from);
+	munit_assert_true(StrEqual(s, u));
+	munit_assert_size(u->length, ==, s->length);
+	StrDel(u);
+	u = StrReplaceAll(s, empty, to);
+	munit_assert_true(StrEqual(s, u));
+	StrDel(u);
+	u = StrReplaceAll(s, from, empty);
+	munit_assert_true(!strcmp(" is , not {ñ}", u->arr));
+	StrDel(u);
+
+	munit_assert_true(StrReplaceAllInPlace(s, from, to));
+	munit_assert_true(StrEqual(s, t));
+	munit_assert_size(s->length, ==, 19);
+	munit_assert_true(StrReplaceAllInPlace(s, to, from));
+	munit_assert_true(!strcmp("{n} is {n}, not {ñ}{n}", s->arr));
+	munit_assert_true(StrReplaceAllInPlace(s, from, empty));
+	munit_assert_true(!strcmp(" is , not {ñ}", s->arr));
+	munit_assert_size(s->length, ==, 13);
+	munit_assert_true(StrReplaceAllInPlace(s, to, from));
+	munit_assert_true(!strcmp(" is , not {ñ}", s->arr));
+	StrDel(t);
+
+	/* replacing with s itself */
+	StrDel(s);
+	s = StrNew("aXbXc");
+	StrDel(from);
+	from = StrNew("X");
+	munit_assert_true(StrReplaceAllInPlace(s, from, s));
+	munit_assert_true(!strcmp("aaXbXcbaXbXcc", s->arr));
+
+	/* many occurrences, and lookups afterwards */
+	StrDel(s);
+	s = StrNew(0);
+	for (i = 0; i < 500; ++i) StrAddChars(s, i % 3 ? "ō" : "X");
+	munit_assert_uint(StrAt(s, 499), ==, L'ō');
+	munit_assert_true(StrReplaceAllInPlace(s, from, to));
+	munit_assert_size(s->length, ==, 667);
+	munit_assert_uint(StrAt(s, 664), ==, L'東');
+	munit_assert_uint(StrAt(s, 666), ==, L'ō');
+	t = StrReplaceAll(s, to, from);
+	munit_assert_size(t->length, ==, 500);
+	munit_assert_true(StrReplaceAllInPlace(s, to, from));
+	munit_assert_true(StrEqual(s, t));
+	munit_assert_uint(StrAt(s, 498), ==, 'X');
+	StrDel(t);
+
+	StrDel(s);
+	StrDel(from);
+	StrDel(to);
+	StrDel(empty);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestReserve(const MunitParameter params[], void* data) {
+	Str* s = StrNewSetCap(4);
+	StrArena* a;
+	const char* arr;
+	size_t i;
+
+	munit_assert_int(s->growth, ==, STR_GROW_DOUBLE);
+	munit_assert_false(StrSetGrowth(s, 3));
+	munit_assert_true(StrSetGrowth(s, STR_GROW_HALF));
+	munit_assert_true(StrAddChars(s, "abcd"));
+	munit_assert_size(s->cap, ==, 6);
+	munit_assert_true(StrAddChars(s, "ef"));
+	munit_assert_size(s->cap, ==, 9);
+	munit_assert_true(StrSetGrowth(s, STR_GROW_EXACT));
+	munit_assert_true(StrAddChars(s, "ghijk"));
+	munit_assert_size(s->cap, ==, 12);
+
+	/* reserved room is used without moving the array */
+	munit_assert_true(StrReserve(s, 300));
+	munit_assert_size(s->cap, ==, 312);
+	munit_assert_true(StrReserve(s, 10));
+	munit_assert_size(s->cap, ==, 312);
+	munit_assert_false(StrReserve(s, SIZE_MAX));
+	arr = s->arr;
+	for (i = 0; i < 100; ++i) munit_assert_true(StrAddChar(s, L'ō'));
+	munit_assert_ptr_equal(s->arr, arr);
+	munit_assert_size(s->size, ==, 212);
+
+	munit_assert_true(StrShrinkToFit(s));
+	munit_assert_size(s->cap, ==, 212);
+	munit_assert_uint(StrAt(s, 110), ==, L'ō');
+	munit_assert_true(StrShrinkToFit(s));
+	munit_assert_true(!strncmp("abcdefghijkō", s->arr, 13));
+	munit_assert_uint(StrAt(s, 100), ==, L'ō');
+	StrDel(s);
+
+	/* huge arrays grow by whole pages */
+	s = StrNew(0);
+	munit_assert_true(StrSetGrowth(s, STR_GROW_EXACT));
+	munit_assert_true(StrReserve(s, 200000));
+	munit_assert_size(s->cap % 4096, ==, 0);
+	munit_assert_size(s->cap, >=, 200001);
+	munit_assert_true(StrShrinkToFit(s));
+	munit_assert_size(s->cap, ==, 1);
+	munit_assert_true(StrAddChars(s, "ō"));
+	munit_assert_size(s->cap, ==, 3);
+	StrDel(s);
+
+	/* the initial array stays */
+	s = StrNew("Tōkyō");
+	munit_assert_true(StrShrinkToFit(s));
+	munit_assert_size(s->cap, ==, 24);
+	StrDel(s);
+
+	/* arenas shrink blocks in place */
+	a = StrArenaNew(0);
+	s = StrNewInArena(a, "Tōkyō");
+	munit_assert_not_null(StrNewInArena(a, "東京"));
+	munit_assert_true(StrReserve(s, 1000));
+	arr = s->arr;
+	munit_assert_true(StrShrinkToFit(s));
+	munit_assert_ptr_equal(s->arr, arr);
+	munit_assert_size(s->cap, ==, 8);
+	munit_assert_true(StrAddChars(s, "-to"));
+	munit_assert_ptr_equal(s->arr, arr);
+	munit_assert_true(!strcmp("Tōkyō-to", s->arr));
+	StrArenaDel(a);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestShare(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tōkyō, 東京");
+	Str* t;
+	Str* u;
+	Str* v;
+	StrArena* a;
+
+	munit_assert_null(s->shared);
+	munit_assert_true(StrShare(s));
+	munit_assert_true(StrShare(s));
+	munit_assert_not_null(s->shared);
+	munit_assert_true(!strcmp("Tōkyō, 東京", s->arr));
+
+	/* copies, whole takes and drops share the array */
+	t = StrCopy(s);
+	munit_assert_ptr_equal(t->arr, s->arr);
+	munit_assert_size(t->length, ==, 9);
+	u = StrDrop(s, 7);
+	munit_assert_ptr_equal(u->arr, s->arr + 9);
+	munit_assert_true(!strcmp("東京", u->arr));
+	munit_assert_size(u->length, ==, 2);
+	munit_assert_size(u->size, ==, 7);
+	v = StrTake(s, 9);
+	munit_assert_ptr_equal(v->arr, s->arr);
+	StrDel(v);
+	v = StrTake(s, 5);
+	munit_assert_null(v->shared);
+	munit_assert_true(!strcmp("Tōkyō", v->arr));
+	StrDel(v);
+
+	/* changes copy the array first */
+	munit_assert_true(StrAddChar(t, L'都'));
+	munit_assert_null(t->shared);
+	munit_assert_true(!strcmp("Tōkyō, 東京都", t->arr));
+	munit_assert_true(!strcmp("Tōkyō, 東京", s->arr));
+	munit_assert_true(StrTrim(s, 4));
+	munit_assert_true(!strcmp("Tōkyō", s->arr));
+	munit_assert_true(!strcmp("東京", u->arr));
+	munit_assert_true(StrShare(s));
+	v = StrCopy(s);
+	munit_assert_true(StrErase(s, 1, 2));
+	munit_assert_true(!strcmp("Tkyō", s->arr));
+	munit_assert_true(!strcmp("Tōkyō", v->arr));
+	munit_assert_true(StrInsert(v, 0, v));
+	munit_assert_true(!strcmp("TōkyōTōkyō", v->arr));
+	StrDel(s);
+	StrDel(v);
+
+	/* the last Str using the array frees it */
+	munit_assert_true(StrShare(u));
+	s = StrCopy(u);
+	StrDel(u);
+	munit_assert_true(!strcmp("東京", s->arr));
+	munit_assert_true(StrAdd(s, s));
+	munit_assert_true(!strcmp("東京東京", s->arr));
+	munit_assert_true(StrShare(s));
+
+	/* copies between the heap and an arena do not share, as the arena may be
+	 * freed first and its Strs are never deleted */
+	a = StrArenaNew(0);
+	u = StrCopyInArena(a, s);
+	munit_assert_null(u->shared);
+	munit_assert_ptr_not_equal(u->arr, s->arr);
+	v = StrDropInArena(a, s, 1);
+	munit_assert_null(v->shared);
+	munit_assert_true(!strcmp("京東京", v->arr));
+	StrDel(s);
+	munit_assert_true(!strcmp("東京東京", u->arr));
+	munit_assert_true(StrAddChars(u, "!"));
+	munit_assert_true(!strcmp("東京東京!", u->arr));
+	munit_assert_true(StrShare(u));
+	v = StrCopyInArena(a, u);
+	munit_assert_ptr_equal(v->arr, u->arr);
+	s = StrCopy(u);
+	munit_assert_null(s->shared);
+	StrArenaDel(a);
+	munit_assert_true(!strcmp("東京東京!", s->arr));
+	StrDel(s);
+	StrDel(t);
+
+	return MUNIT_OK;
+}
+
+/* Looks up characters of the interned Str p, which alternate between 'o' and
+ * 'ō', from one of the threads of TestIntern.
+ * Returns 0 if they are all found, otherwise p. */
+void* InternReader(void* p) {
+	const Str* const s = p;
+	Str* const needle = StrNew("oō");
+	size_t i, byte;
+	int ok = 1;
+	for (i = 0; ok && i + 2 <= s->length; ++i) {
+		Str* const t = StrSlice(s, i, i + 2);
+		const size_t offset = i / 2 * 3 + i % 2;
+		ok = t && StrAt(s, i) == (i % 2 ? L'ō' : 'o') &&
+			StrCharToByte(s, i) == offset && StrByteToChar(s, offset) == i &&
+			StrFind(s, needle, i, &byte) == (i + 1) / 2 * 2 &&
+			t->length == 2;
+		StrDel(t);
+	}
+	StrDel(needle);
+	return ok ? 0 : p;
+}
+
+MunitResult TestIntern(const MunitParameter params[], void* data) {
+	StrInternTable* t = StrInternTableNew();
+	Str* s = StrNew("東京, Tōkyō");
+	Str* u = StrNew(0);
+	const Str* p = StrIntern(t, s);
+	const Str* q;
+	const Str* words[3000];
+	const struct StrIndex* index;
+	pthread_t threads[4];
+	char buf[32];
+	size_t i;
+
+	munit_assert_not_null(p);
+	munit_assert_ptr_not_equal(p, s);
+	munit_assert_true(StrEqual(p, s));
+	munit_assert_size(p->length, ==, 9);
+	munit_assert_size(p->cap, ==, p->size);
+	munit_assert_ptr_equal(StrIntern(t, s), p);
+	munit_assert_ptr_equal(StrInternFind(t, s), p);
+	munit_assert_ptr_equal(StrIntern(t, p), p);
+	munit_assert_size(StrInternTableCount(t), ==, 1);
+
+	/* views and the empty string */
+	q = StrInternView(t, StrViewTake(s, 2));
+	munit_assert_true(!strcmp("東京", q->arr));
+	munit_assert_size(q->length, ==, 2);
+	munit_assert_null(StrInternFind(t, u));
+	q = StrIntern(t, u);
+	munit_assert_size(q->size, ==, 1);
+	munit_assert_ptr_equal(StrInternFind(t, u), q);
+	munit_assert_size(StrInternTableCount(t), ==, 3);
+
+	/* many strings, with lengths around every hashing case */
+	for (i = 0; i < 3000; ++i) {
+		StrTrim(u, -1);
+		sprintf(buf, "%lu", (unsigned long)i);
+		StrAddChars(u, buf);
+		while (u->size < 1 + i % 60) StrAddChars(u, "ō");
+		words[i] = StrIntern(t, u);
+		munit_assert_not_null(words[i]);
+		munit_assert_true(StrEqual(words[i], u));
+	}
+	munit_assert_size(StrInternTableCount(t), ==, 3003);
+	for (i = 0; i < 3000; ++i) {
+		StrTrim(u, -1);
+		StrAdd(u, words[i]);
+		munit_assert_ptr_equal(StrIntern(t, u), words[i]);
+		munit_assert_ptr_equal(StrInternFind(t, u), words[i]);
+	}
+	munit_assert_size(StrInternTableCount(t), ==, 3003);
+	munit_assert_ptr_equal(StrIntern(t, s), p);
+
+	/* lookups in an interned Str only read it, so threads may share it */
+	StrTrim(u, -1);
+	for (i = 0; i < 1000; ++i) StrAddChar(u, i % 2 ? L'ō' : 'o');
+	q = StrIntern(t, u);
+	munit_assert_not_null(q);
+	index = q->index;
+	munit_assert_not_null(index);
+	for (i = 0; i < 4; ++i) {
+		munit_assert_int(pthread_create(&threads[i], 0, InternReader,
+			(void*)q), ==, 0);
+	}
+	for (i = 0; i < 4; ++i) {
+		void* result;
+		munit_assert_int(pthread_join(threads[i], &result), ==, 0);
+		munit_assert_null(result);
+	}
+	munit_assert_ptr_equal(q->index, index);
+
+	/* and one of exactly 64 characters (one index stride), read at its end */
+	StrTrim(u, -1);
+	for (i = 0; i < 64; ++i) StrAddChar(u, i % 2 ? L'ō' : 'o');
+	q = StrIntern(t, u);
+	munit_assert_not_null(q);
+	index = q->index;
+	munit_assert_not_null(index);
+	munit_assert_size(StrCharToByte(q, 64), ==, q->size - 1);
+	munit_assert_size(StrCharToByte(q, 63), ==, q->size - 3);
+	munit_assert_size(StrByteToChar(q, q->size - 2), ==, 63);
+	munit_assert_ptr_equal(q->index, index);
+
+	StrDel(s);
+	StrDel(u);
+	StrInternTableDel(t);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestHash(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tōkyō");
+	Str* t = StrNew("Tōkyō");
+	Str* u = StrNew("Tōkya");
+	uint64_t hashes[200];
+	const uint64_t h = StrHash(s, 0);
+	size_t i, j;
+
+	munit_assert_not_null(s->index); /* the hash is cached with the index */
+	munit_assert_uint64(StrHash(s, 0), ==, h);
+	munit_assert_uint64(StrHash(t, 0), ==, h);
+	munit_assert_uint64(StrHash(t, 1), !=, h);
+	munit_assert_uint64(StrHash(u, 0), !=, h);
+	munit_assert_true(StrEqual(s, t));
+	munit_assert_uint64(StrHash(t, 0), ==, h);
+	munit_assert_true(StrEqual(s, t));
+	munit_assert_false(StrEqual(s, u));
+
+	/* changes forget the hash */
+	munit_assert_true(StrAddChar(t, '!'));
+	munit_assert_uint64(StrHash(t, 0), !=, h);
+	munit_assert_true(StrTrim(t, 1));
+	munit_assert_uint64(StrHash(t, 0), ==, h);
+	munit_assert_true(StrInsert(t, 0, u));
+	munit_assert_uint64(StrHash(t, 0), !=, h);
+	munit_assert_true(StrErase(t, 0, 5));
+	munit_assert_uint64(StrHash(t, 0), ==, h);
+	munit_assert_true(StrReplaceAllInPlace(u, u, s));
+	munit_assert_uint64(StrHash(u, 0), ==, h);
+
+	/* copies hash the same, even shared ones, and Strs which are never
+	 * hashed have no cache */
+	StrDel(u);
+	u = StrCopy(s);
+	munit_assert_null(u->index);
+	munit_assert_uint64(StrHash(u, 0), ==, h);
+	StrDel(u);
+	munit_assert_true(StrShare(s));
+	u = StrCopy(s);
+	munit_assert_uint64(StrHash(u, 0), ==, h);
+	munit_assert_true(StrAddChars(u, "-to"));
+	munit_assert_uint64(StrHash(u, 0), !=, h);
+	munit_assert_uint64(StrHash(s, 0), ==, h);
+
+	/* lengths around every hashing case differ */
+	StrTrim(u, -1);
+	for (i = 0; i < 200; ++i) {
+		hashes[i] = StrHash(u, 7);
+		for (j = 0; j < i; ++j) munit_assert_uint64(hashes[j], !=, hashes[i]);
+		StrAddChar(u, 'a' + i % 3);
+	}
+
+	StrDel(s);
+	StrDel(t);
+	StrDel(u);
+
+	return MUNIT_OK;
+}
+
+/* Returns 1 if the n Strs at v are in order, otherwise 0. */
+int IsSorted(Str** v, size_t n) {
+	size_t i;
+	for (i = 1; i < n; ++i)
+		if (strcmp(v[i-1]->arr, v[i]->arr) > 0) return 0;
+	return 1;
+}
+
+MunitResult TestSort(const MunitParameter params[], void* data) {
+	const char* words[] = { "東京", "Tōkyō", "", "Tokyo", "Tōkyō", "東", "Tōky",
+		"tokyo", "Tōkyō-to", "" };
+	const size_t n = 5000;
+	Str* small[10];
+	Str** v = malloc(n * sizeof(*v));
+	Str** w = malloc(n * sizeof(*w));
+	size_t i, u;
+
+	/* code point order, with equal Strs kept in order by the stable sort */
+	for (i = 0; i < 10; ++i) small[i] = w[i] = StrNew(words[i]);
+	munit_assert_true(StrSortStable(small, 10));
+	munit_assert_true(IsSorted(small, 10));
+	munit_assert_string_equal(small[9]->arr, "東京");
+	munit_assert_string_equal(small[8]->arr, "東");
+	munit_assert_string_equal(small[7]->arr, "tokyo");
+	munit_assert_string_equal(small[6]->arr, "Tōkyō-to");
+	munit_assert_string_equal(small[3]->arr, "Tōky");
+	munit_assert_string_equal(small[2]->arr, "Tokyo");
+	munit_assert_ptr_equal(small[4], w[1]);
+	munit_assert_ptr_equal(small[5], w[4]);
+	munit_assert_ptr_equal(small[0], w[2]);
+	munit_assert_ptr_equal(small[1], w[9]);
+	StrSort(small, 10);
+	munit_assert_true(IsSorted(small, 10));
+	u = StrUnique(small, 10);
+	munit_assert_size(u, ==, 8);
+	munit_assert_true(IsSorted(small, u));
+	munit_assert_string_equal(small[0]->arr, "");
+	munit_assert_string_equal(small[1]->arr, "Tokyo");
+	for (i = 0; i < 10; ++i) StrDel(small[i]);
+
+	/* enough for radix sort, with long common præfixes */
+	for (i = 0; i < n; ++i) {
+		char buf[16];
+		v[i] = StrNew(i % 2 ? "https://tōkyō.example/" : "https://東京.example/");
+		sprintf(buf, "%lu", (unsigned long)(i * 7919 % 1000));
+		StrAddChars(v[i], buf);
+		w[i] = v[i];
+	}
+	StrSort(v, n);
+	munit_assert_true(IsSorted(v, n));
+	memcpy(v, w, n * sizeof(*v));
+	munit_assert_true(StrSortStable(v, n));
+	munit_assert_true(IsSorted(v, n));
+	for (i = 1; i < n; ++i) {
+		size_t j = 0;
+		if (!StrEqual(v[i-1], v[i])) continue;
+		/* the earlier of equal Strs comes first */
+		while (w[j] != v[i-1]) {
+			munit_assert_ptr_not_equal(w[j], v[i]);
+			++j;
+		}
+	}
+	memcpy(v, w, n * sizeof(*v));
+	StrSortParallel(v, n, 4);
+	munit_assert_true(IsSorted(v, n));
+	u = StrUnique(v, n);
+	munit_assert_size(u, ==, 1000);
+	munit_assert_true(IsSorted(v, u));
+	for (i = 1; i < u; ++i) munit_assert_false(StrEqual(v[i-1], v[i]));
+
+	for (i = 0; i < n; ++i) StrDel(v[i]);
+	free(v);
+	free(w);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestCase(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Größe of the Straße, İstanbul, ΣΊΣΥΦΟΣ, K, ﬃ");
+	Str* t = StrToLower(s);
+	Str* u = StrToUpper(s);
+	Str* v = StrCaseFold(s);
+	StrArena* a;
+
+	munit_assert_string_equal(t->arr,
+		"größe of the straße, i̇stanbul, σίσυφοσ, k, ﬃ");
+	munit_assert_size(t->length, ==, s->length + 1);
+	munit_assert_string_equal(u->arr,
+		"GRÖSSE OF THE STRASSE, İSTANBUL, ΣΊΣΥΦΟΣ, K, FFI");
+	munit_assert_size(u->length, ==, s->length + 4);
+	munit_assert_string_equal(v->arr,
+		"grösse of the strasse, i̇stanbul, σίσυφοσ, k, ffi");
+	munit_assert_size(v->length, ==, s->length + 5);
+
+	/* folding makes them all equal */
+	munit_assert_true(StrEqualFold(s, t));
+	munit_assert_true(StrEqualFold(u, v));
+	munit_assert_true(StrEqualFold(s, s));
+	munit_assert_int(StrCompareFold(t, u), ==, 0);
+	StrDel(t);
+	StrDel(u);
+	StrDel(v);
+
+	/* ASCII blocks, and where they differ */
+	StrDel(s);
+	s = StrNew("The Quick Brown Fox Jumps Over The Lazy Dog, Again And Again");
+	t = StrNew("the quick brown fox jumps over the lazy dog, again and agaiN");
+	u = StrNew("the quick brown fox jumps over the lazy dog, again and agaim");
+	v = StrNew("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, AGAIN AND AGAIN!");
+	munit_assert_true(StrEqualFold(s, t));
+	munit_assert_int(StrCompareFold(s, u), >, 0);
+	munit_assert_int(StrCompareFold(u, s), <, 0);
+	munit_assert_int(StrCompareFold(s, v), <, 0);
+	munit_assert_false(StrEqualFold(v, t));
+	StrDel(u);
+	u = StrToUpper(s);
+	munit_assert_string_equal(u->arr,
+		"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, AGAIN AND AGAIN");
+	StrDel(u);
+	a = StrArenaNew(0);
+	u = StrToLowerInArena(a, v);
+	munit_assert_string_equal(u->arr,
+		"the quick brown fox jumps over the lazy dog, again and again!");
+	u = StrCaseFoldInArena(a, u);
+	munit_assert_true(StrEqualFold(u, v));
+	StrArenaDel(a);
+
+	/* code point order after folding */
+	StrDel(t);
+	t = StrNew("ǅ");
+	u = StrNew("Ǆa");
+	munit_assert_int(StrCompareFold(t, u), <, 0);
+	munit_assert_int(StrCompareFold(u, t), >, 0);
+	StrDel(s);
+	s = StrNew("straße");
+	StrDel(v);
+	v = StrNew("STRASSEN");
+	munit_assert_int(StrCompareFold(s, v), <, 0);
+	munit_assert_true(StrTrim(v, 1));
+	munit_assert_true(StrEqualFold(v, s));
+
+	StrDel(s);
+	StrDel(t);
+	StrDel(u);
+	StrDel(v);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestNormalize(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Amélie, café, 한국어, ﬁ");
+	Str* t = StrNormalize(s, STR_NFC);
+	Str* u = StrNormalize(s, STR_NFD);
+	Str* v;
+	StrArena* a;
+
+	/* é is decomposed in the first word and precomposed in the second */
+	munit_assert_false(StrIsNormalized(s, STR_NFC));
+	munit_assert_false(StrIsNormalized(s, STR_NFD));
+	munit_assert_string_equal(t->arr, "Amélie, café, 한국어, ﬁ");
+	munit_assert_size(t->length, ==, 20);
+	munit_assert_true(StrIsNormalized(t, STR_NFC));
+	munit_assert_false(StrIsNormalized(t, STR_NFKC));
+	munit_assert_string_equal(u->arr, "Amélie, café, 한국어, ﬁ");
+	munit_assert_size(u->length, ==, 27);
+	munit_assert_true(StrIsNormalized(u, STR_NFD));
+	munit_assert_false(StrIsNormalized(u, STR_NFC));
+
+	/* canonically equivalent Strs become equal */
+	v = StrNormalize(u, STR_NFC);
+	munit_assert_true(StrEqual(v, t));
+	StrDel(v);
+	v = StrNormalize(t, STR_NFD);
+	munit_assert_true(StrEqual(v, u));
+	StrDel(v);
+
+	/* compatibility forms also replace the ligature */
+	v = StrNormalize(s, STR_NFKC);
+	munit_assert_string_equal(v->arr, "Amélie, café, 한국어, fi");
+	munit_assert_true(StrIsNormalized(v, STR_NFKC));
+	StrDel(v);
+	v = StrNormalize(s, STR_NFKD);
+	munit_assert_string_equal(v->arr, "Amélie, café, 한국어, fi");
+	munit_assert_size(v->length, ==, 28);
+	StrDel(v);
+
+	/* marks are put in canonical order, and compose past marks of a lower
+	 * class */
+	StrDel(s);
+	s = StrNew("á̖");
+	StrDel(t);
+	t = StrNormalize(s, STR_NFD);
+	munit_assert_string_equal(t->arr, "á̖");
+	StrDel(u);
+	u = StrNormalize(s, STR_NFC);
+	munit_assert_string_equal(u->arr, "á̖");
+	munit_assert_size(u->length, ==, 2);
+
+	/* ASCII is already normalized, up to a mark after it */
+	StrDel(s);
+	s = StrNew("The quick brown fox jumps over the lazy dog");
+	munit_assert_true(StrIsNormalized(s, STR_NFC));
+	munit_assert_true(StrIsNormalized(s, STR_NFKD));
+	StrDel(t);
+	t = StrNormalize(s, STR_NFKC);
+	munit_assert_true(StrEqual(t, s));
+	munit_assert_true(StrAddChars(s, "é"));
+	munit_assert_false(StrIsNormalized(s, STR_NFC));
+	munit_assert_true(StrIsNormalized(s, STR_NFD));
+	a = StrArenaNew(0);
+	v = StrNormalizeInArena(a, s, STR_NFC);
+	munit_assert_string_equal(v->arr,
+		"The quick brown fox jumps over the lazy dogé");
+	munit_assert_size(v->length, ==, s->length - 1);
+	StrArenaDel(a);
+
+	/* invalid forms */
+	munit_assert_null(StrNormalize(s, 4));
+	munit_assert_false(StrIsNormalized(s, -1));
+
+	StrDel(s);
+	StrDel(t);
+	StrDel(u);
+
+	return MUNIT_OK;
+}
+
 MunitResult TestIter(const MunitParameter params[], void* data) {
 	Str* s = StrNew("Tokyo Metropolis (東京都, Tōkyō-to)");
 	StrIter* it = StrIterNew(s);
@@ -833,17 +2044,575 @@ MunitResult TestIter(const MunitParameter params[], void* data) {
 	return MUNIT_OK;
 }
 
+MunitResult TestIterInit(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tokyo Metropolis (東京都, Tōkyō-to) 🗼");
+	StrIter it;
+	unsigned int c;
+	size_t n = 0;
+
+	StrIterInit(&it, s);
+	munit_assert_ptr(it.str, ==, s);
+	munit_assert_ptr(it.cs, ==, s->arr);
+	munit_assert_uint(StrIterNext(&it), ==, 'T');
+	munit_assert_uint(StrIterPrev(&it), ==, 'T');
+	munit_assert_uint(StrIterPrev(&it), ==, 0);
+
+	/* iterating over every character */
+	Str* t = StrNew(0);
+	STR_FOREACH(c, it, s) {
+		munit_assert_uint(c, ==, StrAt(s, n));
+		StrAddChar(t, c);
+		++n;
+	}
+	munit_assert_size(n, ==, s->length);
+	munit_assert_true(StrEqual(s, t));
+	munit_assert_uint(StrIterNext(&it), ==, 0);
+	munit_assert_uint(StrIterPrev(&it), ==, 0x1f5fc);
+	StrDel(t);
+
+	/* breaking out */
+	n = 0;
+	STR_FOREACH(c, it, s) {
+		if (c == L'東') break;
+		++n;
+	}
+	munit_assert_size(n, ==, 18);
+	munit_assert_uint(StrIterNext(&it), ==, L'京');
+
+	/* empty */
+	t = StrNew(0);
+	STR_FOREACH(c, it, t) munit_assert_true(0);
+	StrDel(t);
+
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestViewSlice(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Parciais fy jac codi baw hud llawn dŵr ger tŷ Mabon.");
+	StrView v;
+
+	v = StrViewSlice(s, 33, 44);
+	munit_assert_size(v.length, ==, 11);
+	munit_assert_size(v.size, ==, 12);
+	munit_assert_ptr(v.arr, ==, &(s->arr[33]));
+	munit_assert_true(!memcmp("n dŵr ger t", v.arr, v.size));
+
+	v = StrViewSlice(s, 4, 0);
+	munit_assert_size(v.length, ==, 0);
+	munit_assert_size(v.size, ==, 0);
+
+	v = StrViewSlice(s, 0, 99);
+	munit_assert_size(v.length, ==, s->length);
+	munit_assert_size(v.size, ==, s->size - 1);
+	munit_assert_true(StrViewEqual(v, StrViewOf(s)));
+
+	v = StrViewTake(s, 4);
+	munit_assert_true(!memcmp("Parc", v.arr, v.size));
+	munit_assert_size(v.length, ==, 4);
+
+	v = StrViewDrop(s, 45);
+	munit_assert_true(!memcmp(" Mabon.", v.arr, v.size));
+	munit_assert_size(v.length, ==, 7);
+	munit_assert_size(v.size, ==, 7);
+
+	v = StrViewDrop(s, 99);
+	munit_assert_size(v.length, ==, 0);
+	munit_assert_size(v.size, ==, 0);
+
+	StrDel(s);
+	s = StrNew("Hellô ẃöŗłd‼");
+
+	v = StrViewTakeWhile(s, IsAscii);
+	munit_assert_true(!memcmp("Hell", v.arr, v.size));
+	munit_assert_size(v.length, ==, 4);
+	munit_assert_size(v.size, ==, 4);
+
+	v = StrViewDropWhile(s, IsAscii);
+	munit_assert_true(!memcmp("ô ẃöŗłd‼", v.arr, v.size));
+	munit_assert_size(v.length, ==, 8);
+	munit_assert_size(v.size, ==, s->size - 5);
+
+	/* views are turned into Strs on request */
+	Str* t = StrNewFromView(v);
+	munit_assert_not_null(t);
+	munit_assert_size(t->length, ==, 8);
+	munit_assert_true(!strcmp("ô ẃöŗłd‼", t->arr));
+	StrDel(t);
+
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestViewCompare(const MunitParameter params[], void* data) {
+	Str* s = StrNew("東京都, Tōkyō-to, 東京都");
+	const StrView first = StrViewTake(s, 3);
+	const StrView last = StrViewDrop(s, s->length - 3);
+	const StrView middle = StrViewSlice(s, 5, 13);
+
+	munit_assert_true(StrViewEqual(first, last));
+	munit_assert_false(StrViewEqual(first, middle));
+	munit_assert_true(StrViewStartsWith(StrViewOf(s), first));
+	munit_assert_true(StrViewStartsWith(StrViewOf(s), last));
+	munit_assert_false(StrViewStartsWith(StrViewOf(s), middle));
+	munit_assert_false(StrViewStartsWith(first, StrViewOf(s)));
+	munit_assert_true(StrViewEndsWith(StrViewOf(s), first));
+	munit_assert_false(StrViewEndsWith(StrViewOf(s), middle));
+	munit_assert_true(StrViewEndsWith(middle, StrViewSlice(s, 10, 13)));
+	munit_assert_true(StrViewStartsWith(middle, StrViewDrop(s, s->length)));
+
+	munit_assert_size(StrViewFindChar(middle, L'ō'), ==, 1);
+	munit_assert_size(StrViewFindChar(middle, L'東'), ==, -1);
+	munit_assert_size(StrViewFindChar(last, L'都'), ==, 2);
+
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestViewIter(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tokyo Metropolis (東京都, Tōkyō-to)");
+	StrView v = StrViewSlice(s, 18, 22);
+	Str* t = StrNew(0);
+	unsigned int c;
+
+	while ((c = StrViewNext(&v))) StrAddChar(t, c);
+	munit_assert_true(!strcmp("東京都,", t->arr));
+	munit_assert_true(StrViewIsNull(v));
+	munit_assert_size(v.size, ==, 0);
+
+	v = StrViewSlice(s, 18, 22);
+	StrTrim(t, 100);
+	while ((c = StrViewPrev(&v))) StrAddChar(t, c);
+	munit_assert_true(!strcmp(",都京東", t->arr));
+	munit_assert_ptr(v.arr, ==, &(s->arr[18]));
+
+	/* adding a view of itself */
+	StrAddView(t, StrViewOf(t));
+	StrAddView(t, StrViewTake(t, 1));
+	munit_assert_true(!strcmp(",都京東,都京東,", t->arr));
+	munit_assert_size(t->length, ==, 9);
+
+	StrDel(t);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestArena(const MunitParameter params[], void* data) {
+	StrArena* a = StrArenaNew(1024);
+	munit_assert_not_null(a);
+	size_t i;
+
+	Str* s = StrNewInArena(a, "Ελλάδα");
+	munit_assert_not_null(s);
+	munit_assert_ptr(s->alloc, ==, StrArenaAllocator(a));
+	munit_assert_size(s->length, ==, 6);
+	munit_assert_true(!strcmp("Ελλάδα", s->arr));
+
+	/* the most recent string grows in place */
+	const char* const arr = s->arr;
+	StrAddChars(s, ", Ελληνική Δημοκρατία");
+	munit_assert_ptr(s->arr, ==, arr);
+	munit_assert_true(!strcmp("Ελλάδα, Ελληνική Δημοκρατία", s->arr));
+
+	Str* t = StrNewInArena(a, 0);
+	munit_assert_not_null(t);
+	munit_assert_true(!strcmp("", t->arr));
+
+	/* s is no longer the most recent, so it moves, within the arena */
+	StrAddChars(s, "! Ελληνική Δημοκρατία! Ελληνική Δημοκρατία!");
+	munit_assert_ptr(s->arr, !=, arr);
+	munit_assert_true(!strcmp("Ελλάδα, Ελληνική Δημοκρατία! Ελληνική "
+		"Δημοκρατία! Ελληνική Δημοκρατία!", s->arr));
+
+	/* growing past the chunk size */
+	for (i = 0; i < 1000; ++i) StrAddChar(t, L'α' + i % 25);
+	munit_assert_size(t->length, ==, 1000);
+	munit_assert_size(t->size, ==, 2001);
+	for (i = 0; i < 1000; ++i) munit_assert_uint(StrAt(t, i), ==, L'α' + i % 25);
+
+	/* derived strings */
+	Str* u = StrSliceInArena(a, s, 8, 16);
+	munit_assert_ptr(u->alloc, ==, StrArenaAllocator(a));
+	munit_assert_true(!strcmp("Ελληνική", u->arr));
+	u = StrReverseInArena(a, u);
+	munit_assert_true(!strcmp("ήκινηλλΕ", u->arr));
+	u = StrTakeInArena(a, s, 6);
+	munit_assert_true(!strcmp("Ελλάδα", u->arr));
+	u = StrDropInArena(a, s, s->length - 11);
+	munit_assert_true(!strcmp("Δημοκρατία!", u->arr));
+	u = StrCopyInArena(a, u);
+	munit_assert_true(!strcmp("Δημοκρατία!", u->arr));
+	u = StrTakeWhileInArena(a, s, IsNotFourBytes);
+	munit_assert_true(StrEqual(s, u));
+	u = StrDropWhileInArena(a, s, IsNotFourBytes);
+	munit_assert_true(StrIsNull(u));
+	u = StrNewFromBytesInArena(a, "abc", 2);
+	munit_assert_true(!strcmp("ab", u->arr));
+	u = StrNewFromViewInArena(a, StrViewTake(s, 3));
+	munit_assert_true(!strcmp("Ελλ", u->arr));
+	munit_assert_null(StrNewInArena(a, "\xff"));
+
+	/* deleting an arena Str is allowed, but does not release memory */
+	StrDel(u);
+
+	/* arenas can be reused after resetting */
+	StrArenaReset(a);
+	for (i = 0; i < 1000; ++i) {
+		s = StrNewInArena(a, "Αθήνα");
+		munit_assert_not_null(s);
+		munit_assert_true(!strcmp("Αθήνα", s->arr));
+	}
+
+	/* 0 means the heap */
+	s = StrCopyInArena(0, s);
+	munit_assert_ptr(s->alloc, ==, StrGetAllocator());
+	StrArenaDel(a);
+	munit_assert_true(!strcmp("Αθήνα", s->arr));
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+/* Allocator wrapping malloc that counts the blocks in use */
+struct Counter { size_t blocks; size_t allocs; };
+
+void* CountAllocate(void* ctx, size_t n) {
+	struct Counter* const c = ctx;
+	void* const p = malloc(n);
+	if (p) { ++c->blocks; ++c->allocs; }
+	return p;
+}
+
+void* CountReallocate(void* ctx, void* p, size_t n, size_t m) {
+	struct Counter* const c = ctx;
+	++c->allocs;
+	return realloc(p, m);
+}
+
+void CountRelease(void* ctx, void* p) {
+	struct Counter* const c = ctx;
+	--c->blocks;
+	free(p);
+}
+
+MunitResult TestAllocator(const MunitParameter params[], void* data) {
+	struct Counter c = { 0, 0 };
+	const StrAllocator counting =
+		{ CountAllocate, CountReallocate, 0, CountRelease, &c };
+	size_t i;
+
+	/* per Str allocator, used for everything the Str allocates */
+	Str* s = StrNewWithAllocator(&counting, "Ελλάδα");
+	munit_assert_not_null(s);
+	munit_assert_ptr(s->alloc, ==, &counting);
+	munit_assert_size(c.blocks, ==, 1);
+	for (i = 0; i < 1000; ++i) StrAddChar(s, L'α' + i % 25);
+	munit_assert_uint(StrAt(s, 900), ==, L'α' + 894 % 25);
+	StrIter* it = StrIterNew(s);
+	munit_assert_size(c.blocks, ==, 4); /* Str, array, index, iterator */
+	StrIterDel(it);
+	StrDel(s);
+	munit_assert_size(c.blocks, ==, 0);
+
+	/* default allocator, also used by derived strings and arenas */
+	StrSetAllocator(&counting);
+	munit_assert_ptr(StrGetAllocator(), ==, &counting);
+	s = StrNew("Αθήνα");
+	Str* t = StrReverse(s);
+	munit_assert_true(!strcmp("ανήθΑ", t->arr));
+	StrArena* a = StrArenaNew(0);
+	Str* u = StrNewInArena(a, "Αθήνα");
+	munit_assert_ptr(u->alloc, ==, StrArenaAllocator(a));
+	munit_assert_size(c.blocks, ==, 4); /* s, t, arena, chunk */
+	StrArenaDel(a);
+	StrSetAllocator(0);
+
+	/* Strs keep the allocator they were created with */
+	Str* v = StrNew("Αθήνα");
+	munit_assert_ptr(v->alloc, !=, &counting);
+	StrDel(v);
+	StrDel(t);
+	StrDel(s);
+	munit_assert_size(c.blocks, ==, 0);
+
+	/* and so do ropes, including ones split off them */
+	StrRope* r = StrRopeNewWithAllocator(&counting);
+	munit_assert_true(StrRopeInsert(r, 0, "Αθήνα", 10));
+	StrRope* q = StrRopeSplit(r, 2);
+	munit_assert_size(c.blocks, ==, 4); /* r and q, and a chunk of each */
+	StrRopeDel(q);
+	StrRopeDel(r);
+	munit_assert_size(c.blocks, ==, 0);
+	munit_assert_size(c.allocs, >, 5);
+
+	return MUNIT_OK;
+}
+
+/* Callback for StrMatcherRun that stops after the third occurrence */
+int StopAtThird(void* ctx, const StrMatch* match) {
+	size_t* const seen = ctx;
+	return ++*seen == 3;
+}
+
+MunitResult TestMatcher(const MunitParameter params[], void* data) {
+	Str* patterns[6];
+	StrMatch matches[16];
+	size_t seen = 0, i;
+	patterns[0] = StrNew("he");
+	patterns[1] = StrNew("she");
+	patterns[2] = StrNew("his");
+	patterns[3] = StrNew("hers");
+	patterns[4] = StrNew("");
+	patterns[5] = StrNew("東京");
+	StrMatcher* m = StrMatcherNew((const Str* const*)patterns, 6);
+	munit_assert_not_null(m);
+
+	Str* s = StrNew("ushers in 東京 say his hers");
+	munit_assert_size(StrMatcherFind(m, s, matches, 16), ==, 7);
+	/* ushers: she, he, hers */
+	munit_assert_size(matches[0].pattern, ==, 1);
+	munit_assert_size(matches[0].index, ==, 1);
+	munit_assert_size(matches[1].pattern, ==, 0);
+	munit_assert_size(matches[1].index, ==, 2);
+	munit_assert_size(matches[2].pattern, ==, 3);
+	munit_assert_size(matches[2].byteOffset, ==, 2);
+	/* 東京 */
+	munit_assert_size(matches[3].pattern, ==, 5);
+	munit_assert_size(matches[3].index, ==, 10);
+	munit_assert_size(matches[3].byteOffset, ==, 10);
+	/* his, he, hers, after multi-byte characters */
+	munit_assert_size(matches[4].pattern, ==, 2);
+	munit_assert_size(matches[4].index, ==, 17);
+	munit_assert_size(matches[4].byteOffset, ==, 21);
+	munit_assert_size(matches[5].pattern, ==, 0);
+	munit_assert_size(matches[5].index, ==, 21);
+	munit_assert_size(matches[6].pattern, ==, 3);
+	munit_assert_size(matches[6].index, ==, 21);
+
+	/* counting, and array too small */
+	munit_assert_size(StrMatcherRun(m, s, 0, 0), ==, 7);
+	matches[2].pattern = 100;
+	munit_assert_size(StrMatcherFind(m, s, matches, 2), ==, 7);
+	munit_assert_size(matches[2].pattern, ==, 100);
+
+	/* stopping early */
+	munit_assert_size(StrMatcherRun(m, s, StopAtThird, &seen), ==, 3);
+	munit_assert_size(seen, ==, 3);
+	StrDel(s);
+
+	/* no occurrences, long enough to use the prefilter */
+	s = StrNew(0);
+	for (i = 0; i < 100; ++i) StrAddChars(s, "Tōkyō-to ");
+	munit_assert_size(StrMatcherRun(m, s, 0, 0), ==, 0);
+	StrAddChars(s, "she");
+	munit_assert_size(StrMatcherFind(m, s, matches, 16), ==, 2);
+	munit_assert_size(matches[1].index, ==, 901);
+	StrDel(s);
+	StrMatcherDel(m);
+
+	/* duplicates and many first bytes */
+	StrDel(patterns[4]);
+	patterns[4] = StrNew("his");
+	m = StrMatcherNew((const Str* const*)patterns + 1, 4);
+	s = StrNew("This is his");
+	munit_assert_size(StrMatcherFind(m, s, matches, 16), ==, 4);
+	munit_assert_size(matches[0].pattern, ==, 1);
+	munit_assert_size(matches[1].pattern, ==, 3);
+	munit_assert_size(matches[2].index, ==, 8);
+	munit_assert_size(matches[3].pattern, ==, 3);
+	StrDel(s);
+	StrMatcherDel(m);
+
+	/* no patterns */
+	m = StrMatcherNew(0, 0);
+	s = StrNew("ushers");
+	munit_assert_size(StrMatcherRun(m, s, 0, 0), ==, 0);
+	StrDel(s);
+	StrMatcherDel(m);
+
+	for (i = 0; i < 6; ++i) StrDel(patterns[i]);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestRope(const MunitParameter params[], void* data) {
+	StrRope* r = StrRopeNew();
+	StrRope* q;
+	StrRopeIter it;
+	StrView v;
+	Str* s;
+	size_t i, chunks = 0, size = 0;
+	munit_assert_not_null(r);
+	munit_assert_size(StrRopeLength(r), ==, 0);
+
+	/* edits in the middle */
+	munit_assert_true(StrRopeInsert(r, 0, "Tōkyō-to", 10));
+	munit_assert_true(StrRopeInsert(r, 5, " 東京都", 10));
+	munit_assert_false(StrRopeInsert(r, 100, "x", 1));
+	munit_assert_false(StrRopeInsert(r, 0, "\xff", 1));
+	s = StrRopeToStr(r);
+	munit_assert_true(!strcmp("Tōkyō 東京都-to", s->arr));
+	munit_assert_size(s->length, ==, 12);
+	StrDel(s);
+	munit_assert_true(StrRopeErase(r, 5, 9));
+	munit_assert_true(StrRopeErase(r, 6, 100));
+	munit_assert_false(StrRopeErase(r, 7, 6));
+	s = StrRopeToStr(r);
+	munit_assert_true(!strcmp("Tōkyō-", s->arr));
+	munit_assert_uint(StrRopeAt(r, 4), ==, L'ō');
+	munit_assert_uint(StrRopeAt(r, 6), ==, 0);
+	StrDel(s);
+	StrRopeDel(r);
+
+	/* a large rope, spanning many chunks */
+	s = StrNew(0);
+	for (i = 0; i < 10000; ++i) StrAddChar(s, i % 10 ? 'a' + i % 26 : L'東');
+	r = StrRopeNewFromStr(s);
+	munit_assert_size(StrRopeLength(r), ==, 10000);
+	munit_assert_size(StrRopeSize(r), ==, s->size - 1);
+	for (i = 0; i < 10000; i += 999) munit_assert_uint(StrRopeAt(r, i), ==, StrAt(s, i));
+	munit_assert_true(StrRopeInsert(r, 5000, "🗼", 4));
+	munit_assert_uint(StrRopeAt(r, 5000), ==, 0x1f5fc);
+	munit_assert_uint(StrRopeAt(r, 5001), ==, StrAt(s, 5000));
+	munit_assert_true(StrRopeErase(r, 5000, 5001));
+
+	/* chunks, in order */
+	StrRopeIterInit(&it, r);
+	while (StrRopeIterNext(&it, &v)) {
+		munit_assert_true(v.size > 0);
+		munit_assert_true(!memcmp(v.arr, s->arr + size, v.size));
+		size += v.size;
+		++chunks;
+	}
+	munit_assert_size(size, ==, s->size - 1);
+	munit_assert_size(chunks, >, 1);
+
+	/* splitting and joining */
+	q = StrRopeSplit(r, 3333);
+	munit_assert_size(StrRopeLength(r), ==, 3333);
+	munit_assert_size(StrRopeLength(q), ==, 10000 - 3333);
+	munit_assert_uint(StrRopeAt(q, 0), ==, StrAt(s, 3333));
+	StrRopeConcat(q, r);
+	munit_assert_size(StrRopeLength(r), ==, 0);
+	munit_assert_uint(StrRopeAt(q, 0), ==, StrAt(s, 3333));
+	munit_assert_uint(StrRopeAt(q, 10000 - 3333), ==, StrAt(s, 0));
+	StrRopeConcat(r, q);
+	StrRopeDel(q);
+	q = StrRopeSplit(r, 10000 - 3333);
+	StrRopeConcat(q, r);
+	Str* t = StrRopeToStr(q);
+	munit_assert_true(StrEqual(s, t));
+	StrDel(t);
+	StrRopeDel(q);
+	StrRopeDel(r);
+
+	/* edits inside chunks keep the tree balanced */
+	r = StrRopeNewFromStr(s);
+	for (i = 0; i < 20000; ++i) {
+		munit_assert_true(StrRopeInsert(r, i * 7919 % StrRopeLength(r),
+			"0123456789", 10));
+	}
+	munit_assert_size(StrRopeLength(r), ==, 210000);
+	chunks = size = 0;
+	StrRopeIterInit(&it, r);
+	while (StrRopeIterNext(&it, &v)) {
+		size += v.size;
+		++chunks;
+	}
+	munit_assert_size(size, ==, StrRopeSize(r));
+	for (i = 0; (size_t)1 << i < chunks; ++i);
+	munit_assert_size(StrRopeDepth(r), <=, 3 * i);
+	StrRopeDel(r);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
+MunitResult TestGap(const MunitParameter params[], void* data) {
+	Str* s = StrNew("Tōkyō-to");
+	StrGap* g = StrGapNew(s);
+	size_t i;
+	StrDel(s);
+	munit_assert_not_null(g);
+	munit_assert_size(StrGapLength(g), ==, 8);
+	munit_assert_size(StrGapCursor(g), ==, 8);
+
+	/* moving and editing at the cursor */
+	munit_assert_size(StrGapBack(g, 3), ==, 3);
+	munit_assert_true(StrGapInsert(g, " 東京都", 10));
+	munit_assert_false(StrGapInsert(g, "\xff", 1));
+	munit_assert_size(StrGapCursor(g), ==, 9);
+	s = StrNew("Tōkyō 東京都");
+	munit_assert_true(StrViewEqual(StrGapBefore(g), StrViewOf(s)));
+	StrDel(s);
+	munit_assert_size(StrGapAfter(g).length, ==, 3);
+	munit_assert_size(StrGapDelete(g, 1), ==, 1);
+	munit_assert_size(StrGapBackspace(g, 4), ==, 4);
+	munit_assert_size(StrGapForward(g, 100), ==, 2);
+	munit_assert_size(StrGapDelete(g, 1), ==, 0);
+	munit_assert_size(StrGapAfter(g).size, ==, 0);
+	StrGapSeek(g, 0);
+	munit_assert_size(StrGapBackspace(g, 1), ==, 0);
+	munit_assert_true(StrGapInsert(g, "→", 3));
+	StrGapSeek(g, 3);
+	munit_assert_size(StrGapCursor(g), ==, 3);
+
+	s = StrGapFlatten(g);
+	munit_assert_true(!strcmp("→Tōkyōto", s->arr));
+	munit_assert_size(s->length, ==, 8);
+	munit_assert_uint(StrAt(s, 4), ==, L'y');
+	StrAddChars(s, " 🗼");
+	munit_assert_true(!strcmp("→Tōkyōto 🗼", s->arr));
+	StrDel(s);
+
+	/* many edits at a cursor in a long buffer */
+	g = StrGapNew(0);
+	for (i = 0; i < 1000; ++i) munit_assert_true(StrGapInsert(g, "ab", 2));
+	StrGapSeek(g, 1000);
+	for (i = 0; i < 500; ++i) {
+		munit_assert_true(StrGapInsert(g, "東", 3));
+		munit_assert_size(StrGapBack(g, 1), ==, 1);
+	}
+	munit_assert_size(StrGapLength(g), ==, 2500);
+	StrGapSeek(g, 2500);
+	s = StrGapFlatten(g);
+	munit_assert_uint(StrAt(s, 999), ==, 'b');
+	munit_assert_uint(StrAt(s, 1000), ==, L'東');
+	munit_assert_uint(StrAt(s, 1499), ==, L'東');
+	munit_assert_uint(StrAt(s, 1500), ==, 'a');
+	munit_assert_size(StrCountChar(s, L'東'), ==, 500);
+	StrDel(s);
+
+	return MUNIT_OK;
+}
+
 MunitTest tests[] = {
 	{ "/StrNew", TestNew, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrNewSetCap", TestNewSetCap, NULL, NULL, MUNIT_TEST_OPTION_NONE,
 		paramsNewSetCap },
+	{ "/StrNewFromBytes", TestNewFromBytes, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
+	{ "/StrNewStrict", TestNewStrict, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrIsNull", TestIsNull, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrEqual", TestEqual, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrCompare", TestCompare, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrValidate", TestValidate, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrStartsWith", TestLength, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrEndsWith", TestLength, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrLength", TestLength, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrFindChar", TestFindChar, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrCountChar", TestCountChar, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrFind*", TestFind, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrAt", TestAt, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrAt (long)", TestAtLong, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrCharToByte", TestCharToByte, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
+	{ "/StrByteToChar", TestByteToChar, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
 	{ "/StrFirst", TestFirst, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrLast", TestFirst, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrCopy", TestCopy, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
@@ -854,8 +2623,35 @@ MunitTest tests[] = {
 	{ "/StrDropWhile", TestDropWhile, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrReverse", TestReverse, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ "/StrAdd*", TestAdd, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrAddBytes", TestAddBytes, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrAddCodepoints", TestCodepoints, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
+	{ "/StrNewFromUTF16", TestUTF16, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrNewFromLatin1", TestLatin1, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
 	{ "/StrTrim", TestTrim, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrInsert", TestInsert, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrReplaceAll", TestReplaceAll, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrReserve", TestReserve, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrShare", TestShare, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrIntern", TestIntern, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrHash", TestHash, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrSort", TestSort, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrCase", TestCase, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrNormalize", TestNormalize, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
 	{ "/StrIter*", TestIter, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrIterInit", TestIterInit, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrView*", TestViewSlice, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrViewEqual", TestViewCompare, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
+	{ "/StrViewNext", TestViewIter, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrArena*", TestArena, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrSetAllocator", TestAllocator, NULL, NULL, MUNIT_TEST_OPTION_NONE,
+		NULL },
+	{ "/StrMatcher*", TestMatcher, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrRope*", TestRope, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
+	{ "/StrGap*", TestGap, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL },
 	{ NULL, NULL, NULL, NULL, MUNIT_TEST_OPTION_NONE, NULL }
 };
 
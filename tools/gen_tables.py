@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+# Copyright (C) 2023 nikolashn
+# See LICENSE for copyright/license information
+
+"""Generates utf8tables.h, the Unicode data tables private to utf8str.c, from
+the Unicode database of the running Python (unicodedata and str methods).
+
+Usage: python3 tools/gen_tables.py > utf8tables.h
+"""
+
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 7
+BLOCK = 1 << BLOCK_SHIFT
+CASE_LONG = 1 << 30
+HANGUL_FIRST = 0xac00
+HANGUL_LAST = 0xd7a3
+FORMS = ("NFC", "NFD", "NFKC", "NFKD")
+QC_YES, QC_NO, QC_MAYBE = 0, 1, 2
+
+
+def chars():
+    """Every Unicode scalar value."""
+    for c in range(0x110000):
+        if not 0xd800 <= c < 0xe000:
+            yield c
+
+
+def two_stage(values, default):
+    """Splits a mapping from code points to small integers into blocks of BLOCK
+    code points, sharing equal blocks. Returns the limit (the first code point
+    after the last block), the block of each range of BLOCK code points, and
+    the values of the blocks, one after the other."""
+    top = max(values) + 1 if values else 1
+    limit = (top + BLOCK - 1) // BLOCK * BLOCK
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, limit, BLOCK):
+        block = tuple(values.get(c, default) for c in range(start, start + BLOCK))
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return limit, stage1, stage2
+
+
+def array(ctype, name, values, per_line=12):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append("\t" + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def case_tables():
+    """Case mapping of each code point as a record of lower, upper and fold
+    mappings, each either a difference to add to the code point or CASE_LONG
+    with the offset of a sequence in the long mappings."""
+    records = {(0, 0, 0): 0}
+    long_maps = {}
+    long_values = []
+    values = {}
+
+    def encode(c, m):
+        if len(m) == 1:
+            return ord(m) - c
+        key = tuple(ord(x) for x in m)
+        if key not in long_maps:
+            long_maps[key] = len(long_values)
+            long_values.append(len(key))
+            long_values.extend(key)
+        return CASE_LONG + long_maps[key]
+
+    for c in chars():
+        ch = chr(c)
+        record = (encode(c, ch.lower()), encode(c, ch.upper()),
+            encode(c, ch.casefold()))
+        if record == (0, 0, 0):
+            continue
+        if record not in records:
+            records[record] = len(records)
+        values[c] = records[record]
+
+    limit, stage1, stage2 = two_stage(values, 0)
+    assert len(set(stage1)) < 256 and len(records) < 65536
+    ordered = sorted(records, key=records.get)
+    return "\n\n".join([
+        "/* Case mappings, looked up by caseStage2[(caseStage1[c >> %d] << %d) |\n"
+        " * (c & %d)] for c < CASE_LIMIT, which is the index of a record of the\n"
+        " * lower, upper and fold mappings of c. Each is either a difference to add\n"
+        " * to c, or CASE_LONG + i, where caseLong[i] is the amount of code points\n"
+        " * of the mapping, which follow it. */" % (BLOCK_SHIFT, BLOCK_SHIFT, BLOCK - 1),
+        "#define CASE_SHIFT %d\n#define CASE_LIMIT 0x%x\n#define CASE_LONG 0x%x"
+            % (BLOCK_SHIFT, limit, CASE_LONG),
+        array("unsigned char", "caseStage1", stage1),
+        array("uint16_t", "caseStage2", stage2),
+        "static const int32_t caseRecords[%d][3] = {\n%s\n};" % (len(ordered),
+            "\n".join("\t{ %d, %d, %d }," % r for r in ordered)),
+        array("uint32_t", "caseLong", long_values),
+    ])
+
+
+def composition_pairs():
+    """The canonical compositions of Unicode as (first, second, composite),
+    found as the characters with a canonical decomposition into two code
+    points which compose back (so without composition exclusions). Hangul
+    syllables are composed algorithmically and are not included."""
+    pairs = []
+    for c in chars():
+        d = unicodedata.decomposition(chr(c))
+        if not d or d.startswith("<"):
+            continue
+        d = [int(x, 16) for x in d.split()]
+        if len(d) == 2 and \
+            unicodedata.normalize("NFC", chr(d[0]) + chr(d[1])) == chr(c):
+            pairs.append((d[0], d[1], c))
+    return sorted(pairs)
+
+
+def norm_tables():
+    """Normalization properties of each code point as a record of its
+    canonical combining class, its quick check values for each form and the
+    offsets of its full canonical and compatibility decompositions."""
+    pairs = composition_pairs()
+    seconds = set(p[1] for p in pairs)
+    seconds.update(range(0x1161, 0x1176))  # Hangul vowels
+    seconds.update(range(0x11a8, 0x11c3))  # and trailing consonants
+    records = {(0, 0, 0, 0): 0}
+    decomps = {(): 0}
+    decomp_values = [0]
+    values = {}
+
+    def offset(m):
+        key = tuple(ord(x) for x in m)
+        if key not in decomps:
+            decomps[key] = len(decomp_values)
+            decomp_values.append(len(key))
+            decomp_values.extend(key)
+        return decomps[key]
+
+    for c in chars():
+        ch = chr(c)
+        flags = 0
+        for i, form in enumerate(FORMS):
+            if unicodedata.normalize(form, ch) != ch:
+                flags |= QC_NO << (2 * i)
+            elif form in ("NFC", "NFKC") and c in seconds:
+                flags |= QC_MAYBE << (2 * i)
+        canonical = compatibility = 0
+        if not HANGUL_FIRST <= c <= HANGUL_LAST:
+            nfd = unicodedata.normalize("NFD", ch)
+            nfkd = unicodedata.normalize("NFKD", ch)
+            canonical = offset(nfd) if nfd != ch else 0
+            compatibility = offset(nfkd) if nfkd != ch else 0
+        record = (unicodedata.combining(ch), flags, canonical, compatibility)
+        if record == (0, 0, 0, 0):
+            continue
+        if record not in records:
+            records[record] = len(records)
+        values[c] = records[record]
+
+    limit, stage1, stage2 = two_stage(values, 0)
+    assert len(set(stage1)) < 65536 and len(records) < 65536
+    assert len(decomp_values) < 65536
+    ordered = sorted(records, key=records.get)
+    return "\n\n".join([
+        "/* Normalization properties, looked up by normStage2[(normStage1[c >> %d]\n"
+        " * << %d) | (c & %d)] for c < NORM_LIMIT, which is the index of a record of\n"
+        " * the canonical combining class of c, its quick check values, two bits for\n"
+        " * each of NFC, NFD, NFKC and NFKD in turn (0 for yes, 1 for no and 2 for\n"
+        " * maybe), and the offsets of its full canonical and compatibility\n"
+        " * decompositions in normDecomp (or 0 if c decomposes to itself, or is a\n"
+        " * Hangul syllable), where normDecomp[i] is the amount of code points of the\n"
+        " * decomposition, which follow it. */" % (BLOCK_SHIFT, BLOCK_SHIFT, BLOCK - 1),
+        "#define NORM_SHIFT %d\n#define NORM_LIMIT 0x%x" % (BLOCK_SHIFT, limit),
+        array("uint16_t", "normStage1", stage1),
+        array("uint16_t", "normStage2", stage2),
+        "static const struct {\n\tunsigned char ccc, quickCheck;\n"
+            "\tuint16_t canonical, compatibility;\n} normRecords[%d] = {\n%s\n};"
+            % (len(ordered), "\n".join("\t{ %d, %d, %d, %d }," % r for r in ordered)),
+        array("uint32_t", "normDecomp", decomp_values),
+        "/* Canonical compositions as { first, second, composite }, sorted by first\n"
+        " * and then by second (without Hangul syllables). */",
+        "static const uint32_t normPairs[%d][3] = {\n%s\n};" % (len(pairs),
+            "\n".join("\t{ 0x%x, 0x%x, 0x%x }," % p for p in pairs)),
+    ])
+
+
+def main():
+    out = [
+        "/* Generated by tools/gen_tables.py from Unicode %s. Do not edit. */"
+            % unicodedata.unidata_version,
+        "/* Private to utf8str.c */",
+        "",
+        "#ifndef __NIKOLASHN_UTF8TABLES_H",
+        "#define __NIKOLASHN_UTF8TABLES_H",
+        "",
+        "#define UNICODE_VERSION \"%s\"" % unicodedata.unidata_version,
+        "",
+        case_tables(),
+        "",
+        norm_tables(),
+        "",
+        "#endif",
+    ]
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
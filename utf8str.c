@@ -2,16 +2,97 @@
 /* See LICENSE for copyright/license information */
 
 #include "utf8str.h"
+#include "utf8tables.h"
 
+#include <pthread.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
-#define INIT_CAP 256
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BLOCK_SIZE 32
+#elif defined(__SSE2__)
+#ifdef __SSSE3__
+#include <tmmintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#define BLOCK_SIZE 16
+#endif
+
+/* Without SSSE3 at compile time, UTF8CheckBlocks is still compiled for it with
+ * GCC or Clang, and used if the CPU running the code supports it */
+#if defined(__SSE2__) && !defined(__SSSE3__) && defined(__GNUC__) && \
+	(defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define SSSE3_DISPATCH
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#else
+#define SSSE3_TARGET
+#endif
+
+/* Capacity of new strings that are empty or short. A Str's initial array is
+ * placed directly after it, in the same allocation, so this keeps short
+ * strings in a single small block. */
+#define INIT_CAP 24
+#define INDEX_STRIDE 64
+#define HUGE_CAP ((size_t)1 << 17) /* arrays at least this big grow by pages */
+#define PAGE_SIZE 4096
+
+/* Lookup data of a Str, allocated when first needed: the hash cached by
+ * StrHash, and a checkpoint index, where offsets[i] is the byte offset of
+ * character i*INDEX_STRIDE, for each i < count. There is always at least one
+ * entry. */
+struct StrIndex {
+	uint64_t hash; /* Hash of the Str with seed hashSeed, if hashed */
+	uint64_t hashSeed;
+	int hashed;
+	size_t count;
+	size_t cap;
+	size_t offsets[1];
+};
+
+/* Header of a buffer shared by Strs, followed by its bytes */
+struct StrShared {
+	size_t refs; /* Amount of Strs using the buffer, changed atomically */
+	const StrAllocator* alloc; /* Allocator of the buffer */
+};
+
+#define ARENA_CHUNK_SIZE 65536
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+/* Chunk of memory that an arena allocates from, followed by its data. */
+struct StrArenaChunk {
+	struct StrArenaChunk* next;
+	size_t size; /* Amount of bytes of data */
+	size_t used; /* Amount of bytes of data allocated */
+};
+
+#define ARENA_HEADER ARENA_ROUND(sizeof(struct StrArenaChunk))
+#define ARENA_DATA(c) ((char*)(c) + ARENA_HEADER)
+
+struct StrArena {
+	StrAllocator alloc; /* Allocator of Strs in the arena */
+	const StrAllocator* parent; /* Allocator of the arena and its chunks */
+	struct StrArenaChunk* head; /* Chunk currently allocated from */
+	size_t chunkSize;
+	char* last; /* Most recent allocation in head, or 0 */
+};
+
+static int StrAddChecked(Str* const s, const char* const cs, const size_t n,
+	const int flags);
+static int StrAddUnchecked(Str* const s, const char* const cs, const size_t n,
+	const size_t length);
+static void* StrAlloc(const StrAllocator* const alloc, const size_t n);
+static void StrFree(const StrAllocator* const alloc, void* const p);
+static const StrAllocator* defaultAllocator;
 
 /* Get size of UTF-8 encoding of Unicode character c in bytes.
  * Returns 0 if c is not a valid Unicode character. */
-size_t UTF8Size(const unsigned int c) {
+static size_t UTF8Size(const unsigned int c) {
 	if (c < 0x80) return 1;
 	else if (c < 0x800) return 2;
 	else if (c < 0x10000) return 3;
@@ -19,9 +100,39 @@ size_t UTF8Size(const unsigned int c) {
 	return 0;
 }
 
+/* Write the UTF-8 encoding of the Unicode character c to out (which must have
+ * room for 4 bytes).
+ * Returns the size of the encoding in bytes, or 0 if c is not a valid Unicode
+ * character. */
+static size_t UTF8Encode(const unsigned int c, char* const out) {
+	if (c < 0x80) {
+		out[0] = (char)c;
+		return 1;
+	}
+	else if (c < 0x800) {
+		out[0] = (char)((c >> 6) | 0xc0);
+		out[1] = (char)((c & 0x3f) | 0x80);
+		return 2;
+	}
+	else if (c < 0x10000) {
+		out[0] = (char)((c >> 12) | 0xe0);
+		out[1] = (char)(((c >> 6) & 0x3f) | 0x80);
+		out[2] = (char)((c & 0x3f) | 0x80);
+		return 3;
+	}
+	else if (c < 0x110000) {
+		out[0] = (char)((c >> 18) | 0xf0);
+		out[1] = (char)(((c >> 12) & 0x3f) | 0x80);
+		out[2] = (char)(((c >> 6) & 0x3f) | 0x80);
+		out[3] = (char)((c & 0x3f) | 0x80);
+		return 4;
+	}
+	return 0;
+}
+
 /* Get UTF8 character starting at pointer cs.
  * Returns code point if found, otherwise -1. */
-unsigned int UTF8At(const char* const cs) {
+static unsigned int UTF8At(const char* const cs) {
 	if (!cs) return -1;
 
 	int c = -1;
@@ -50,445 +161,4526 @@ unsigned int UTF8At(const char* const cs) {
 
 /* Get UTF8 character before cs.
  * Returns code point if found, otherwise -1. */
-unsigned int UTF8Before(const char* cs) {
+static unsigned int UTF8Before(const char* cs) {
 	do { --cs; } while ((*cs & 0xc0) == 0x80);
 	return UTF8At(cs);
 }
 
-/* Repeatedly double the capacity of s until it is at least the target size.
- * If unable to do so, return 0. Otherwise return s. */
-Str* StrResize(Str* s, const size_t size) {
-	if (s->cap >= size) return s;
-	while (s->cap < size) {
-		if (s->cap > SIZE_MAX/2) return 0;
-		s->cap *= 2;
-	}
-	s->arr = realloc(s->arr, s->cap);
-	return s;
+#ifdef BLOCK_SIZE
+/* Returns 1 if the BLOCK_SIZE bytes at p are all nonzero ASCII, otherwise 0. */
+static int UTF8BlockIsAscii(const unsigned char* const p) {
+#if defined(__AVX2__)
+	const __m256i v = _mm256_loadu_si256((const __m256i*)p);
+	const __m256i z = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+	return _mm256_movemask_epi8(_mm256_or_si256(v, z)) == 0;
+#else
+	const __m128i v = _mm_loadu_si128((const __m128i*)p);
+	const __m128i z = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	return _mm_movemask_epi8(_mm_or_si128(v, z)) == 0;
+#endif
 }
+#endif
 
-/* Creates and initializes a new Str with the byte array cs. cs can be set to 0
- * or NULL to initialize an empty string.
- * Returns 0 if unable to create, otherwise a pointer to the Str. */
-Str* StrNew(const char* const cs) {
-	Str* s = StrNewSetCap(INIT_CAP);
-	if (s && cs) {
-		const int ret = StrAddChars(s, cs);
-		if (!ret) return 0;
+/* Returns the amount of characters in the n bytes at cs, i.e. the amount of
+ * bytes that are not continuation bytes. */
+static size_t UTF8CountChars(const char* cs, size_t n) {
+	size_t count = 0;
+#ifdef __SSE2__
+	const __m128i lastCont = _mm_set1_epi8(-65);
+	const __m128i zero = _mm_setzero_si128();
+	while (n >= 16) {
+		/* count in bytes for up to 255 blocks, then add up the bytes */
+		size_t blocks = n / 16 < 255 ? n / 16 : 255;
+		__m128i acc = zero;
+		n -= blocks * 16;
+		while (blocks--) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, lastCont));
+			cs += 16;
+		}
+		acc = _mm_sad_epu8(acc, zero);
+		count += _mm_cvtsi128_si32(acc) + _mm_extract_epi16(acc, 4);
 	}
-	return s;
+#endif
+	while (n--) {
+		if ((*cs++ & 0xc0) != 0x80) ++count;
+	}
+	return count;
 }
 
-/* Prærequisites: initCap > 0.
- * Creates and initializes a new Str, with initial capacity set by initCap.
- * Returns 0 if unable to create, otherwise a pointer to the Str */
-Str* StrNewSetCap(const size_t initCap) {
-	if (!initCap) return 0;
-	Str* s = malloc(sizeof(*s));
-	if (!s) return 0;
-	s->length = 0;
-	s->size = 1;
-	s->cap = initCap;
-	s->arr = calloc(initCap, 1);
-	if (!s->arr) return 0;
-	s->arr[0] = 0;
-	return s;
+/* Returns the amount of bytes equal to b in the n bytes at cs. */
+static size_t UTF8CountByte(const char* cs, size_t n, const char b) {
+	size_t count = 0;
+#ifdef __SSE2__
+	const __m128i needle = _mm_set1_epi8(b);
+	const __m128i zero = _mm_setzero_si128();
+	while (n >= 16) {
+		/* count in bytes for up to 255 blocks, then add up the bytes */
+		size_t blocks = n / 16 < 255 ? n / 16 : 255;
+		__m128i acc = zero;
+		n -= blocks * 16;
+		while (blocks--) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(v, needle));
+			cs += 16;
+		}
+		acc = _mm_sad_epu8(acc, zero);
+		count += _mm_cvtsi128_si32(acc) + _mm_extract_epi16(acc, 4);
+	}
+#endif
+	while (n--) {
+		if (*cs++ == b) ++count;
+	}
+	return count;
 }
 
-/* Free the memory underlying s and then s itself. */
-void StrDel(Str* const s) {
-	free(s->arr);
-	free(s);
+/* Returns a pointer to the start of the n-th character (starting from 0) from
+ * cs, or end if there are not that many characters before end. */
+static const char* UTF8Advance(const char* cs, const char* const end,
+	size_t n)
+{
+#ifdef __SSE2__
+	const __m128i lastCont = _mm_set1_epi8(-65);
+	while (end - cs >= 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+		const size_t count = __builtin_popcount(
+			_mm_movemask_epi8(_mm_cmpgt_epi8(v, lastCont)));
+		if (count > n) break;
+		n -= count;
+		cs += 16;
+	}
+#endif
+	for (; cs < end; ++cs) {
+		if ((*cs & 0xc0) != 0x80) {
+			if (!n) return cs;
+			--n;
+		}
+	}
+	return end;
 }
 
-/* Returns 1 if s contains no characters, otherwise returns 0. */
-int StrIsNull(const Str* const s) { return s->length == 0; }
-
-/* Returns 1 if the strings s and t are equal, 0 otherwise. */
-int StrEqual(const Str* const s, const Str* const t) {
-	if (s->length != t->length || s->size != t->size)
-		return 0;
-	/* as every Unicode string has a unique representation in terms of an array of
-	 * bytes, the following works */
-	size_t i;
-	for (i = 0; i < s->size; ++i) {
-		if (s->arr[i] != t->arr[i]) return 0;
+/* Returns the offset of the first byte that differs between the n bytes at a
+ * and at b, or n if they are all equal. */
+static size_t UTF8Mismatch(const char* const a, const char* const b,
+	const size_t n)
+{
+	size_t i = 0;
+#if defined(__AVX2__)
+	for (; i + 32 <= n; i += 32) {
+		const __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+		const __m256i w = _mm256_loadu_si256((const __m256i*)(b + i));
+		const unsigned int eq = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, w));
+		if (eq != 0xffffffff) return i + __builtin_ctz(~eq);
 	}
-	return 1;
+#endif
+#ifdef __SSE2__
+	for (; i + 16 <= n; i += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+		const __m128i w = _mm_loadu_si128((const __m128i*)(b + i));
+		const unsigned int eq = _mm_movemask_epi8(_mm_cmpeq_epi8(v, w));
+		if (eq != 0xffff) return i + __builtin_ctz(~eq);
+	}
+#endif
+	for (; i < n; ++i) {
+		if (a[i] != b[i]) return i;
+	}
+	return n;
 }
 
-/* Returns 1 if the string s has t as a præfix, 0 otherwise. */
-int StrStartsWith(const Str* const s, const Str* const t) {
-	if (t->length > s->length || t->size > s->size)
-		return 0;
+/* Three-way comparison of the n bytes of valid UTF-8 at a with the m bytes at
+ * b, in code point order (which for UTF-8 is the same as byte order). If
+ * diffIndex is not 0, the index of the first character that differs (or the
+ * length of the shorter one, if one is a præfix of the other) is stored in it.
+ * Returns a negative value if a comes first, 0 if equal, otherwise positive. */
+static int UTF8Compare(const char* const a, const size_t n, const char* const b,
+	const size_t m, size_t* const diffIndex)
+{
+	size_t i = UTF8Mismatch(a, b, n < m ? n : m);
+	int cmp;
+	if (i < n && i < m) cmp = (unsigned char)a[i] - (unsigned char)b[i];
+	else cmp = (n > m) - (n < m);
+	if (diffIndex) {
+		/* the differing character starts at or before the differing byte */
+		while (i < n && i < m && (a[i] & 0xc0) == 0x80) --i;
+		*diffIndex = UTF8CountChars(a, i);
+	}
+	return cmp;
+}
 
-	StrIter* sit = StrIterNew(s);
-	if (!sit) return 0;
-	StrIter* tit = StrIterNew(t);
-	if (!tit) return 0;
+/* Byte i of the sequence at p, read forwards if dir is 1, or backwards from p
+ * (its last byte) if dir is -1. */
+#define TW_AT(p, i) ((p)[(ptrdiff_t)(i) * dir])
 
-	while (StrIterHasNext(tit)) {
-		const unsigned int c = StrIterNext(sit);
-		const unsigned int d = StrIterNext(tit);
-		if (c == -1 || d == -1 || c != d) {
-			StrIterDel(tit); StrIterDel(sit); return 0;
+/* Maximal suffix of the m bytes at x (read in direction dir) under the byte
+ * order, or the reverse byte order if flip. Returns the position before the
+ * start of the suffix (possibly -1), storing the period of the suffix in
+ * *period. */
+static ptrdiff_t TwoWayMaxSuffix(const unsigned char* const x,
+	const ptrdiff_t m, const int dir, const int flip, ptrdiff_t* const period)
+{
+	ptrdiff_t ms = -1, j = 0, k = 1, p = 1;
+	while (j + k < m) {
+		const unsigned char a = TW_AT(x, j + k), b = TW_AT(x, ms + k);
+		if (flip ? a > b : a < b) {
+			j += k;
+			k = 1;
+			p = j - ms;
+		}
+		else if (a == b) {
+			if (k != p) ++k;
+			else {
+				j += p;
+				k = 1;
+			}
+		}
+		else {
+			ms = j;
+			j = ms + 1;
+			k = p = 1;
 		}
 	}
-
-	StrIterDel(tit);
-	StrIterDel(sit);
-	return 1;
+	*period = p;
+	return ms;
 }
 
-/* Returns 1 if the string s has t as a postfix, 0 otherwise. */
-int StrEndsWith(const Str* const s, const Str* const t) {
-	if (t->length > s->length || t->size > s->size)
-		return 0;
-
-	StrIter* sit = StrIterNew(s);
-	if (!sit) return 0;
-	StrIter* tit = StrIterNew(t);
-	if (!tit) return 0;
+/* Two-Way string matching (Crochemore and Perrin) of the m bytes at x in the n
+ * bytes at y, both read in direction dir, in O(n + m) time and O(1) space.
+ * Prærequisites: 0 < m <= n.
+ * Returns how many bytes into y (in direction dir) the first match starts, or
+ * -1 if there is none. */
+static size_t TwoWaySearch(const unsigned char* const y, const ptrdiff_t n,
+	const unsigned char* const x, const ptrdiff_t m, const int dir)
+{
+	ptrdiff_t p, q, ell, per, i, j = 0;
+	const ptrdiff_t ell1 = TwoWayMaxSuffix(x, m, dir, 0, &p);
+	const ptrdiff_t ell2 = TwoWayMaxSuffix(x, m, dir, 1, &q);
+	if (ell1 > ell2) { ell = ell1; per = p; }
+	else { ell = ell2; per = q; }
 
-	while (StrIterHasPrev(tit)) {
-		const unsigned int c = StrIterPrev(sit);
-		const unsigned int d = StrIterPrev(tit);
-		if (c == -1 || d == -1 || c != d) {
-			StrIterDel(tit); StrIterDel(sit); return 0;
+	for (i = 0; i <= ell && TW_AT(x, i) == TW_AT(x, i + per); ++i);
+	if (i > ell) {
+		/* periodic needle: remember how much of the period has matched */
+		ptrdiff_t memory = -1;
+		while (j <= n - m) {
+			i = (ell > memory ? ell : memory) + 1;
+			while (i < m && TW_AT(x, i) == TW_AT(y, i + j)) ++i;
+			if (i >= m) {
+				i = ell;
+				while (i > memory && TW_AT(x, i) == TW_AT(y, i + j)) --i;
+				if (i <= memory) return j;
+				j += per;
+				memory = m - per - 1;
+			}
+			else {
+				j += i - ell;
+				memory = -1;
+			}
 		}
 	}
-
-	StrIterDel(tit);
-	StrIterDel(sit);
-	return 1;
+	else {
+		per = (ell + 1 > m - ell - 1 ? ell + 1 : m - ell - 1) + 1;
+		while (j <= n - m) {
+			i = ell + 1;
+			while (i < m && TW_AT(x, i) == TW_AT(y, i + j)) ++i;
+			if (i >= m) {
+				i = ell;
+				while (i >= 0 && TW_AT(x, i) == TW_AT(y, i + j)) --i;
+				if (i < 0) return j;
+				j += per;
+			}
+			else j += i - ell;
+		}
+	}
+	return -1;
 }
 
-/* Returns the amount of UTF-8 characters in s. */
-size_t StrLength(const Str* const s) { return s->length; }
+#undef TW_AT
 
-/* Returns the first index of the character c if found, otherwise returns -1. */
-size_t StrFindChar(const Str* const s, const unsigned int c) {
-	StrIter* it = StrIterNew(s);
-	if (!it) return 0;
-	unsigned int d = 0;
-	size_t index = -1;
-	while (StrIterHasNext(it) && d != c) {
-		d = StrIterNext(it);
-		if (d == -1) { 
-			StrIterDel(it);
-			return -1;
+/* Returns the offset of the first occurrence of the m bytes at x in the n
+ * bytes at h, or -1 if there is none.
+ * Candidates are found a block at a time by comparing the first and last bytes
+ * of x, and checked with memcmp. Checks that fail use up a budget earned by
+ * the bytes scanned, and once it runs out the rest is searched with Two-Way,
+ * so the worst case stays linear. */
+static size_t UTF8Find(const char* const h, const size_t n, const char* const x,
+	const size_t m)
+{
+	size_t i = 0, r;
+	if (!m) return 0;
+	if (m > n) return -1;
+	if (m == 1) {
+		const char* const p = memchr(h, x[0], n);
+		return p ? (size_t)(p - h) : (size_t)-1;
+	}
+#ifdef BLOCK_SIZE
+	size_t budget = 256;
+#if defined(__AVX2__)
+	const __m256i first = _mm256_set1_epi8(x[0]);
+	const __m256i last = _mm256_set1_epi8(x[m-1]);
+#else
+	const __m128i first = _mm_set1_epi8(x[0]);
+	const __m128i last = _mm_set1_epi8(x[m-1]);
+#endif
+	for (; i + m - 1 + BLOCK_SIZE <= n; i += BLOCK_SIZE) {
+#if defined(__AVX2__)
+		const __m256i v = _mm256_loadu_si256((const __m256i*)(h + i));
+		const __m256i w = _mm256_loadu_si256((const __m256i*)(h + i + m - 1));
+		unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(
+			_mm256_cmpeq_epi8(v, first), _mm256_cmpeq_epi8(w, last)));
+#else
+		const __m128i v = _mm_loadu_si128((const __m128i*)(h + i));
+		const __m128i w = _mm_loadu_si128((const __m128i*)(h + i + m - 1));
+		unsigned int mask = _mm_movemask_epi8(_mm_and_si128(
+			_mm_cmpeq_epi8(v, first), _mm_cmpeq_epi8(w, last)));
+#endif
+		while (mask) {
+			const size_t j = i + __builtin_ctz(mask);
+			if (!memcmp(h + j + 1, x + 1, m - 2)) return j;
+			if (budget < m) {
+				i = j + 1;
+				goto twoWay;
+			}
+			budget -= m;
+			mask &= mask - 1;
 		}
-		++index;
+		budget += 2 * BLOCK_SIZE;
 	}
-	StrIterDel(it);
-	if (d == c) return index;
-	return -1;
+twoWay:
+#endif
+	if (m > n - i) return -1;
+	r = TwoWaySearch((const unsigned char*)h + i, n - i,
+		(const unsigned char*)x, m, 1);
+	return r == -1 ? r : i + r;
 }
 
-/* Prærequisites: index < StrLength(s).
- * Returns the code point of the index-th (starting from 0) Unicode character of
- * s if index is within range and valid UTF-8 character exists at that index,
- * otherwise returns 0. */
-unsigned int StrAt(const Str* const s, const size_t index) {
-	if (index >= StrLength(s)) return 0;
+/* Returns the offset of the last occurrence of the m bytes at x in the n bytes
+ * at h, or -1 if there is none. */
+static size_t UTF8FindLast(const char* const h, const size_t n,
+	const char* const x, const size_t m)
+{
+	size_t r;
+	if (!m) return n;
+	if (m > n) return -1;
+	r = TwoWaySearch((const unsigned char*)h + n - 1, n,
+		(const unsigned char*)x + m - 1, m, -1);
+	return r == -1 ? r : n - r - m;
+}
 
-	const char* cs = s->arr;
-	unsigned int c;
+/* Returns the index of the first occurrence of the Unicode character c in the
+ * n bytes of valid UTF-8 at cs, or -1 if there is none. */
+static size_t UTF8FindChar(const char* const cs, const size_t n,
+	const unsigned int c)
+{
+	char bytes[4];
+	const size_t m = c ? UTF8Encode(c, bytes) : 0;
 	size_t i;
-	for (i = 0; i <= index; ++i) {
-		c = UTF8At(cs);
-		if (c == -1) return 0;
-		cs += UTF8Size(c);
+	if (!m) return -1;
+	i = UTF8Find(cs, n, bytes, m);
+	if (i == -1) return -1;
+	return UTF8CountChars(cs, i);
+}
+
+/* Returns the amount of occurrences of the Unicode character c in the n bytes
+ * of valid UTF-8 at cs. */
+static size_t UTF8CountChar(const char* const cs, const size_t n,
+	const unsigned int c)
+{
+	char bytes[4];
+	const size_t m = c ? UTF8Encode(c, bytes) : 0;
+	size_t count = 0, i = 0;
+	if (!m) return 0;
+	if (m == 1) return UTF8CountByte(cs, n, bytes[0]);
+	/* occurrences of a character cannot overlap */
+	for (;;) {
+		const size_t j = UTF8Find(cs + i, n - i, bytes, m);
+		if (j == -1) return count;
+		++count;
+		i += j + m;
 	}
-	
-	return c;
 }
 
-/* Prærequisites: s is not null.
- * Returns the code point of the first Unicode character of s, if it exists,
- * otherwise returns 0. */
-unsigned int StrFirst(const Str* const s) {
-	if (StrIsNull(s)) return 0;
-	const unsigned int c = UTF8At(s->arr);
-	if (c == -1) return 0;
-	return c;
+/* Finds the non-overlapping occurrences of the m > 0 bytes at x in the n bytes
+ * at h, from left to right, and stores their offsets in *offsets. This holds
+ * cap entries at first, and is replaced by a larger block from alloc when full,
+ * which the caller must free if *offsets has changed.
+ * Returns the amount of occurrences, or -1 if unable to allocate. */
+static size_t UTF8FindAll(const StrAllocator* const alloc, const char* const h,
+	const size_t n, const char* const x, const size_t m,
+	size_t** const offsets, size_t cap)
+{
+	size_t* const initial = *offsets;
+	size_t count = 0, i = 0;
+	for (;;) {
+		const size_t j = UTF8Find(h + i, n - i, x, m);
+		if (j == -1) return count;
+		if (count == cap) {
+			size_t* const grown = cap > SIZE_MAX / 2 / sizeof(size_t) ? 0 :
+				StrAlloc(alloc, 2 * cap * sizeof(size_t));
+			if (!grown) return -1;
+			memcpy(grown, *offsets, cap * sizeof(size_t));
+			if (*offsets != initial) StrFree(alloc, *offsets);
+			*offsets = grown;
+			cap *= 2;
+		}
+		(*offsets)[count++] = i + j;
+		i += j + m;
+	}
 }
 
-/* Prærequisites: s is not null.
- * Returns the code point of the last Unicode character of s, if it exists,
- * otherwise returns 0. */
-unsigned int StrLast(const Str* const s) {
-	if (StrIsNull(s)) return 0;
-	const unsigned int c = UTF8Before(&(s->arr[s->size]));
-	if (c == -1) return 0;
-	return c;
+#define CASE_LOWER 0
+#define CASE_UPPER 1
+#define CASE_FOLD 2
+
+/* Store the code points of the lower case (if kind is CASE_LOWER), upper case
+ * (CASE_UPPER) or case folded (CASE_FOLD) mapping of the Unicode character c
+ * in out, which has room for 3.
+ * Returns the amount of code points stored. */
+static size_t UnicodeCaseMap(const unsigned int c, const int kind,
+	uint32_t* const out)
+{
+	int32_t v;
+	if (c >= CASE_LIMIT) {
+		out[0] = c;
+		return 1;
+	}
+	v = caseRecords[caseStage2[(caseStage1[c >> CASE_SHIFT] << CASE_SHIFT) |
+		(c & ((1 << CASE_SHIFT) - 1))]][kind];
+	if (v >= CASE_LONG) {
+		const uint32_t* const m = caseLong + (v - CASE_LONG);
+		memcpy(out, m + 1, m[0] * sizeof(*out));
+		return m[0];
+	}
+	out[0] = c + v;
+	return 1;
 }
 
-/* Create a copy of s and return it. 
- * Returns 0 if unsuccessful, otherwise a pointer to the copy of s. */
-Str* StrCopy(const Str* const s) {
-	Str* t = StrNewSetCap(s->cap);
-	if (!t) return 0;
-	memcpy(t->arr, s->arr, s->size);
-	t->length = s->length;
-	t->size = s->size;
-	return t;
+/* Returns the ASCII character c mapped like UnicodeCaseMap. */
+static unsigned int ASCIICaseMap(const unsigned int c, const int kind) {
+	if (kind == CASE_UPPER) return c - 'a' < 26 ? c - 0x20 : c;
+	return c - 'A' < 26 ? c + 0x20 : c;
 }
 
-/* Create a new Str containing a slice of s from indices first to last (not
- * inclusive), i.e.:
- *   if first <= last <= StrLength(s), the substring s[first..last);
- *   otherwise, if first > last or first > StrLength(s), the empty string.
- *   otherwise, the substring s[first..StrLength(s));
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * slice. */
-Str* StrSlice(const Str* const s, const size_t first, const size_t last) {
-	Str* t = StrNew(0);
-	if (!t) return 0;
+#ifdef BLOCK_SIZE
+/* Store the BLOCK_SIZE ASCII bytes at cs in out, mapped like UnicodeCaseMap. */
+static void ASCIIBlockCaseMap(const char* const cs, char* const out,
+	const int kind)
+{
+	const char first = kind == CASE_UPPER ? 'a' : 'A';
+	const char delta = kind == CASE_UPPER ? -0x20 : 0x20;
+#if defined(__AVX2__)
+	const __m256i v = _mm256_loadu_si256((const __m256i*)cs);
+	const __m256i in = _mm256_and_si256(
+		_mm256_cmpgt_epi8(v, _mm256_set1_epi8(first - 1)),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8(first + 26), v));
+	_mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(v,
+		_mm256_and_si256(in, _mm256_set1_epi8(delta))));
+#else
+	const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+	const __m128i in = _mm_and_si128(
+		_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)),
+		_mm_cmpgt_epi8(_mm_set1_epi8(first + 26), v));
+	_mm_storeu_si128((__m128i*)out, _mm_add_epi8(v,
+		_mm_and_si128(in, _mm_set1_epi8(delta))));
+#endif
+}
+#endif
 
-	const char* cs = s->arr;
-	size_t i;
+#define NORM_YES 0 /* quick check values of the tables */
+#define NORM_NO 1
+#define NORM_MAYBE 2
 
-	if (first <= last && last < s->length) {
-		for (i = 0; i < last; ++i) {
-			const unsigned int c = UTF8At(cs);
-			if (c == -1) { StrDel(t); return 0; }
-			cs += UTF8Size(c);
-			if (i >= first) StrAddChar(t, c);
-		}
-	}
-	else if (first <= last && first <= s->length) {
-		for (i = 0; i < first; ++i) {
-			const unsigned int c = UTF8At(cs);
-			if (c == -1) { StrDel(t); return 0; }
-			cs += UTF8Size(c);
-		}
+#define NORM_INSERTION 16 /* longest run of non-starters sorted by insertion */
 
-		size_t size = s->arr + s->size - cs;
-		t = StrResize(t, size);
-		if (!t) return 0;
+#define HANGUL_S 0xac00 /* first syllable */
+#define HANGUL_L 0x1100 /* first leading consonant */
+#define HANGUL_V 0x1161 /* first vowel */
+#define HANGUL_T 0x11a7 /* one before the first trailing consonant */
+#define HANGUL_LCOUNT 19
+#define HANGUL_VCOUNT 21
+#define HANGUL_TCOUNT 28
+#define HANGUL_COUNT (HANGUL_LCOUNT * HANGUL_VCOUNT * HANGUL_TCOUNT)
 
-		memcpy(t->arr, cs, size);
-		t->length = s->length - first;
-		t->size = size;
-	}
-	
-	return t;
+/* Returns the index in normRecords of the normalization record of the Unicode
+ * character c. */
+static unsigned int NormRecord(const unsigned int c) {
+	if (c >= NORM_LIMIT) return 0;
+	return normStage2[(normStage1[c >> NORM_SHIFT] << NORM_SHIFT) |
+		(c & ((1 << NORM_SHIFT) - 1))];
 }
 
-/* Create a new Str: if n < StrLength(s), the præfix of s of length n;
- * otherwise, a copy of s. 
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * præfix. */
-Str* StrTake(const Str* const s, const size_t n) {
-	if (n < s->length) return StrSlice(s, 0, n);
-	else return StrCopy(s);
+/* Code points of a segment being normalized, each with its canonical
+ * combining class in the top 8 bits. They are kept in local until it is
+ * full, and then in a block from defaultAllocator. */
+struct NormBuffer {
+	uint32_t* cps;
+	size_t count;
+	size_t cap;
+	uint32_t local[64];
+};
+
+static void NormBufferInit(struct NormBuffer* const b) {
+	b->cps = b->local;
+	b->count = 0;
+	b->cap = sizeof(b->local) / sizeof(b->local[0]);
 }
 
-/* Create a new Str: if n < StrLength(s), the postfix of s of length n;
- * otherwise, an empty string.
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * postfix. */
-Str* StrDrop(const Str* const s, const size_t n) {
-	if (n < s->length) return StrSlice(s, n, s->length);
-	else return StrNew(0);
+static void NormBufferFree(struct NormBuffer* const b) {
+	if (b->cps != b->local) StrFree(defaultAllocator, b->cps);
 }
 
-/* Create a new Str that returns the longest præfix of s such that for each
- * Unicode character c in the præfix, p(c) != 0.
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * præfix. */
-Str* StrTakeWhile(const Str* const s, int (*p)(unsigned int)) {
-	Str* t = StrNew(0);
-	if (!t) return 0;
-	const char* cs = s->arr;
-	unsigned int c;
-	while (cs < &(s->arr[s->size]) && (c = UTF8At(cs)) != -1 && p(c)) {
-		cs += UTF8Size(c);
-		StrAddChar(t, c);
+/* Adds the Unicode character c to the end of b.
+ * Returns 1 if successful, otherwise 0. */
+static int NormBufferAdd(struct NormBuffer* const b, const unsigned int c) {
+	if (b->count == b->cap) {
+		uint32_t* const grown = b->cap > SIZE_MAX / 2 / sizeof(uint32_t) ? 0 :
+			StrAlloc(defaultAllocator, 2 * b->cap * sizeof(uint32_t));
+		if (!grown) return 0;
+		memcpy(grown, b->cps, b->count * sizeof(uint32_t));
+		NormBufferFree(b);
+		b->cps = grown;
+		b->cap *= 2;
 	}
-	if (c == -1) { StrDel(t); return 0; }
-	return t;
+	b->cps[b->count++] = c | (uint32_t)normRecords[NormRecord(c)].ccc << 24;
+	return 1;
 }
 
-/* Create a new Str that returns the longest præfix of s such that for each
- * Unicode character c in the præfix, p(c) != 0.
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * præfix. */
-Str* StrDropWhile(const Str* const s, int (*p)(unsigned int)) {
-	Str* t = StrNew(0);
-	if (!t) return 0;
+/* Adds the full canonical decomposition of the Unicode character c (or the
+ * compatibility decomposition, if compat is not 0) to the end of b.
+ * Returns 1 if successful, otherwise 0. */
+static int NormDecompose(struct NormBuffer* const b, const unsigned int c,
+	const int compat)
+{
+	size_t i, d;
+	if (c - HANGUL_S < HANGUL_COUNT) {
+		const unsigned int j = c - HANGUL_S;
+		if (!NormBufferAdd(b, HANGUL_L + j / (HANGUL_VCOUNT * HANGUL_TCOUNT)) ||
+			!NormBufferAdd(b, HANGUL_V + j % (HANGUL_VCOUNT * HANGUL_TCOUNT) /
+				HANGUL_TCOUNT)) return 0;
+		return j % HANGUL_TCOUNT ? NormBufferAdd(b, HANGUL_T + j % HANGUL_TCOUNT)
+			: 1;
+	}
+	d = compat ? normRecords[NormRecord(c)].compatibility :
+		normRecords[NormRecord(c)].canonical;
+	if (!d) return NormBufferAdd(b, c);
+	for (i = 1; i <= normDecomp[d]; ++i) {
+		if (!NormBufferAdd(b, normDecomp[d + i])) return 0;
+	}
+	return 1;
+}
 
-	const char* cs = s->arr;
-	unsigned int c;
-	size_t length = s->length;
-	while (cs < &(s->arr[s->size]) && (c = UTF8At(cs)) != -1 && p(c)) {
-		cs += UTF8Size(c);
-		--length;
+/* Puts the code points of b in canonical order, by sorting each run of
+ * characters with a non-zero combining class by their class, keeping the order
+ * of equal classes. Short runs are sorted by insertion and long ones (only met
+ * in contrived text) by counting, so it takes linear time.
+ * Returns 1 if successful, otherwise 0. */
+static int NormReorder(struct NormBuffer* const b) {
+	uint32_t* const v = b->cps;
+	size_t i = 0, j, k;
+	while (i < b->count) {
+		if (!(v[i] >> 24)) {
+			++i;
+			continue;
+		}
+		for (j = i + 1; j < b->count && v[j] >> 24; ++j);
+		if (j - i <= NORM_INSERTION) {
+			for (k = i + 1; k < j; ++k) {
+				const uint32_t x = v[k];
+				size_t m = k;
+				for (; m > i && v[m-1] >> 24 > x >> 24; --m) v[m] = v[m-1];
+				v[m] = x;
+			}
+		}
+		else {
+			size_t counts[256] = {0}, sum = 0;
+			uint32_t* const tmp = StrAlloc(defaultAllocator,
+				(j - i) * sizeof(uint32_t));
+			if (!tmp) return 0;
+			for (k = i; k < j; ++k) ++counts[v[k] >> 24];
+			for (k = 0; k < 256; ++k) {
+				const size_t count = counts[k];
+				counts[k] = sum;
+				sum += count;
+			}
+			for (k = i; k < j; ++k) tmp[counts[v[k] >> 24]++] = v[k];
+			memcpy(v + i, tmp, (j - i) * sizeof(uint32_t));
+			StrFree(defaultAllocator, tmp);
+		}
+		i = j;
 	}
-	if (cs >= &(s->arr[s->size])) return t;
-	if (c == -1) { StrDel(t); return 0; }
+	return 1;
+}
 
-	const size_t size = s->arr + s->size - cs;
-	t = StrResize(t, size);
-	if (!t) return 0;
+/* Returns the canonical composition of the Unicode characters a and b, or 0 if
+ * they do not compose. */
+static unsigned int NormComposePair(const unsigned int a,
+	const unsigned int b)
+{
+	size_t lo = 0, hi = sizeof(normPairs) / sizeof(normPairs[0]);
+	if (a - HANGUL_L < HANGUL_LCOUNT && b - HANGUL_V < HANGUL_VCOUNT) {
+		return HANGUL_S + ((a - HANGUL_L) * HANGUL_VCOUNT + b - HANGUL_V) *
+			HANGUL_TCOUNT;
+	}
+	if (a - HANGUL_S < HANGUL_COUNT && !((a - HANGUL_S) % HANGUL_TCOUNT) &&
+		b - HANGUL_T - 1 < HANGUL_TCOUNT - 1) return a + b - HANGUL_T;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (normPairs[mid][0] < a ||
+			(normPairs[mid][0] == a && normPairs[mid][1] < b)) lo = mid + 1;
+		else hi = mid;
+	}
+	return lo < sizeof(normPairs) / sizeof(normPairs[0]) &&
+		normPairs[lo][0] == a && normPairs[lo][1] == b ? normPairs[lo][2] : 0;
+}
 
-	memcpy(t->arr, cs, size);
-	t->length = length;
-	t->size = size;
+/* Composes the code points of b, which are in canonical order, as in the
+ * canonical composition algorithm: each character which is not blocked from
+ * the last starter (by a starter or a character of the same or a higher
+ * combining class between them) is combined with it if they compose. */
+static void NormCompose(struct NormBuffer* const b) {
+	uint32_t* const v = b->cps;
+	size_t starter = -1, out = 0, i;
+	int last = -1; /* class of the last character kept after the starter */
+	for (i = 0; i < b->count; ++i) {
+		const int ccc = v[i] >> 24;
+		unsigned int c;
+		if (starter != -1 && last < ccc && (c = NormComposePair(
+			v[starter] & 0xffffff, v[i] & 0xffffff)))
+		{
+			v[starter] = c;
+			continue;
+		}
+		if (!ccc) {
+			starter = out;
+			last = -1;
+		}
+		else last = ccc;
+		v[out++] = v[i];
+	}
+	b->count = out;
+}
 
-	return t;
+/* Prærequisites: form is STR_NFC, STR_NFD, STR_NFKC or STR_NFKD.
+ * Returns the quick check value (NORM_YES, NORM_NO or NORM_MAYBE) of the
+ * normalization record r for the form. */
+static unsigned int NormQuickCheck(const unsigned int r, const int form) {
+	return normRecords[r].quickCheck >> 2 * form & 3;
 }
 
-/* Create a new Str which has the reverse of the characters of s.
- * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
- * reverse. */
-Str* StrReverse(const Str* const s) {
-	Str* t = StrNew(0);
-	if (!t) return 0;
+/* Prærequisites: form is STR_NFC, STR_NFD, STR_NFKC or STR_NFKD.
+ * Finds the first segment from cs to end which may not be in the
+ * normalization form, i.e. which has a character that the quick check of
+ * Unicode does not answer yes for, or a character of a lower combining class
+ * after a higher one. The segment runs from the last boundary (a character
+ * that is a starter which the quick check answers yes for) before the
+ * character to the next boundary after it, so that characters outside it are
+ * not changed by normalization. ASCII characters are all boundaries, so ASCII
+ * blocks are skipped a block at a time.
+ * Stores the start of the segment in *first (or end if there is none).
+ * Returns the end of the segment. */
+static const char* NormNextSegment(const char* cs, const char* const end,
+	const int form, const char** const first)
+{
+	const char* boundary = cs;
+	unsigned int last = 0;
+	size_t n;
+	while (cs < end) {
+		unsigned int r;
+#ifdef BLOCK_SIZE
+		if (end - cs >= BLOCK_SIZE &&
+			UTF8BlockIsAscii((const unsigned char*)cs))
+		{
+			cs += BLOCK_SIZE;
+			boundary = cs - 1;
+			last = 0;
+			continue;
+		}
+#endif
+		if ((unsigned char)*cs < 0x80) {
+			boundary = cs++;
+			last = 0;
+			continue;
+		}
+		r = NormRecord(StrIterDecode(cs, &n));
+		if (NormQuickCheck(r, form) == NORM_YES &&
+			(!normRecords[r].ccc || normRecords[r].ccc >= last))
+		{
+			if (!normRecords[r].ccc) boundary = cs;
+			last = normRecords[r].ccc;
+			cs += n;
+			continue;
+		}
+		for (cs += n; cs < end && (unsigned char)*cs >= 0x80; cs += n) {
+			r = NormRecord(StrIterDecode(cs, &n));
+			if (!normRecords[r].ccc && NormQuickCheck(r, form) == NORM_YES)
+				break;
+		}
+		*first = boundary;
+		return cs;
+	}
+	*first = end;
+	return end;
+}
 
-	const char* cs = &(s->arr[s->size]);
-	unsigned int c;
-	while (cs > s->arr && (c = UTF8Before(cs)) != -1) {
-		cs -= UTF8Size(c);
-		StrAddChar(t, c);
+/* Prærequisites: form is STR_NFC, STR_NFD, STR_NFKC or STR_NFKD.
+ * Stores the code points of the n bytes at cs, normalized to the form, in b
+ * (without their combining classes).
+ * Returns 1 if successful, otherwise 0. */
+static int NormSegment(struct NormBuffer* const b, const char* cs,
+	const size_t n, const int form)
+{
+	const char* const end = cs + n;
+	size_t k, i;
+	b->count = 0;
+	for (; cs < end; cs += k) {
+		if (!NormDecompose(b, StrIterDecode(cs, &k), form >= STR_NFKC))
+			return 0;
 	}
-	if (c == -1) { StrDel(t); return 0; }
-	return t;
+	if (!NormReorder(b)) return 0;
+	if (form == STR_NFC || form == STR_NFKC) NormCompose(b);
+	for (i = 0; i < b->count; ++i) b->cps[i] &= 0xffffff;
+	return 1;
 }
 
-/* Prærequisites: c is a valid Unicode code point && c > 0.
- * Adds Unicode character c to the end of Str s.
- * Returns 1 on success, otherwise 0. */
-int StrAddChar(Str* const s, const unsigned int c) {
-	const size_t charSize = UTF8Size(c);
-	if (!c || !charSize) return 0;
-	if (!StrResize(s, s->size + charSize))
-		return 0;
+/* Returns the high and low halves of the 128-bit product of a and b xored. */
+static uint64_t HashMix(const uint64_t a, const uint64_t b) {
+#ifdef __SIZEOF_INT128__
+	const unsigned __int128 r = (unsigned __int128)a * b;
+	return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+	const uint64_t ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+	const uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+	const uint64_t mid = (ll >> 32) + (uint32_t)hl + (uint32_t)lh;
+	return ((ll & 0xffffffff) | (mid << 32)) ^
+		(hh + (hl >> 32) + (lh >> 32) + (mid >> 32));
+#endif
+}
 
-	char* const end = &(s->arr[s->size-1]);
+static uint64_t HashRead64(const char* const p) {
+	uint64_t v;
+	memcpy(&v, p, 8);
+	return v;
+}
 
-	if (c < 0x80) {
-		end[0] = (char)c;
+static uint64_t HashRead32(const char* const p) {
+	uint32_t v;
+	memcpy(&v, p, 4);
+	return v;
+}
+
+/* Returns a 64-bit hash of the n bytes at cs with the given seed, which reads
+ * 16 to 48 bytes per round and mixes them with 128-bit multiplications (as
+ * wyhash does). It is not meant to resist deliberate collisions. */
+static uint64_t UTF8Hash(const char* cs, const size_t n, uint64_t seed) {
+	const uint64_t p0 = 0xa0761d6478bd642fULL, p1 = 0xe7037ed1a0b428dbULL;
+	const uint64_t p2 = 0x8ebc6af09c88c6e3ULL, p3 = 0x589965cc75374cc3ULL;
+	uint64_t a, b;
+	size_t i = n;
+	seed ^= HashMix(seed ^ p0, p1);
+	if (n <= 16) {
+		if (n >= 4) {
+			const size_t k = (n >> 3) << 2;
+			a = (HashRead32(cs) << 32) | HashRead32(cs + k);
+			b = (HashRead32(cs + n - 4) << 32) | HashRead32(cs + n - 4 - k);
+		}
+		else if (n) {
+			a = ((uint64_t)(unsigned char)cs[0] << 16) |
+				((uint64_t)(unsigned char)cs[n >> 1] << 8) |
+				(unsigned char)cs[n - 1];
+			b = 0;
+		}
+		else a = b = 0;
 	}
-	else if (c < 0x800) {
-		end[0] = (char)((c >> 6) | 0xc0);
-		end[1] = (char)((c & 0x3f) | 0x80);
+	else {
+		if (i > 48) {
+			uint64_t see1 = seed, see2 = seed;
+			do {
+				seed = HashMix(HashRead64(cs) ^ p1, HashRead64(cs + 8) ^ seed);
+				see1 = HashMix(HashRead64(cs + 16) ^ p2,
+					HashRead64(cs + 24) ^ see1);
+				see2 = HashMix(HashRead64(cs + 32) ^ p3,
+					HashRead64(cs + 40) ^ see2);
+				cs += 48;
+				i -= 48;
+			} while (i > 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16) {
+			seed = HashMix(HashRead64(cs) ^ p1, HashRead64(cs + 8) ^ seed);
+			cs += 16;
+			i -= 16;
+		}
+		a = HashRead64(cs + i - 16);
+		b = HashRead64(cs + i - 8);
 	}
-	else if (c < 0x10000) {
-		end[0] = (char)((c >> 12) | 0xe0);
-		end[1] = (char)(((c >> 6) & 0x3f) | 0x80);
-		end[2] = (char)((c & 0x3f) | 0x80);
+	return HashMix(p1 ^ n, HashMix(a ^ p1, b ^ seed) ^ p0);
+}
+
+/* Returns the size in bytes of the UTF-8 encoding of the n code points at cps,
+ * or 0 if any of them is 0 or not a valid Unicode character. */
+static size_t UTF8EncodedSize(const uint32_t* const cps, const size_t n) {
+	size_t i = 0, size = n;
+	int invalid = 0;
+#ifdef __SSE2__
+	/* SSE2 only compares signed integers, so compare with the sign bit
+	 * flipped, counting in 32-bit lanes for up to 2^28 blocks at a time */
+	const __m128i bias = _mm_set1_epi32((int)0x80000000u);
+	const __m128i max1 = _mm_set1_epi32((int)(0x7fu ^ 0x80000000u));
+	const __m128i max2 = _mm_set1_epi32((int)(0x7ffu ^ 0x80000000u));
+	const __m128i max3 = _mm_set1_epi32((int)(0xffffu ^ 0x80000000u));
+	const __m128i maxValid = _mm_set1_epi32((int)(0x10fffeu ^ 0x80000000u));
+	const __m128i one = _mm_set1_epi32(1);
+	__m128i bad = _mm_setzero_si128();
+	while (n - i >= 4) {
+		size_t blocks = (n - i) / 4 < (1 << 28) ? (n - i) / 4 : (1 << 28);
+		__m128i acc = _mm_setzero_si128();
+		uint32_t lanes[4];
+		while (blocks--) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)(cps + i));
+			const __m128i w = _mm_xor_si128(v, bias);
+			acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(w, max1));
+			acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(w, max2));
+			acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(w, max3));
+			bad = _mm_or_si128(bad, _mm_cmpgt_epi32(
+				_mm_xor_si128(_mm_sub_epi32(v, one), bias), maxValid));
+			i += 4;
+		}
+		_mm_storeu_si128((__m128i*)lanes, acc);
+		size += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
 	}
-	else if (c < 0x110000) {
-		end[0] = (char)((c >> 18) | 0xf0);
-		end[1] = (char)(((c >> 12) & 0x3f) | 0x80);
-		end[2] = (char)(((c >> 6) & 0x3f) | 0x80);
-		end[3] = (char)((c & 0x3f) | 0x80);
+	invalid = _mm_movemask_epi8(bad);
+#endif
+	for (; i < n; ++i) {
+		const uint32_t c = cps[i];
+		size += (c >= 0x80) + (c >= 0x800) + (c >= 0x10000);
+		invalid |= c - 1 >= 0x10ffff;
 	}
-	else return 0;
-
-	end[charSize] = 0;
-	s->length += 1;
-	s->size += charSize;
-	return 1;
+	return invalid ? 0 : size;
 }
 
-/* Prærequisites: cs is the start of a zero-terminated byte buffer containing
- * only valid UTF-8 encoded characters.
- * Adds UTF-8 encoded chars in cs to the end of s.
- * Returns 1 on success, otherwise 0. */
-int StrAddChars(Str* const s, const char* cs) {
-	while (*cs) {
-		const unsigned int c = UTF8At(cs);
-		if (c == -1) return 0;
-		StrAddChar(s, c);
-		cs += UTF8Size(c);
+/* Returns the offset of the first code unit of the n at cs that makes them
+ * invalid UTF-16: a zero, a lone surrogate, or a high surrogate that is not
+ * followed by a low one. Returns n if they are all valid. */
+static size_t UTF16Check(const uint16_t* const cs, const size_t n) {
+	size_t i;
+	for (i = 0; i < n; ++i) {
+		const uint16_t c = cs[i];
+		if (!c) return i;
+		if (c >= 0xd800 && c < 0xdc00) {
+			if (i + 1 == n || cs[i+1] < 0xdc00 || cs[i+1] >= 0xe000) return i;
+			++i;
+		}
+		else if (c >= 0xdc00 && c < 0xe000) return i;
 	}
-	return 1;
+	return n;
 }
 
-/* Adds the Str at t to the end of s.
- * Returns 1 on success, otherwise 0. */
+/* Returns the size in bytes of the UTF-8 encoding of the n UTF-16 code units at
+ * cs, or -1 if they are not valid UTF-16 (see UTF16Check), storing the offset
+ * of the first invalid code unit in *errOffset if errOffset is not 0.
+ * Surrogates count 2 bytes each, so a pair counts 4. */
+static size_t UTF16EncodedSize(const uint16_t* const cs, const size_t n,
+	size_t* const errOffset)
+{
+	size_t i = 0, size = n, err;
+	int check = 0;
+#ifdef __SSE2__
+	/* SSE2 only compares signed integers, so compare with the sign bit
+	 * flipped, counting in 16-bit lanes for up to 2^13 blocks at a time */
+	const __m128i bias = _mm_set1_epi16((short)0x8000);
+	const __m128i max1 = _mm_set1_epi16((short)(0x7f ^ 0x8000));
+	const __m128i max2 = _mm_set1_epi16((short)(0x7ff ^ 0x8000));
+	const __m128i surrogateMask = _mm_set1_epi16((short)0xf800);
+	const __m128i surrogate = _mm_set1_epi16((short)0xd800);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i ones = _mm_set1_epi16(1);
+	__m128i flags = zero;
+	while (n - i >= 8) {
+		size_t blocks = (n - i) / 8 < (1 << 13) ? (n - i) / 8 : (1 << 13);
+		__m128i acc = zero;
+		uint32_t lanes[4];
+		while (blocks--) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)(cs + i));
+			const __m128i w = _mm_xor_si128(v, bias);
+			const __m128i sur = _mm_cmpeq_epi16(
+				_mm_and_si128(v, surrogateMask), surrogate);
+			acc = _mm_sub_epi16(acc, _mm_cmpgt_epi16(w, max1));
+			acc = _mm_sub_epi16(acc, _mm_andnot_si128(sur, _mm_cmpgt_epi16(w, max2)));
+			flags = _mm_or_si128(flags,
+				_mm_or_si128(sur, _mm_cmpeq_epi16(v, zero)));
+			i += 8;
+		}
+		_mm_storeu_si128((__m128i*)lanes, _mm_madd_epi16(acc, ones));
+		size += (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+	check = _mm_movemask_epi8(flags);
+#endif
+	for (; i < n; ++i) {
+		const uint16_t c = cs[i];
+		const int sur = (c & 0xf800) == 0xd800;
+		size += (c >= 0x80) + (c >= 0x800 && !sur);
+		check |= sur | !c;
+	}
+	/* only zeros and surrogates need a closer look */
+	if (check && (err = UTF16Check(cs, n)) < n) {
+		if (errOffset) *errOffset = err;
+		return -1;
+	}
+	return size;
+}
+
+/* Returns the amount of bytes at or above 0x80 in the n bytes at cs, storing 1
+ * in *zero if any of them is zero. */
+static size_t Latin1CountHigh(const char* const cs, const size_t n,
+	int* const zero)
+{
+	size_t i = 0, count = 0;
+	*zero = 0;
+#ifdef __SSE2__
+	{
+		__m128i zeros = _mm_setzero_si128();
+		for (; i + 16 <= n; i += 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)(cs + i));
+			count += __builtin_popcount(_mm_movemask_epi8(v));
+			zeros = _mm_or_si128(zeros,
+				_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+		}
+		*zero = _mm_movemask_epi8(zeros) != 0;
+	}
+#endif
+	for (; i < n; ++i) {
+		count += (cs[i] & 0x80) != 0;
+		*zero |= !cs[i];
+	}
+	return count;
+}
+
+/* Flags for UTF8Check */
+#define UTF8_STRICT 1 /* reject surrogates (U+D800 to U+DFFF) */
+#define UTF8_NOZERO 2 /* reject zero bytes */
+
+#if defined(__SSSE3__) || defined(SSSE3_DISPATCH)
+/* Error bits of the lookup tables used by UTF8CheckBlocks */
+#define TOO_SHORT (1<<0)  /* lead byte not followed by a continuation byte */
+#define TOO_LONG (1<<1)   /* continuation byte not preceded by a lead byte */
+#define OVERLONG_3 (1<<2) /* 11100000 100xxxxx */
+#define TOO_LARGE (1<<3)  /* 11110100 1001xxxx, 11110100 101xxxxx etc. */
+#define SURROGATE (1<<4)  /* 11101101 101xxxxx */
+#define OVERLONG_2 (1<<5) /* 1100000x 10xxxxxx */
+#define TOO_LARGE_1000 (1<<6) /* 11110101 1000xxxx etc. */
+#define OVERLONG_4 (1<<6) /* 11110000 1000xxxx */
+#define TWO_CONTS (1<<7)  /* two continuation bytes in a row */
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+/* Validate the bytes from p in blocks of 16 using the lookup table algorithm of
+ * Keiser and Lemire ("Validating UTF-8 in less than one instruction per byte",
+ * 2021): each pair of adjacent bytes is classified with three 16-entry tables
+ * indexed by nibbles, and the results must agree with the positions at which
+ * a third or fourth continuation byte is required.
+ * Stops at the first block containing an error, or when fewer than 16 bytes
+ * remain, and returns a pointer to that block. The bytes before it are valid,
+ * except possibly for a character crossing into it. Adds the amount of
+ * characters that start before the returned block to *length. */
+static SSSE3_TARGET const unsigned char* UTF8CheckBlocks(const unsigned char* p,
+	const unsigned char* const end, const int flags, size_t* const length)
+{
+	const __m128i byte1High = _mm_setr_epi8(
+		TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+		TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+		TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+		TOO_SHORT | OVERLONG_2,
+		TOO_SHORT,
+		TOO_SHORT | OVERLONG_3 | SURROGATE,
+		TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+	const __m128i byte1Low = _mm_setr_epi8(
+		CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+		CARRY | OVERLONG_2,
+		CARRY,
+		CARRY,
+		CARRY | TOO_LARGE,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+		CARRY | TOO_LARGE | TOO_LARGE_1000,
+		CARRY | TOO_LARGE | TOO_LARGE_1000);
+	const __m128i byte2High = _mm_setr_epi8(
+		TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+		TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+		TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 |
+			OVERLONG_4,
+		TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+		TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+		TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+		TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+	const __m128i nibble = _mm_set1_epi8(0x0f);
+	const __m128i mask = _mm_set1_epi8(
+		(char)((flags & UTF8_STRICT) ? 0xff : ~SURROGATE));
+	/* the largest bytes that can end a block without starting a character
+	 * which continues into the next block */
+	const __m128i maxLast = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, (char)(0xf0-1), (char)(0xe0-1), (char)(0xc0-1));
+	const __m128i zero = _mm_setzero_si128();
+	__m128i prev = zero;
+
+	while (end - p >= 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)p);
+		__m128i err;
+
+		if (!_mm_movemask_epi8(v)) {
+			/* ASCII: only a character from the previous block can be cut off */
+			err = _mm_subs_epu8(prev, maxLast);
+		}
+		else {
+			const __m128i prev1 = _mm_alignr_epi8(v, prev, 15);
+			const __m128i special = _mm_and_si128(_mm_and_si128(
+				_mm_shuffle_epi8(byte1High,
+					_mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+				_mm_shuffle_epi8(byte1Low, _mm_and_si128(prev1, nibble))),
+				_mm_and_si128(_mm_shuffle_epi8(byte2High,
+					_mm_and_si128(_mm_srli_epi16(v, 4), nibble)), mask));
+			const __m128i third = _mm_subs_epu8(_mm_alignr_epi8(v, prev, 14),
+				_mm_set1_epi8((char)(0xe0-0x80)));
+			const __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(v, prev, 13),
+				_mm_set1_epi8((char)(0xf0-0x80)));
+			const __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth),
+				_mm_set1_epi8((char)0x80));
+			err = _mm_xor_si128(must23, special);
+		}
+		if (flags & UTF8_NOZERO)
+			err = _mm_or_si128(err, _mm_cmpeq_epi8(v, zero));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(err, zero)) != 0xffff)
+			break;
+
+		/* continuation bytes are those below -64 as signed bytes */
+		*length += 16 - __builtin_popcount(
+			_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(-64))));
+		prev = v;
+		p += 16;
+	}
+
+	return p;
+}
+
+#undef TOO_SHORT
+#undef TOO_LONG
+#undef OVERLONG_3
+#undef TOO_LARGE
+#undef SURROGATE
+#undef OVERLONG_2
+#undef TOO_LARGE_1000
+#undef OVERLONG_4
+#undef TWO_CONTS
+#undef CARRY
+
+/* Returns whether UTF8CheckBlocks can be used on the CPU running the code. */
+static int UTF8HasCheckBlocks(void) {
+#ifdef SSSE3_DISPATCH
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("ssse3");
+#else
+	return 1;
+#endif
+}
+#endif
+
+/* Check that the n bytes at cs are well-formed UTF-8, with further
+ * restrictions set by flags. Overlong encodings and code points above U+10FFFF
+ * are always rejected, as characters are stepped over using the size of their
+ * shortest encoding.
+ * Returns 1 and sets *length to the amount of characters if so; otherwise
+ * returns 0 and, if errOffset is not 0, sets *errOffset to the offset of the
+ * first byte that does not begin a valid character. */
+static int UTF8Check(const char* const cs, const size_t n, const int flags,
+	size_t* const length, size_t* const errOffset)
+{
+	const unsigned char* const start = (const unsigned char*)cs;
+	const unsigned char* const end = start + n;
+	const unsigned char* p = start;
+	size_t len = 0;
+
+#if defined(__SSSE3__) || defined(SSSE3_DISPATCH)
+	if (n >= 16 && UTF8HasCheckBlocks()) {
+		p = UTF8CheckBlocks(p, end, flags, &len);
+		/* the last character before p may be incomplete or continue into an
+		 * invalid block, so resume from its start (it has been counted
+		 * already) */
+		if (p > start) {
+			do { --p; } while (p > start && (*p & 0xc0) == 0x80);
+			--len;
+		}
+	}
+#endif
+
+	while (p < end) {
+		const unsigned char* blockEnd = end;
+#ifdef BLOCK_SIZE
+		if (end - p >= BLOCK_SIZE) {
+			if (UTF8BlockIsAscii(p)) {
+				p += BLOCK_SIZE;
+				len += BLOCK_SIZE;
+				continue;
+			}
+			blockEnd = p + BLOCK_SIZE;
+		}
+#endif
+		/* mixed block: step over one character at a time */
+		while (p < blockEnd) {
+			unsigned int c = *p;
+			size_t k, i;
+			if (c < 0x80) {
+				if (!c && (flags & UTF8_NOZERO)) goto fail;
+				++p; ++len;
+				continue;
+			}
+			if (c >= 0xc2 && c < 0xe0) { k = 1; c &= 0x1f; }
+			else if ((c & 0xf0) == 0xe0) { k = 2; c &= 0x0f; }
+			else if (c >= 0xf0 && c < 0xf5) { k = 3; c &= 0x07; }
+			else goto fail;
+			if ((size_t)(end - p) <= k) goto fail;
+			for (i = 1; i <= k; ++i) {
+				if ((p[i] & 0xc0) != 0x80) goto fail;
+				c = (c << 6) | (p[i] & 0x3f);
+			}
+			if (UTF8Size(c) != k + 1) goto fail;
+			if ((flags & UTF8_STRICT) && c >= 0xd800 && c < 0xe000) goto fail;
+			p += k + 1; ++len;
+		}
+	}
+
+	*length = len;
+	return 1;
+
+fail:
+	if (errOffset) *errOffset = p - start;
+	return 0;
+}
+
+static void* HeapAllocate(void* ctx, size_t n) { return malloc(n); }
+static void* HeapReallocate(void* ctx, void* p, size_t n, size_t m) {
+	return realloc(p, m);
+}
+static void HeapRelease(void* ctx, void* p) { free(p); }
+
+/* Allocator using malloc, realloc and free */
+static const StrAllocator heapAllocator =
+	{ HeapAllocate, HeapReallocate, 0, HeapRelease, 0 };
+
+/* Allocator given to new Strs that are not given one explicitly */
+static const StrAllocator* defaultAllocator = &heapAllocator;
+
+/* Allocate n bytes with alloc.
+ * Returns 0 if unable to allocate, otherwise a pointer to the bytes. */
+static void* StrAlloc(const StrAllocator* const alloc, const size_t n) {
+	return alloc->allocate(alloc->ctx, n);
+}
+
+/* Resize the block at p of size n, allocated with alloc, to size m, moving it
+ * if needed.
+ * Returns 0 if unable to resize, otherwise a pointer to the block. */
+static void* StrRealloc(const StrAllocator* const alloc, void* const p,
+	const size_t n, const size_t m)
+{
+	return alloc->reallocate(alloc->ctx, p, n, m);
+}
+
+/* Grow the block at p of size n, allocated with alloc, to size m without
+ * moving it. Returns 1 if successful, otherwise 0. */
+static int StrExtend(const StrAllocator* const alloc, void* const p,
+	const size_t n, const size_t m)
+{
+	return alloc->extend && alloc->extend(alloc->ctx, p, n, m);
+}
+
+/* Free the block at p, allocated with alloc. */
+static void StrFree(const StrAllocator* const alloc, void* const p) {
+	if (p) alloc->release(alloc->ctx, p);
+}
+
+/* Allocate n bytes from the arena a, starting a new chunk if the current one
+ * is full. Requests too large to share a chunk get a chunk of their own.
+ * Returns 0 if unable to allocate, otherwise a pointer to the bytes. */
+static void* ArenaAllocate(void* const ctx, size_t n) {
+	StrArena* const a = ctx;
+	struct StrArenaChunk* c = a->head;
+	if (n > SIZE_MAX - ARENA_HEADER - ARENA_ALIGN) return 0;
+	n = ARENA_ROUND(n);
+
+	if (!c || c->size - c->used < n) {
+		const size_t size = n > a->chunkSize / 4 ? n : a->chunkSize;
+		struct StrArenaChunk* const d = StrAlloc(a->parent, ARENA_HEADER + size);
+		if (!d) return 0;
+		d->size = size;
+		d->used = 0;
+		if (c && size != a->chunkSize) {
+			/* keep allocating from the current chunk */
+			d->used = n;
+			d->next = c->next;
+			c->next = d;
+			return ARENA_DATA(d);
+		}
+		d->next = c;
+		a->head = c = d;
+	}
+
+	a->last = ARENA_DATA(c) + c->used;
+	c->used += n;
+	return a->last;
+}
+
+/* If the block at p of size n in the arena a is its most recent allocation
+ * and there is room after it, extend it in place to size m and return 1;
+ * otherwise return 0. */
+static int ArenaExtend(void* const ctx, void* const p, const size_t n,
+	const size_t m)
+{
+	StrArena* const a = ctx;
+	struct StrArenaChunk* const c = a->head;
+	if (!c || p != a->last || m < n) return 0;
+	if (m > c->size - (a->last - ARENA_DATA(c))) return 0;
+	c->used = (a->last - ARENA_DATA(c)) + ARENA_ROUND(m);
+	return 1;
+}
+
+/* Resize the block at p of size n in the arena a to size m, in place if
+ * possible, otherwise by moving it. */
+static void* ArenaReallocate(void* const ctx, void* const p, const size_t n,
+	const size_t m)
+{
+	StrArena* const a = ctx;
+	void* q;
+	if (m <= n) {
+		/* shrink in place, returning the rest to the chunk if possible */
+		if (p == a->last)
+			a->head->used = (a->last - ARENA_DATA(a->head)) + ARENA_ROUND(m);
+		return p;
+	}
+	if (ArenaExtend(ctx, p, n, m)) return p;
+	q = ArenaAllocate(ctx, m);
+	if (q) memcpy(q, p, n < m ? n : m);
+	return q;
+}
+
+/* Blocks in arenas are only released when the arena is reset or deleted. */
+static void ArenaRelease(void* const ctx, void* const p) {}
+
+/* Returns 1 if the array of s is still the initial one, allocated along with
+ * s itself, otherwise 0. */
+static int StrIsInline(const Str* const s) {
+	return s->arr == (const char*)(s + 1);
+}
+
+/* Returns cap rounded up to whole pages if it is huge, so that the array can be
+ * grown (by realloc through mremap, with the default allocator) without
+ * copying, or 0 if that overflows. */
+static size_t StrRoundCap(const size_t cap) {
+	if (cap < HUGE_CAP) return cap;
+	if (cap > SIZE_MAX - (PAGE_SIZE - 1)) return 0;
+	return (cap + PAGE_SIZE - 1) & ~(size_t)(PAGE_SIZE - 1);
+}
+
+/* Drop a reference to the shared buffer b, freeing it if it was the last. */
+static void StrRelease(struct StrShared* const b) {
+	if (!__atomic_sub_fetch(&b->refs, 1, __ATOMIC_ACQ_REL))
+		StrFree(b->alloc, b);
+}
+
+/* Move the array of s to one of capacity cap >= s->size, which may be smaller
+ * than s->cap. A shared array is copied into one of its own.
+ * If unable to do so, return 0. Otherwise return s. */
+static Str* StrSetCap(Str* s, const size_t cap) {
+	char* arr;
+	if (s->shared) {
+		arr = StrAlloc(s->alloc, cap);
+		if (!arr) return 0;
+		memcpy(arr, s->arr, s->size);
+		StrRelease(s->shared);
+		s->shared = 0;
+	}
+	/* the initial array can only grow along with s, if the allocator can extend
+	 * blocks in place; otherwise move out of it */
+	else if (StrIsInline(s)) {
+		if (StrExtend(s->alloc, s, sizeof(*s) + s->cap, sizeof(*s) + cap)) {
+			s->cap = cap;
+			return s;
+		}
+		arr = StrAlloc(s->alloc, cap);
+		if (!arr) return 0;
+		memcpy(arr, s->arr, s->size);
+	}
+	else {
+		arr = StrRealloc(s->alloc, s->arr, s->cap, cap);
+		if (!arr) return 0;
+	}
+	s->arr = arr;
+	s->cap = cap;
+	return s;
+}
+
+/* Give s an array of its own, if it is shared, and forget its hash, before it
+ * is changed.
+ * Returns 1 on success, otherwise 0. */
+static int StrDetach(Str* const s) {
+	if (s->index) s->index->hashed = 0;
+	return !s->shared || StrSetCap(s, s->cap);
+}
+
+/* Grow the capacity of s, following its growth policy, until it is at least
+ * the target size. As s is about to be changed, a shared array is copied and
+ * the hash of s is forgotten.
+ * If unable to do so, return 0. Otherwise return s. */
+static Str* StrResize(Str* s, const size_t size) {
+	size_t cap = s->cap;
+	if (s->index) s->index->hashed = 0;
+	if (cap >= size) return s->shared ? StrSetCap(s, cap) : s;
+	if (s->growth == STR_GROW_EXACT) cap = size;
+	while (cap < size) {
+		if (s->growth == STR_GROW_HALF) {
+			if (cap > SIZE_MAX - cap/2 - 1) return 0;
+			cap += cap/2 ? cap/2 : 1;
+		}
+		else {
+			if (cap > SIZE_MAX/2) return 0;
+			cap *= 2;
+		}
+	}
+	cap = StrRoundCap(cap);
+	if (!cap) return 0;
+	return StrSetCap(s, cap);
+}
+
+/* Create lookup data from alloc, with room for cap index entries, of which
+ * only the first is set, and no hash.
+ * Returns 0 if unable to allocate, otherwise a pointer to it. */
+static struct StrIndex* StrIndexNew(const StrAllocator* const alloc,
+	const size_t cap)
+{
+	struct StrIndex* const idx =
+		StrAlloc(alloc, sizeof(*idx) + (cap - 1) * sizeof(size_t));
+	if (!idx) return 0;
+	idx->hashed = 0;
+	idx->count = 1;
+	idx->cap = cap;
+	idx->offsets[0] = 0;
+	return idx;
+}
+
+/* Extend the index of s (creating it if needed) until it has an entry beyond
+ * entry, or an entry for a character that starts beyond byte, or until it
+ * covers every character of s. If unable to allocate, the index is left
+ * as it was. */
+static void StrIndexExtend(Str* const s, const size_t entry,
+	const size_t byte)
+{
+	const char* const end = &(s->arr[s->size-1]);
+	struct StrIndex* idx = s->index;
+
+	if (!idx) {
+		idx = s->index = StrIndexNew(s->alloc, 16);
+		if (!idx) return;
+	}
+
+	while (idx->count <= entry && idx->offsets[idx->count-1] <= byte &&
+		idx->count * INDEX_STRIDE < s->length)
+	{
+		const char* cs = &(s->arr[idx->offsets[idx->count-1]]);
+		if (idx->count == idx->cap) {
+			struct StrIndex* const grown = StrRealloc(s->alloc, idx,
+				sizeof(*idx) + (idx->cap - 1) * sizeof(size_t),
+				sizeof(*idx) + (2 * idx->cap - 1) * sizeof(size_t));
+			if (!grown) return;
+			s->index = idx = grown;
+			idx->cap *= 2;
+		}
+		cs = UTF8Advance(cs, end, INDEX_STRIDE);
+		idx->offsets[idx->count++] = cs - s->arr;
+	}
+}
+
+/* Drop the entries of the index of s for characters at or beyond length.
+ * Must be called whenever characters of s before its end are changed. */
+static void StrIndexTruncate(Str* const s, const size_t length) {
+	size_t count = (length + INDEX_STRIDE - 1) / INDEX_STRIDE;
+	if (!s->index) return;
+	if (!count) count = 1;
+	if (count < s->index->count) s->index->count = count;
+}
+
+/* Prærequisites: index <= StrLength(s).
+ * Returns a pointer to the start of the index-th character of s (or its final
+ * zero, if index == StrLength(s)), using and extending the index of s. */
+static const char* StrCharPtr(const Str* const s, const size_t index) {
+	const char* const end = &(s->arr[s->size-1]);
+	const struct StrIndex* idx;
+	size_t entry;
+
+	/* only ASCII characters */
+	if (s->size - 1 == s->length) return &(s->arr[index]);
+	if (index < INDEX_STRIDE) return UTF8Advance(s->arr, end, index);
+	if (index == s->length) return end;
+
+	entry = index / INDEX_STRIDE;
+	StrIndexExtend((Str*)s, entry, -1);
+	idx = s->index;
+	if (!idx) return UTF8Advance(s->arr, end, index);
+	if (entry >= idx->count) entry = idx->count - 1;
+	return UTF8Advance(&(s->arr[idx->offsets[entry]]), end,
+		index - entry * INDEX_STRIDE);
+}
+
+/* Create a new Str using alloc (or the default allocator if alloc is 0) from n
+ * bytes at cs that are known to be valid and to contain length characters.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+static Str* StrNewUnchecked(const StrAllocator* const alloc,
+	const char* const cs, const size_t n, const size_t length)
+{
+	Str* s = StrNewSetCapWithAllocator(alloc, n < INIT_CAP ? INIT_CAP : n + 1);
+	if (!s) return 0;
+	memcpy(s->arr, cs, n);
+	s->arr[n] = 0;
+	s->length = length;
+	s->size = n + 1;
+	return s;
+}
+
+/* Creates and initializes a new Str with the byte array cs. cs can be set to 0
+ * or NULL to initialize an empty string.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+Str* StrNew(const char* const cs) {
+	return StrNewWithAllocator(0, cs);
+}
+
+/* Creates and initializes a new Str using alloc (or the default allocator if
+ * alloc is 0) with the n bytes at cs, checking them according to flags (see
+ * UTF8Check). The capacity is set so that the bytes fit without resizing.
+ * Returns 0 if unable to create or if the bytes are rejected, otherwise a
+ * pointer to the Str. */
+static Str* StrNewChecked(const StrAllocator* const alloc, const char* const cs,
+	const size_t n, const int flags)
+{
+	Str* s = StrNewSetCapWithAllocator(alloc, n < INIT_CAP ? INIT_CAP : n + 1);
+	if (!s) return 0;
+	if (!StrAddChecked(s, cs, n, flags)) {
+		StrDel(s);
+		return 0;
+	}
+	return s;
+}
+
+/* Creates and initializes a new Str with the n bytes at cs, which need not be
+ * zero-terminated. The capacity is set so that the bytes fit without resizing.
+ * Returns 0 if unable to create or if the bytes are not valid UTF-8 (see
+ * StrAddBytes), otherwise a pointer to the Str. */
+Str* StrNewFromBytes(const char* const cs, const size_t n) {
+	return StrNewChecked(0, cs, n, UTF8_NOZERO);
+}
+
+/* Like StrNew, but rejects surrogates (see StrAddBytesStrict). */
+Str* StrNewStrict(const char* const cs) {
+	if (!cs) return StrNewSetCap(INIT_CAP);
+	return StrNewChecked(0, cs, strlen(cs), UTF8_NOZERO | UTF8_STRICT);
+}
+
+/* Like StrNewFromBytes, but rejects surrogates (see StrAddBytesStrict). */
+Str* StrNewFromBytesStrict(const char* const cs, const size_t n) {
+	return StrNewChecked(0, cs, n, UTF8_NOZERO | UTF8_STRICT);
+}
+
+/* Creates and initializes a new Str with the n UTF-16 code units (in native
+ * byte order) at cs, converted to UTF-8. The size of the result is computed
+ * first, so that it is allocated once.
+ * Returns 0 if unable to create or if the code units are not valid UTF-16
+ * (including if they contain a zero or an unpaired surrogate), in which case
+ * the offset of the first invalid code unit is stored in *errOffset if
+ * errOffset is not 0; otherwise returns a pointer to the Str. */
+Str* StrNewFromUTF16(const uint16_t* const cs, const size_t n,
+	size_t* const errOffset)
+{
+	const size_t size = UTF16EncodedSize(cs, n, errOffset);
+	size_t i = 0, length = n;
+	char* out;
+	Str* s;
+	if (size == -1) return 0;
+	s = StrNewSetCap(size < INIT_CAP ? INIT_CAP : size + 1);
+	if (!s) return 0;
+
+	out = s->arr;
+	while (i < n) {
+#ifdef __SSE2__
+		if (n - i >= 8) {
+			/* a block of ASCII code units is narrowed at once; otherwise the
+			 * block is encoded one character at a time */
+			const __m128i v = _mm_loadu_si128((const __m128i*)(cs + i));
+			const size_t block = i + 8;
+			if (!_mm_movemask_epi8(_mm_cmpgt_epi16(
+				_mm_xor_si128(v, _mm_set1_epi16((short)0x8000)),
+				_mm_set1_epi16((short)(0x7f ^ 0x8000)))))
+			{
+				_mm_storel_epi64((__m128i*)out, _mm_packus_epi16(v, v));
+				out += 8;
+				i = block;
+				continue;
+			}
+			while (i < block) {
+				unsigned int c = cs[i++];
+				if (c >= 0xd800 && c < 0xdc00) {
+					c = 0x10000 + ((c - 0xd800) << 10) + (cs[i++] - 0xdc00);
+					--length;
+				}
+				out += UTF8Encode(c, out);
+			}
+			continue;
+		}
+#endif
+		{
+			unsigned int c = cs[i++];
+			if (c >= 0xd800 && c < 0xdc00) {
+				c = 0x10000 + ((c - 0xd800) << 10) + (cs[i++] - 0xdc00);
+				--length;
+			}
+			out += UTF8Encode(c, out);
+		}
+	}
+	*out = 0;
+	s->length = length;
+	s->size = size + 1;
+	return s;
+}
+
+/* Creates and initializes a new Str with the n ISO-8859-1 (Latin-1) bytes at
+ * cs, converted to UTF-8. The size of the result is computed first, so that it
+ * is allocated once.
+ * Returns 0 if unable to create or if the bytes contain a zero, in which case
+ * its offset is stored in *errOffset if errOffset is not 0; otherwise returns a
+ * pointer to the Str. */
+Str* StrNewFromLatin1(const char* const cs, const size_t n,
+	size_t* const errOffset)
+{
+	int zero;
+	const size_t size = n + Latin1CountHigh(cs, n, &zero);
+	size_t i = 0;
+	char* out;
+	Str* s;
+	if (zero) {
+		if (errOffset) *errOffset = (const char*)memchr(cs, 0, n) - cs;
+		return 0;
+	}
+	s = StrNewSetCap(size < INIT_CAP ? INIT_CAP : size + 1);
+	if (!s) return 0;
+
+	out = s->arr;
+	while (i < n) {
+#ifdef __SSE2__
+		if (n - i >= 16) {
+			/* a block of ASCII bytes is copied at once; otherwise the block is
+			 * encoded one character at a time */
+			const __m128i v = _mm_loadu_si128((const __m128i*)(cs + i));
+			const size_t block = i + 16;
+			if (!_mm_movemask_epi8(v)) {
+				_mm_storeu_si128((__m128i*)out, v);
+				out += 16;
+				i = block;
+				continue;
+			}
+			while (i < block) out += UTF8Encode((unsigned char)cs[i++], out);
+			continue;
+		}
+#endif
+		out += UTF8Encode((unsigned char)cs[i++], out);
+	}
+	*out = 0;
+	s->length = n;
+	s->size = size + 1;
+	return s;
+}
+
+/* Prærequisites: initCap > 0.
+ * Creates and initializes a new Str, with initial capacity set by initCap. The
+ * Str and its initial array are allocated together, as a single block.
+ * Returns 0 if unable to create, otherwise a pointer to the Str */
+Str* StrNewSetCap(const size_t initCap) {
+	return StrNewSetCapWithAllocator(0, initCap);
+}
+
+/* Free the memory underlying s and then s itself, using the allocator of s.
+ * For a Str in an arena this does nothing, as the memory is released along
+ * with the arena. */
+void StrDel(Str* const s) {
+	const StrAllocator* const alloc = s->alloc;
+	StrFree(alloc, s->index);
+	if (s->shared) StrRelease(s->shared);
+	else if (!StrIsInline(s)) StrFree(alloc, s->arr);
+	StrFree(alloc, s);
+}
+
+/* Set the allocator given to new Strs (and arenas) that are not given one
+ * explicitly, or restore the default (using malloc, realloc and free) if alloc
+ * is 0. The allocator must stay valid for as long as anything allocated with
+ * it is in use. Strs keep using the allocator they were created with. */
+void StrSetAllocator(const StrAllocator* const alloc) {
+	defaultAllocator = alloc ? alloc : &heapAllocator;
+}
+
+/* Returns the allocator given to new Strs that are not given one explicitly. */
+const StrAllocator* StrGetAllocator(void) { return defaultAllocator; }
+
+/* Prærequisites: initCap > 0.
+ * Like StrNewSetCap, but the Str and everything it allocates later use alloc
+ * (or the default allocator if alloc is 0). */
+Str* StrNewSetCapWithAllocator(const StrAllocator* alloc, const size_t initCap)
+{
+	if (!alloc) alloc = defaultAllocator;
+	if (!initCap || initCap > SIZE_MAX - sizeof(Str)) return 0;
+	Str* s = StrAlloc(alloc, sizeof(*s) + initCap);
+	if (!s) return 0;
+	s->length = 0;
+	s->size = 1;
+	s->cap = initCap;
+	s->index = 0;
+	s->alloc = alloc;
+	s->growth = STR_GROW_DOUBLE;
+	s->shared = 0;
+	s->arr = (char*)(s + 1);
+	s->arr[0] = 0;
+	return s;
+}
+
+/* Like StrNew, but the Str and everything it allocates later use alloc (or the
+ * default allocator if alloc is 0). */
+Str* StrNewWithAllocator(const StrAllocator* const alloc, const char* const cs)
+{
+	if (!cs) return StrNewSetCapWithAllocator(alloc, INIT_CAP);
+	return StrNewChecked(alloc, cs, strlen(cs), UTF8_NOZERO);
+}
+
+/* Creates a new, empty arena, which allocates memory for Strs (and anything
+ * else they need) from chunks of chunkSize bytes, or a default size if
+ * chunkSize is 0. The chunks are allocated with the default allocator. The
+ * memory is released all at once by StrArenaReset or StrArenaDel, so Strs in
+ * an arena do not need to be deleted one by one.
+ * Returns 0 if unable to create, otherwise a pointer to the arena. */
+StrArena* StrArenaNew(const size_t chunkSize) {
+	StrArena* const a = StrAlloc(defaultAllocator, sizeof(*a));
+	if (!a) return 0;
+	a->alloc.allocate = ArenaAllocate;
+	a->alloc.reallocate = ArenaReallocate;
+	a->alloc.extend = ArenaExtend;
+	a->alloc.release = ArenaRelease;
+	a->alloc.ctx = a;
+	a->parent = defaultAllocator;
+	a->head = 0;
+	a->chunkSize = chunkSize ? ARENA_ROUND(chunkSize) : ARENA_CHUNK_SIZE;
+	a->last = 0;
+	return a;
+}
+
+/* Release the memory of all Strs in the arena a, so that it can be reused.
+ * The Strs must not be used afterwards. One chunk is kept for reuse. */
+void StrArenaReset(StrArena* const a) {
+	struct StrArenaChunk* c = a->head;
+	if (!c) return;
+	while (c->next) {
+		struct StrArenaChunk* const next = c->next->next;
+		StrFree(a->parent, c->next);
+		c->next = next;
+	}
+	c->used = 0;
+	a->last = 0;
+}
+
+/* Release the memory of all Strs in the arena a, and then a itself. */
+void StrArenaDel(StrArena* const a) {
+	struct StrArenaChunk* c = a->head;
+	while (c) {
+		struct StrArenaChunk* const next = c->next;
+		StrFree(a->parent, c);
+		c = next;
+	}
+	StrFree(a->parent, a);
+}
+
+/* Returns the allocator of the arena a, which can be given to functions taking
+ * an allocator. */
+const StrAllocator* StrArenaAllocator(StrArena* const a) { return &a->alloc; }
+
+/* Prærequisites: initCap > 0.
+ * Like StrNewSetCap, but the Str is created in the arena a (or on the heap if
+ * a is 0). */
+Str* StrNewSetCapInArena(StrArena* const a, const size_t initCap) {
+	return StrNewSetCapWithAllocator(a ? &a->alloc : 0, initCap);
+}
+
+/* Like StrNew, but the Str is created in the arena a (or on the heap if a is
+ * 0). */
+Str* StrNewInArena(StrArena* const a, const char* const cs) {
+	return StrNewWithAllocator(a ? &a->alloc : 0, cs);
+}
+
+/* Like StrNewFromBytes, but the Str is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrNewFromBytesInArena(StrArena* const a, const char* const cs,
+	const size_t n)
+{
+	return StrNewChecked(a ? &a->alloc : 0, cs, n, UTF8_NOZERO);
+}
+
+/* Checks that the n bytes at cs are valid UTF-8 as in RFC 3629: no malformed,
+ * truncated or overlong sequences, no surrogates (U+D800 to U+DFFF) and no code
+ * points above U+10FFFF. Zero bytes are allowed.
+ * Returns 1 if valid; otherwise returns 0 and, if errOffset is not 0, sets
+ * *errOffset to the offset of the first byte that does not begin a valid
+ * character. */
+int StrValidate(const char* const cs, const size_t n, size_t* const errOffset) {
+	size_t length;
+	return UTF8Check(cs, n, UTF8_STRICT, &length, errOffset);
+}
+
+/* Returns 1 if s contains no characters, otherwise returns 0. */
+int StrIsNull(const Str* const s) { return s->length == 0; }
+
+/* Returns 1 if the strings s and t are equal, 0 otherwise. */
+int StrEqual(const Str* const s, const Str* const t) {
+	if (s->length != t->length || s->size != t->size)
+		return 0;
+	if (s->index && t->index && s->index->hashed && t->index->hashed &&
+		s->index->hashSeed == t->index->hashSeed &&
+		s->index->hash != t->index->hash) return 0;
+	/* as every Unicode string has a unique representation in terms of an array of
+	 * bytes, the following works */
+	return !memcmp(s->arr, t->arr, s->size);
+}
+
+/* Three-way comparison of s and t in code point order. If diffIndex is not 0,
+ * the index of the first character that differs is stored in it; if one string
+ * is a præfix of the other (or they are equal), that is the shorter length.
+ * Returns a negative value if s comes before t, 0 if they are equal, otherwise
+ * a positive value. */
+int StrCompare(const Str* const s, const Str* const t, size_t* const diffIndex)
+{
+	return UTF8Compare(s->arr, s->size - 1, t->arr, t->size - 1, diffIndex);
+}
+
+/* Reader of the case folded code points of valid UTF-8 */
+struct FoldReader {
+	const char* cs;
+	const char* end;
+	uint32_t pending[3]; /* Rest of the folding of the last character */
+	size_t next;
+	size_t count;
+};
+
+/* Returns the next case folded code point of r, or 0 at its end. */
+static unsigned int FoldNext(struct FoldReader* const r) {
+	unsigned int c;
+	size_t n;
+	if (r->next < r->count) return r->pending[r->next++];
+	if (r->cs == r->end) return 0;
+	c = StrIterDecode(r->cs, &n);
+	r->cs += n;
+	if (c < 0x80) return ASCIICaseMap(c, CASE_FOLD);
+	r->count = UnicodeCaseMap(c, CASE_FOLD, r->pending);
+	r->next = 1;
+	return r->pending[0];
+}
+
+#ifdef BLOCK_SIZE
+/* Returns 1 if the BLOCK_SIZE ASCII bytes at a and at b are equal when case
+ * folded, otherwise 0. */
+static int ASCIIBlockEqualFold(const char* const a, const char* const b) {
+	char x[BLOCK_SIZE], y[BLOCK_SIZE];
+	ASCIIBlockCaseMap(a, x, CASE_FOLD);
+	ASCIIBlockCaseMap(b, y, CASE_FOLD);
+	return !memcmp(x, y, BLOCK_SIZE);
+}
+#endif
+
+/* Compare the case folded characters of s and t (see StrCaseFold) by code
+ * point, without creating them. Runs of ASCII at the same place in both are
+ * compared a block at a time.
+ * Returns a negative value if s comes before t, 0 if they are equal when case
+ * folded, and a positive value if s comes after t. */
+int StrCompareFold(const Str* const s, const Str* const t) {
+	struct FoldReader r, q;
+	r.cs = s->arr;
+	r.end = s->arr + s->size - 1;
+	q.cs = t->arr;
+	q.end = t->arr + t->size - 1;
+	r.next = r.count = q.next = q.count = 0;
+	for (;;) {
+		unsigned int c, d;
+#ifdef BLOCK_SIZE
+		while (r.next == r.count && q.next == q.count &&
+			r.end - r.cs >= BLOCK_SIZE && q.end - q.cs >= BLOCK_SIZE &&
+			UTF8BlockIsAscii((const unsigned char*)r.cs) &&
+			UTF8BlockIsAscii((const unsigned char*)q.cs) &&
+			ASCIIBlockEqualFold(r.cs, q.cs))
+		{
+			r.cs += BLOCK_SIZE;
+			q.cs += BLOCK_SIZE;
+		}
+#endif
+		c = FoldNext(&r);
+		d = FoldNext(&q);
+		if (c != d) return c < d ? -1 : 1;
+		if (!c) return 0;
+	}
+}
+
+/* Returns 1 if s and t are equal when case folded (see StrCaseFold), otherwise
+ * 0. */
+int StrEqualFold(const Str* const s, const Str* const t) {
+	return s == t || !StrCompareFold(s, t);
+}
+
+/* Returns 1 if s is in the normalization form (STR_NFC, STR_NFD, STR_NFKC or
+ * STR_NFKD), otherwise 0 (also if form is not valid or unable to allocate).
+ * Only the segments found by NormNextSegment are normalized and compared. */
+int StrIsNormalized(const Str* const s, const int form) {
+	const char* const end = s->arr + s->size - 1;
+	const char* first;
+	const char* next;
+	struct NormBuffer b;
+	int normalized = 1;
+
+	if (form < STR_NFC || form > STR_NFKD) return 0;
+	next = NormNextSegment(s->arr, end, form, &first);
+	if (first == end) return 1;
+	NormBufferInit(&b);
+	while (normalized && first != end) {
+		const char* cs = first;
+		size_t i, n;
+		if (!NormSegment(&b, first, next - first, form)) normalized = 0;
+		for (i = 0; normalized && i < b.count; ++i, cs += n) {
+			normalized = cs < next && StrIterDecode(cs, &n) == b.cps[i];
+		}
+		normalized = normalized && cs == next;
+		next = NormNextSegment(next, end, form, &first);
+	}
+	NormBufferFree(&b);
+	return normalized;
+}
+
+/* Returns 1 if the string s has t as a præfix, 0 otherwise. */
+int StrStartsWith(const Str* const s, const Str* const t) {
+	if (t->length > s->length || t->size > s->size)
+		return 0;
+	/* a valid UTF-8 præfix in bytes is also a præfix in characters */
+	return !memcmp(s->arr, t->arr, t->size - 1);
+}
+
+/* Returns 1 if the string s has t as a postfix, 0 otherwise. */
+int StrEndsWith(const Str* const s, const Str* const t) {
+	if (t->length > s->length || t->size > s->size)
+		return 0;
+	return !memcmp(s->arr + s->size - t->size, t->arr, t->size - 1);
+}
+
+/* Returns a 64-bit hash of the characters of s with the given seed, which is
+ * cached along with the index of s until s is changed (or hashed with another
+ * seed), so only Strs which are hashed pay for the cache. Strs with cached
+ * hashes are compared by StrEqual faster when they differ. As the cache is
+ * written, like the index, s must not be used by several threads at once. */
+uint64_t StrHash(const Str* const s, const uint64_t seed) {
+	Str* const t = (Str*)s;
+	uint64_t h;
+	if (s->index && s->index->hashed && s->index->hashSeed == seed)
+		return s->index->hash;
+	h = UTF8Hash(s->arr, s->size - 1, seed);
+	/* if the lookup data cannot be allocated, the hash is not cached */
+	if (!t->index) t->index = StrIndexNew(s->alloc, 1);
+	if (t->index) {
+		t->index->hash = h;
+		t->index->hashSeed = seed;
+		t->index->hashed = 1;
+	}
+	return h;
+}
+
+/* Returns the amount of UTF-8 characters in s. */
+size_t StrLength(const Str* const s) { return s->length; }
+
+/* Returns the first index of the character c if found, otherwise returns -1. */
+size_t StrFindChar(const Str* const s, const unsigned int c) {
+	return UTF8FindChar(s->arr, s->size - 1, c);
+}
+
+/* Returns the amount of occurrences of the character c in s. */
+size_t StrCountChar(const Str* const s, const unsigned int c) {
+	return UTF8CountChar(s->arr, s->size - 1, c);
+}
+
+/* Decode the characters of s into the array out of cap code points, stopping
+ * early if it is full.
+ * Returns StrLength(s), the amount of code points needed to decode all of s. */
+size_t StrDecodeUTF32(const Str* const s, uint32_t* const out,
+	const size_t cap)
+{
+	const char* cs = s->arr;
+	const size_t n = cap < s->length ? cap : s->length;
+	size_t i = 0;
+	while (i < n) {
+#ifdef __SSE2__
+		if (n - i >= 16) {
+			/* a block of ASCII bytes is widened at once; otherwise the block is
+			 * decoded one character at a time */
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			const char* const block = cs + 16;
+			if (!_mm_movemask_epi8(v)) {
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i lo = _mm_unpacklo_epi8(v, zero);
+				const __m128i hi = _mm_unpackhi_epi8(v, zero);
+				_mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + i + 4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128((__m128i*)(out + i + 8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128((__m128i*)(out + i + 12), _mm_unpackhi_epi16(hi, zero));
+				i += 16;
+				cs = block;
+				continue;
+			}
+			while (cs < block && i < n) {
+				size_t k;
+				out[i++] = StrIterDecode(cs, &k);
+				cs += k;
+			}
+			continue;
+		}
+#endif
+		{
+			size_t k;
+			out[i++] = StrIterDecode(cs, &k);
+			cs += k;
+		}
+	}
+	return s->length;
+}
+
+/* Convert s to UTF-16 (in native byte order) in the array out of cap code
+ * units, stopping early (before a character that does not fit) if it is full.
+ * Returns the amount of code units needed to convert all of s, or -1 if s
+ * contains a surrogate code point, which cannot be represented in UTF-16, in
+ * which case its index is stored in *errOffset if errOffset is not 0 (and
+ * nothing is converted). */
+size_t StrToUTF16(const Str* const s, uint16_t* const out, const size_t cap,
+	size_t* const errOffset)
+{
+	const char* cs = s->arr;
+	const char* const end = &(s->arr[s->size-1]);
+	size_t i = 0, units = s->length;
+	int check = 0;
+	/* every 4-byte character needs a surrogate pair, and surrogate code points
+	 * start with the byte 0xed */
+#ifdef __SSE2__
+	{
+		const __m128i four = _mm_set1_epi8((char)0xf0);
+		const __m128i ed = _mm_set1_epi8((char)0xed);
+		__m128i flags = _mm_setzero_si128();
+		for (; end - cs >= 16; cs += 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			units += __builtin_popcount(_mm_movemask_epi8(
+				_mm_cmpeq_epi8(_mm_max_epu8(v, four), v)));
+			flags = _mm_or_si128(flags, _mm_cmpeq_epi8(v, ed));
+		}
+		check = _mm_movemask_epi8(flags);
+	}
+#endif
+	for (; cs < end; ++cs) {
+		units += (unsigned char)*cs >= 0xf0;
+		check |= (unsigned char)*cs == 0xed;
+	}
+	if (check) {
+		for (cs = s->arr; cs < end; ++cs) {
+			if ((unsigned char)cs[0] == 0xed && (unsigned char)cs[1] >= 0xa0) {
+				if (errOffset) *errOffset = UTF8CountChars(s->arr, cs - s->arr);
+				return -1;
+			}
+		}
+	}
+
+	cs = s->arr;
+	while (i < cap && cs < end) {
+#ifdef __SSE2__
+		if (cap - i >= 16 && end - cs >= 16) {
+			/* a block of ASCII bytes is widened at once; otherwise the block is
+			 * converted one character at a time */
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			const char* const block = cs + 16;
+			if (!_mm_movemask_epi8(v)) {
+				const __m128i zero = _mm_setzero_si128();
+				_mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi8(v, zero));
+				_mm_storeu_si128((__m128i*)(out + i + 8), _mm_unpackhi_epi8(v, zero));
+				i += 16;
+				cs = block;
+				continue;
+			}
+			while (cs < block && i < cap) {
+				size_t k;
+				const unsigned int c = StrIterDecode(cs, &k);
+				if (c >= 0x10000) {
+					if (cap - i < 2) return units;
+					out[i++] = (uint16_t)(0xd800 + ((c - 0x10000) >> 10));
+					out[i++] = (uint16_t)(0xdc00 + ((c - 0x10000) & 0x3ff));
+				}
+				else out[i++] = (uint16_t)c;
+				cs += k;
+			}
+			continue;
+		}
+#endif
+		{
+			size_t k;
+			const unsigned int c = StrIterDecode(cs, &k);
+			if (c >= 0x10000) {
+				if (cap - i < 2) return units;
+				out[i++] = (uint16_t)(0xd800 + ((c - 0x10000) >> 10));
+				out[i++] = (uint16_t)(0xdc00 + ((c - 0x10000) & 0x3ff));
+			}
+			else out[i++] = (uint16_t)c;
+			cs += k;
+		}
+	}
+	return units;
+}
+
+/* Convert s to ISO-8859-1 (Latin-1) in the array out of cap bytes, stopping
+ * early if it is full. The result is not zero-terminated.
+ * Returns StrLength(s), the amount of bytes needed to convert all of s, or -1
+ * if s contains a character above U+00FF, which cannot be represented in
+ * Latin-1, in which case its index is stored in *errOffset if errOffset is not
+ * 0 (and nothing is converted). */
+size_t StrToLatin1(const Str* const s, char* const out, const size_t cap,
+	size_t* const errOffset)
+{
+	const char* cs = s->arr;
+	const char* const end = &(s->arr[s->size-1]);
+	size_t i = 0;
+	/* characters above U+00FF start with a byte above 0xc3 */
+#ifdef __SSE2__
+	const __m128i c4 = _mm_set1_epi8((char)0xc4);
+	for (; end - cs >= 16; cs += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, c4), v))) break;
+	}
+#endif
+	for (; cs < end; ++cs) {
+		if ((unsigned char)*cs >= 0xc4) {
+			if (errOffset) *errOffset = UTF8CountChars(s->arr, cs - s->arr);
+			return -1;
+		}
+	}
+
+	if (s->size - 1 == s->length) {
+		memcpy(out, s->arr, cap < s->length ? cap : s->length);
+		return s->length;
+	}
+	cs = s->arr;
+	while (i < cap && cs < end) {
+#ifdef __SSE2__
+		if (cap - i >= 16 && end - cs >= 16) {
+			/* a block of ASCII bytes is copied at once; otherwise the block is
+			 * converted one character at a time */
+			const __m128i v = _mm_loadu_si128((const __m128i*)cs);
+			const char* const block = cs + 16;
+			if (!_mm_movemask_epi8(v)) {
+				_mm_storeu_si128((__m128i*)(out + i), v);
+				i += 16;
+				cs = block;
+				continue;
+			}
+			while (cs < block && i < cap) {
+				if (*cs & 0x80) {
+					out[i++] = (char)(((cs[0] & 0x1f) << 6) | (cs[1] & 0x3f));
+					cs += 2;
+				}
+				else out[i++] = *cs++;
+			}
+			continue;
+		}
+#endif
+		if (*cs & 0x80) {
+			out[i++] = (char)(((cs[0] & 0x1f) << 6) | (cs[1] & 0x3f));
+			cs += 2;
+		}
+		else out[i++] = *cs++;
+	}
+	return s->length;
+}
+
+/* Returns the index of the first occurrence of needle in s that starts at or
+ * after the index from, or -1 if there is none (or from > StrLength(s)). If
+ * found and byteOffset is not 0, the byte offset of the occurrence is stored
+ * in it. An empty needle is found at from. Takes linear time at worst. */
+size_t StrFind(const Str* const s, const Str* const needle, const size_t from,
+	size_t* const byteOffset)
+{
+	const char* start;
+	size_t i;
+	if (from > s->length) return -1;
+	start = StrCharPtr(s, from);
+	i = UTF8Find(start, s->arr + s->size - 1 - start, needle->arr,
+		needle->size - 1);
+	if (i == -1) return -1;
+	if (byteOffset) *byteOffset = start - s->arr + i;
+	return from + UTF8CountChars(start, i);
+}
+
+/* Returns the index of the last occurrence of needle in s that lies within the
+ * first end characters of s (or anywhere in s, if end >= StrLength(s)), or -1
+ * if there is none. If found and byteOffset is not 0, the byte offset of the
+ * occurrence is stored in it. Takes linear time at worst. */
+size_t StrFindLast(const Str* const s, const Str* const needle,
+	const size_t end, size_t* const byteOffset)
+{
+	const char* const stop = end < s->length ?
+		StrCharPtr(s, end) : &(s->arr[s->size-1]);
+	const size_t i = UTF8FindLast(s->arr, stop - s->arr, needle->arr,
+		needle->size - 1);
+	if (i == -1) return -1;
+	if (byteOffset) *byteOffset = i;
+	return StrByteToChar(s, i);
+}
+
+/* Prærequisites: index < StrLength(s).
+ * Returns the code point of the index-th (starting from 0) Unicode character of
+ * s if index is within range and valid UTF-8 character exists at that index,
+ * otherwise returns 0. */
+unsigned int StrAt(const Str* const s, const size_t index) {
+	if (index >= StrLength(s)) return 0;
+	const unsigned int c = UTF8At(StrCharPtr(s, index));
+	if (c == -1) return 0;
+	return c;
+}
+
+/* If index <= StrLength(s), returns the byte offset in s of the index-th
+ * (starting from 0) Unicode character of s, where index == StrLength(s) gives
+ * the offset of the final zero; otherwise returns -1. */
+size_t StrCharToByte(const Str* const s, const size_t index) {
+	if (index > s->length) return -1;
+	return StrCharPtr(s, index) - s->arr;
+}
+
+/* If offset < s->size, returns the index of the Unicode character of s which
+ * the byte at offset belongs to, where the final zero gives StrLength(s);
+ * otherwise returns -1. */
+size_t StrByteToChar(const Str* const s, const size_t offset) {
+	size_t entry = 0, start = 0;
+	if (offset >= s->size) return -1;
+	if (s->size - 1 == s->length) return offset;
+
+	/* short Strs are counted from the start, without an index */
+	if (s->length > INDEX_STRIDE) StrIndexExtend((Str*)s, -1, offset);
+	if (s->index) {
+		/* last entry at or before offset */
+		size_t lo = 0, hi = s->index->count;
+		while (hi - lo > 1) {
+			const size_t mid = lo + (hi - lo) / 2;
+			if (s->index->offsets[mid] <= offset) lo = mid;
+			else hi = mid;
+		}
+		entry = lo;
+		start = s->index->offsets[lo];
+	}
+
+	return entry * INDEX_STRIDE +
+		UTF8CountChars(&(s->arr[start]), offset + 1 - start) - 1;
+}
+
+/* Prærequisites: s is not null.
+ * Returns the code point of the first Unicode character of s, if it exists,
+ * otherwise returns 0. */
+unsigned int StrFirst(const Str* const s) {
+	if (StrIsNull(s)) return 0;
+	const unsigned int c = UTF8At(s->arr);
+	if (c == -1) return 0;
+	return c;
+}
+
+/* Prærequisites: s is not null.
+ * Returns the code point of the last Unicode character of s, if it exists,
+ * otherwise returns 0. */
+unsigned int StrLast(const Str* const s) {
+	if (StrIsNull(s)) return 0;
+	const unsigned int c = UTF8Before(&(s->arr[s->size]));
+	if (c == -1) return 0;
+	return c;
+}
+
+/* Create a new Str (in the arena a, or on the heap if a is 0) sharing the
+ * shared array of s from byte offset to its end, which holds length
+ * characters.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+static Str* StrNewSharing(StrArena* const a, const Str* const s,
+	const size_t offset, const size_t length)
+{
+	const StrAllocator* const alloc = a ? &a->alloc : defaultAllocator;
+	Str* const t = StrAlloc(alloc, sizeof(*t));
+	if (!t) return 0;
+	__atomic_add_fetch(&s->shared->refs, 1, __ATOMIC_RELAXED);
+	t->arr = s->arr + offset;
+	t->length = length;
+	t->size = s->size - offset;
+	t->cap = t->size;
+	t->index = 0;
+	t->alloc = alloc;
+	t->growth = STR_GROW_DOUBLE;
+	t->shared = s->shared;
+	return t;
+}
+
+/* Returns whether a copy of s in the arena a (or on the heap if a is 0) can
+ * share the array of s: only if it is shared, and by the same allocator, as
+ * Strs in an arena are never deleted and the arena may be freed first. */
+static int StrCanShare(const StrArena* const a, const Str* const s) {
+	return s->shared && s->shared->alloc == (a ? &a->alloc : defaultAllocator);
+}
+
+/* Create a copy of s and return it. 
+ * Returns 0 if unsuccessful, otherwise a pointer to the copy of s. */
+Str* StrCopy(const Str* const s) { return StrCopyInArena(0, s); }
+
+/* Like StrCopy, but the copy is created in the arena a (or on the heap if a is
+ * 0). */
+Str* StrCopyInArena(StrArena* const a, const Str* const s) {
+	const int share = StrCanShare(a, s);
+	Str* const t = share ? StrNewSharing(a, s, 0, s->length) :
+		StrNewSetCapInArena(a, s->size < INIT_CAP ? INIT_CAP : s->size);
+	if (!t) return 0;
+	if (!share) {
+		memcpy(t->arr, s->arr, s->size);
+		t->length = s->length;
+		t->size = s->size;
+	}
+	return t;
+}
+
+/* Create a new Str containing a slice of s from indices first to last (not
+ * inclusive), i.e.:
+ *   if first <= last <= StrLength(s), the substring s[first..last);
+ *   otherwise, if first > last or first > StrLength(s), the empty string.
+ *   otherwise, the substring s[first..StrLength(s));
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * slice. */
+Str* StrSlice(const Str* const s, const size_t first, const size_t last) {
+	return StrSliceInArena(0, s, first, last);
+}
+
+/* Like StrSlice, but the slice is created in the arena a (or on the heap if a
+ * is 0). */
+Str* StrSliceInArena(StrArena* const a, const Str* const s, const size_t first,
+	const size_t last)
+{
+	/* a slice up to the end of a shared array can share it too */
+	if (StrCanShare(a, s) && first < s->length && first <= last &&
+		last >= s->length)
+		return StrNewSharing(a, s, StrCharPtr(s, first) - s->arr,
+			s->length - first);
+	return StrNewFromViewInArena(a, StrViewSlice(s, first, last));
+}
+
+/* Create a new Str: if n < StrLength(s), the præfix of s of length n;
+ * otherwise, a copy of s. 
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * præfix. */
+Str* StrTake(const Str* const s, const size_t n) {
+	return StrTakeInArena(0, s, n);
+}
+
+/* Like StrTake, but the præfix is created in the arena a (or on the heap if a
+ * is 0). */
+Str* StrTakeInArena(StrArena* const a, const Str* const s, const size_t n) {
+	if (n < s->length) return StrSliceInArena(a, s, 0, n);
+	else return StrCopyInArena(a, s);
+}
+
+/* Create a new Str: if n < StrLength(s), the postfix of s of length n;
+ * otherwise, an empty string.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * postfix. */
+Str* StrDrop(const Str* const s, const size_t n) {
+	return StrDropInArena(0, s, n);
+}
+
+/* Like StrDrop, but the postfix is created in the arena a (or on the heap if a
+ * is 0). */
+Str* StrDropInArena(StrArena* const a, const Str* const s, const size_t n) {
+	if (n < s->length) return StrSliceInArena(a, s, n, s->length);
+	else return StrNewInArena(a, 0);
+}
+
+/* Create a new Str that returns the longest præfix of s such that for each
+ * Unicode character c in the præfix, p(c) != 0.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * præfix. */
+Str* StrTakeWhile(const Str* const s, int (*p)(unsigned int)) {
+	return StrTakeWhileInArena(0, s, p);
+}
+
+/* Like StrTakeWhile, but the præfix is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrTakeWhileInArena(StrArena* const a, const Str* const s,
+	int (*p)(unsigned int))
+{
+	return StrNewFromViewInArena(a, StrViewTakeWhile(s, p));
+}
+
+/* Create a new Str that returns the longest præfix of s such that for each
+ * Unicode character c in the præfix, p(c) != 0.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * præfix. */
+Str* StrDropWhile(const Str* const s, int (*p)(unsigned int)) {
+	return StrDropWhileInArena(0, s, p);
+}
+
+/* Like StrDropWhile, but the postfix is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrDropWhileInArena(StrArena* const a, const Str* const s,
+	int (*p)(unsigned int))
+{
+	return StrNewFromViewInArena(a, StrViewDropWhile(s, p));
+}
+
+/* Create a new Str which has the reverse of the characters of s.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str containing the
+ * reverse. */
+Str* StrReverse(const Str* const s) { return StrReverseInArena(0, s); }
+
+/* Like StrReverse, but the reverse is created in the arena a (or on the heap if
+ * a is 0). */
+Str* StrReverseInArena(StrArena* const a, const Str* const s) {
+	Str* t = StrNewSetCapInArena(a, s->size < INIT_CAP ? INIT_CAP : s->size);
+	if (!t) return 0;
+
+	const char* cs = &(s->arr[s->size-1]);
+	char* ds = t->arr;
+	while (cs > s->arr) {
+		const unsigned int c = UTF8Before(cs);
+		const size_t size = UTF8Size(c);
+		if (c == -1 || !size) { StrDel(t); return 0; }
+		cs -= size;
+		memcpy(ds, cs, size);
+		ds += size;
+	}
+	*ds = 0;
+	t->length = s->length;
+	t->size = s->size;
+	return t;
+}
+
+/* Returns a new Str with every non-overlapping occurrence of from in s, from
+ * left to right, replaced with to. An empty from matches nothing.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+Str* StrReplaceAll(const Str* const s, const Str* const from,
+	const Str* const to)
+{
+	return StrReplaceAllInArena(0, s, from, to);
+}
+
+/* Like StrReplaceAll, but the result is created in the arena a (or on the heap
+ * if a is 0). The occurrences are all found first, so the result is allocated
+ * once at its exact size and assembled with one copy per run of bytes. */
+Str* StrReplaceAllInArena(StrArena* const a, const Str* const s,
+	const Str* const from, const Str* const to)
+{
+	const size_t m = from->size - 1, tn = to->size - 1;
+	size_t local[64];
+	size_t* offsets = local;
+	size_t count = 0, size, i, prev = 0;
+	Str* t;
+	char* ds;
+
+	if (m) count = UTF8FindAll(defaultAllocator, s->arr, s->size - 1,
+		from->arr, m, &offsets, sizeof(local) / sizeof(local[0]));
+	if (count == -1 || (tn > m && count > (SIZE_MAX - s->size) / (tn - m)))
+		t = 0;
+	else {
+		size = s->size - count * m + count * tn;
+		t = StrNewSetCapInArena(a, size < INIT_CAP ? INIT_CAP : size);
+	}
+	if (!t) {
+		if (offsets != local) StrFree(defaultAllocator, offsets);
+		return 0;
+	}
+
+	ds = t->arr;
+	for (i = 0; i < count; ++i) {
+		memcpy(ds, s->arr + prev, offsets[i] - prev);
+		ds += offsets[i] - prev;
+		memcpy(ds, to->arr, tn);
+		ds += tn;
+		prev = offsets[i] + m;
+	}
+	memcpy(ds, s->arr + prev, s->size - prev);
+	t->size = size;
+	t->length = s->length - count * from->length + count * to->length;
+	if (offsets != local) StrFree(defaultAllocator, offsets);
+	return t;
+}
+
+/* Create a new Str in the arena a (or on the heap if a is 0) with the
+ * characters of s mapped like UnicodeCaseMap. The size of the result is found
+ * first, so it is allocated once. ASCII blocks are mapped a block at a time.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+static Str* StrCaseMapInArena(StrArena* const a, const Str* const s,
+	const int kind)
+{
+	const char* const end = s->arr + s->size - 1;
+	const char* cs;
+	size_t size = 0, length = 0, n, k, i;
+	uint32_t m[3];
+	char* ds;
+	Str* t;
+
+	for (cs = s->arr; cs < end; cs += n) {
+		unsigned int c;
+#ifdef BLOCK_SIZE
+		if (end - cs >= BLOCK_SIZE &&
+			UTF8BlockIsAscii((const unsigned char*)cs))
+		{
+			n = BLOCK_SIZE;
+			size += n;
+			length += n;
+			continue;
+		}
+#endif
+		c = StrIterDecode(cs, &n);
+		if (c < 0x80) {
+			++size;
+			++length;
+			continue;
+		}
+		k = UnicodeCaseMap(c, kind, m);
+		for (i = 0; i < k; ++i) size += UTF8Size(m[i]);
+		length += k;
+	}
+
+	t = StrNewSetCapInArena(a, size < INIT_CAP ? INIT_CAP : size + 1);
+	if (!t) return 0;
+	ds = t->arr;
+	for (cs = s->arr; cs < end; cs += n) {
+		unsigned int c;
+#ifdef BLOCK_SIZE
+		if (end - cs >= BLOCK_SIZE &&
+			UTF8BlockIsAscii((const unsigned char*)cs))
+		{
+			ASCIIBlockCaseMap(cs, ds, kind);
+			n = BLOCK_SIZE;
+			ds += n;
+			continue;
+		}
+#endif
+		c = StrIterDecode(cs, &n);
+		if (c < 0x80) {
+			*ds++ = ASCIICaseMap(c, kind);
+			continue;
+		}
+		k = UnicodeCaseMap(c, kind, m);
+		for (i = 0; i < k; ++i) ds += UTF8Encode(m[i], ds);
+	}
+	*ds = 0;
+	t->size = size + 1;
+	t->length = length;
+	return t;
+}
+
+/* Returns a new Str with the characters of s in lower case, using the full
+ * (possibly longer) mappings of Unicode, but not ones depending on context
+ * or language, such as that of final sigma.
+ * Returns 0 if unable to create, otherwise a pointer to the Str. */
+Str* StrToLower(const Str* const s) {
+	return StrCaseMapInArena(0, s, CASE_LOWER);
+}
+
+/* Like StrToLower, but in upper case (so that "ß" becomes "SS"). */
+Str* StrToUpper(const Str* const s) {
+	return StrCaseMapInArena(0, s, CASE_UPPER);
+}
+
+/* Like StrToLower, but case folded: mapped so that strings which differ only
+ * in case become equal (so that "ß" and "SS" both become "ss"). */
+Str* StrCaseFold(const Str* const s) {
+	return StrCaseMapInArena(0, s, CASE_FOLD);
+}
+
+/* Like StrToLower, but the result is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrToLowerInArena(StrArena* const a, const Str* const s) {
+	return StrCaseMapInArena(a, s, CASE_LOWER);
+}
+
+/* Like StrToUpper, but the result is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrToUpperInArena(StrArena* const a, const Str* const s) {
+	return StrCaseMapInArena(a, s, CASE_UPPER);
+}
+
+/* Like StrCaseFold, but the result is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrCaseFoldInArena(StrArena* const a, const Str* const s) {
+	return StrCaseMapInArena(a, s, CASE_FOLD);
+}
+
+/* Create a new Str in the arena a (or on the heap if a is 0) with the
+ * characters of s in the normalization form (STR_NFC, STR_NFD, STR_NFKC or
+ * STR_NFKD). Only the segments found by NormNextSegment are decomposed,
+ * reordered and (for NFC and NFKC) composed; the runs between them are copied
+ * as they are (without checking them again), and if there are none, s is
+ * copied with StrCopyInArena.
+ * Returns 0 if unable to create or form is not valid, otherwise a pointer to
+ * the Str. */
+Str* StrNormalizeInArena(StrArena* const a, const Str* const s, const int form)
+{
+	const char* const end = s->arr + s->size - 1;
+	const char* cs = s->arr;
+	const char* first;
+	const char* next;
+	struct NormBuffer b;
+	Str* t;
+
+	if (form < STR_NFC || form > STR_NFKD) return 0;
+	next = NormNextSegment(cs, end, form, &first);
+	if (first == end) return StrCopyInArena(a, s);
+	t = StrNewSetCapInArena(a, s->size < INIT_CAP ? INIT_CAP : s->size);
+	if (!t) return 0;
+
+	NormBufferInit(&b);
+	while (first != end) {
+		if (!StrAddUnchecked(t, cs, first - cs,
+				UTF8CountChars(cs, first - cs)) ||
+			!NormSegment(&b, first, next - first, form) ||
+			!StrAddCodepoints(t, b.cps, b.count))
+		{
+			NormBufferFree(&b);
+			StrDel(t);
+			return 0;
+		}
+		cs = next;
+		next = NormNextSegment(cs, end, form, &first);
+	}
+	NormBufferFree(&b);
+	if (!StrAddUnchecked(t, cs, end - cs, UTF8CountChars(cs, end - cs))) {
+		StrDel(t);
+		return 0;
+	}
+	return t;
+}
+
+/* Returns a new Str with the characters of s in the normalization form
+ * STR_NFC (canonical composition), STR_NFD (canonical decomposition),
+ * STR_NFKC (compatibility composition) or STR_NFKD (compatibility
+ * decomposition), so that canonically equivalent Strs (or compatibly
+ * equivalent ones, for NFKC and NFKD) become equal. Text which is already
+ * normalized, such as ASCII, is skipped at little more than the cost of
+ * copying it.
+ * Returns 0 if unable to create or form is not valid, otherwise a pointer to
+ * the Str. */
+Str* StrNormalize(const Str* const s, const int form) {
+	return StrNormalizeInArena(0, s, form);
+}
+
+/* Prærequisites: c is a valid Unicode code point && c > 0.
+ * Adds Unicode character c to the end of Str s.
+ * Returns 1 on success, otherwise 0. */
+int StrAddChar(Str* const s, const unsigned int c) {
+	const size_t charSize = UTF8Size(c);
+	if (!c || !charSize) return 0;
+	if (!StrResize(s, s->size + charSize))
+		return 0;
+
+	char* const end = &(s->arr[s->size-1]);
+	UTF8Encode(c, end);
+	end[charSize] = 0;
+	s->length += 1;
+	s->size += charSize;
+	return 1;
+}
+
+/* Prærequisites: cs is the start of a zero-terminated byte buffer.
+ * Adds UTF-8 encoded chars in cs to the end of s.
+ * Returns 1 on success, otherwise 0 (see StrAddBytes). */
+int StrAddChars(Str* const s, const char* cs) {
+	return StrAddBytes(s, cs, strlen(cs));
+}
+
+/* Adds the n bytes at cs to the end of s, checking them according to flags
+ * (see UTF8Check). On failure s is left unchanged.
+ * Returns 1 on success, otherwise 0. */
+/* Adds the n bytes at cs, which are known to be valid and to contain length
+ * characters, to the end of s.
+ * Returns 1 on success, otherwise 0. */
+static int StrAddUnchecked(Str* const s, const char* const cs, const size_t n,
+	const size_t length)
+{
+	if (!n) return 1;
+	if (!StrResize(s, s->size + n)) return 0;
+
+	memcpy(&(s->arr[s->size-1]), cs, n);
+	s->length += length;
+	s->size += n;
+	s->arr[s->size-1] = 0;
+	return 1;
+}
+
+static int StrAddChecked(Str* const s, const char* const cs, const size_t n,
+	const int flags)
+{
+	size_t length;
+	if (!n) return 1;
+	if (!UTF8Check(cs, n, flags, &length, 0)) return 0;
+	if (!StrResize(s, s->size + n)) return 0;
+
+	memcpy(&(s->arr[s->size-1]), cs, n);
+	s->length += length;
+	s->size += n;
+	s->arr[s->size-1] = 0;
+	return 1;
+}
+
+/* Adds the n UTF-8 encoded bytes at cs to the end of s. cs need not be
+ * zero-terminated. The bytes are validated and counted before anything is
+ * added, so on failure s is left unchanged.
+ * Returns 1 on success, otherwise 0 (including if the bytes contain a zero
+ * byte, a malformed or overlong sequence or a code point above U+10FFFF). */
+int StrAddBytes(Str* const s, const char* const cs, const size_t n) {
+	return StrAddChecked(s, cs, n, UTF8_NOZERO);
+}
+
+/* Like StrAddBytes, but the bytes must also be valid UTF-8 as in RFC 3629,
+ * i.e. they must not encode surrogates (U+D800 to U+DFFF).
+ * Returns 1 on success, otherwise 0. */
+int StrAddBytesStrict(Str* const s, const char* const cs, const size_t n) {
+	return StrAddChecked(s, cs, n, UTF8_NOZERO | UTF8_STRICT);
+}
+
+/* Prærequisites: cs is the start of a zero-terminated byte buffer.
+ * Like StrAddChars, but rejects surrogates (see StrAddBytesStrict). */
+int StrAddCharsStrict(Str* const s, const char* cs) {
+	return StrAddBytesStrict(s, cs, strlen(cs));
+}
+
+/* Adds the Str at t to the end of s.
+ * Returns 1 on success, otherwise 0. */
 int StrAdd(Str* const s, const Str* const t) {
 	if (!StrResize(s, s->size - 1 + t->size))
 		return 0;
 
-	memcpy(&(s->arr[s->size-1]), t->arr, t->size);
-	s->length += t->length;
-	s->size += t->size - 1;
-	
+	/* t may be s itself, whose final zero is overwritten first */
+	memcpy(&(s->arr[s->size-1]), t->arr, t->size - 1);
+	s->length += t->length;
+	s->size += t->size - 1;
+	s->arr[s->size-1] = 0;
+	
+	return 1;
+}
+
+/* Adds the n Unicode characters at cps to the end of s. They are all checked,
+ * and s is resized once, before anything is added, so on failure s is left
+ * unchanged.
+ * Returns 1 on success, otherwise 0 (including if any of the code points is 0
+ * or above U+10FFFF). */
+int StrAddCodepoints(Str* const s, const uint32_t* const cps, const size_t n) {
+	size_t size, i = 0;
+	char* cs;
+	if (!n) return 1;
+	size = UTF8EncodedSize(cps, n);
+	if (!size || !StrResize(s, s->size + size)) return 0;
+
+	cs = &(s->arr[s->size-1]);
+	while (i < n) {
+#ifdef __SSE2__
+		if (n - i >= 8) {
+			/* a block of ASCII code points is narrowed at once (they are all
+			 * valid, so the signed comparisons work); otherwise the block is
+			 * encoded one character at a time */
+			const __m128i ascii = _mm_set1_epi32(0x7f);
+			const __m128i a = _mm_loadu_si128((const __m128i*)(cps + i));
+			const __m128i b = _mm_loadu_si128((const __m128i*)(cps + i + 4));
+			const size_t block = i + 8;
+			if (!_mm_movemask_epi8(_mm_or_si128(
+				_mm_cmpgt_epi32(a, ascii), _mm_cmpgt_epi32(b, ascii))))
+			{
+				const __m128i v = _mm_packs_epi32(a, b);
+				_mm_storel_epi64((__m128i*)cs, _mm_packus_epi16(v, v));
+				cs += 8;
+				i = block;
+				continue;
+			}
+			while (i < block) cs += UTF8Encode(cps[i++], cs);
+			continue;
+		}
+#endif
+		cs += UTF8Encode(cps[i++], cs);
+	}
+	*cs = 0;
+	s->length += n;
+	s->size += size;
+	return 1;
+}
+
+/* Replace the characters of s from index first to last (not inclusive) with
+ * the n bytes at cs, which are valid UTF-8 containing length characters. cs
+ * may point into s.
+ * Prærequisites: first <= last <= StrLength(s).
+ * Returns 1 on success, otherwise 0 (leaving s unchanged). */
+static int StrReplaceBytes(Str* const s, const size_t first, const size_t last,
+	const char* cs, const size_t n, const size_t length)
+{
+	const size_t from = StrCharPtr(s, first) - s->arr;
+	/* short ranges are scanned, rather than looked up again */
+	const size_t to = (last - first < INDEX_STRIDE ?
+		UTF8Advance(s->arr + from, &(s->arr[s->size-1]), last - first) :
+		StrCharPtr(s, last)) - s->arr;
+	char* copy = 0;
+
+	/* bytes of s would move under cs, so replace with a copy of them */
+	if (cs >= s->arr && cs < s->arr + s->size) {
+		copy = StrAlloc(s->alloc, n ? n : 1);
+		if (!copy) return 0;
+		memcpy(copy, cs, n);
+		cs = copy;
+	}
+	if (!StrDetach(s) ||
+		(n > to - from && !StrResize(s, s->size + n - (to - from))))
+	{
+		StrFree(s->alloc, copy);
+		return 0;
+	}
+
+	memmove(&(s->arr[from + n]), &(s->arr[to]), s->size - to);
+	memcpy(&(s->arr[from]), cs, n);
+	s->size = s->size - (to - from) + n;
+	s->length = s->length - (last - first) + length;
+	StrIndexTruncate(s, first);
+	StrFree(s->alloc, copy);
+	return 1;
+}
+
+/* Replace the characters of s from index first to last (not inclusive) with
+ * the characters of t (which may be s itself), where last is clamped to
+ * StrLength(s). The byte offsets come from the index of s, and the bytes after
+ * the range are moved once, resizing s at most once.
+ * Returns 1 on success, otherwise 0 (including if first > last), in which
+ * case s is left unchanged. */
+int StrReplaceRange(Str* const s, const size_t first, size_t last,
+	const Str* const t)
+{
+	if (last > s->length) last = s->length;
+	if (first > last) return 0;
+	return StrReplaceBytes(s, first, last, t->arr, t->size - 1, t->length);
+}
+
+/* Replace every non-overlapping occurrence of from in s, from left to right,
+ * with to (either of which may be s itself), like StrReplaceAll. The bytes of
+ * s are moved in a single pass, after resizing s at most once.
+ * Returns 1 on success, otherwise 0, in which case s is left unchanged. */
+int StrReplaceAllInPlace(Str* const s, const Str* const from,
+	const Str* const to)
+{
+	const size_t m = from->size - 1, tn = to->size - 1;
+	const size_t oldSize = s->size;
+	size_t local[64];
+	size_t* offsets = local;
+	size_t count, first, size, i;
+	const char* cs = to->arr;
+	char* copy = 0;
+	int ok = 0;
+
+	if (!m) return 1;
+	count = UTF8FindAll(s->alloc, s->arr, s->size - 1, from->arr, m, &offsets,
+		sizeof(local) / sizeof(local[0]));
+	if (count == -1) return 0;
+	if (!count) return 1;
+	if (tn > m && count > (SIZE_MAX - s->size) / (tn - m)) goto done;
+	size = s->size - count * m + count * tn;
+	first = StrByteToChar(s, offsets[0]);
+
+	/* bytes of s would move under to, so replace with a copy of them */
+	if (to == s) {
+		copy = StrAlloc(s->alloc, tn ? tn : 1);
+		if (!copy) goto done;
+		memcpy(copy, to->arr, tn);
+		cs = copy;
+	}
+	if (!StrDetach(s)) goto done;
+	if (tn > m) {
+		/* growing: fill in from the end, so nothing is overwritten unread */
+		size_t src = oldSize, dst;
+		if (!StrResize(s, size)) goto done;
+		dst = size;
+		for (i = count; i-- > 0;) {
+			const size_t tail = src - (offsets[i] + m);
+			dst -= tail;
+			memmove(&(s->arr[dst]), &(s->arr[offsets[i] + m]), tail);
+			dst -= tn;
+			memcpy(&(s->arr[dst]), cs, tn);
+			src = offsets[i];
+		}
+	} else {
+		size_t dst = offsets[0];
+		for (i = 0; i < count; ++i) {
+			const size_t next = i + 1 < count ? offsets[i+1] : oldSize;
+			memcpy(&(s->arr[dst]), cs, tn);
+			dst += tn;
+			memmove(&(s->arr[dst]), &(s->arr[offsets[i] + m]),
+				next - (offsets[i] + m));
+			dst += next - (offsets[i] + m);
+		}
+	}
+	s->size = size;
+	s->length = s->length - count * from->length + count * to->length;
+	StrIndexTruncate(s, first);
+	ok = 1;
+
+done:
+	StrFree(s->alloc, copy);
+	if (offsets != local) StrFree(s->alloc, offsets);
+	return ok;
+}
+
+/* Set how the capacity of s grows when its array is full: STR_GROW_DOUBLE,
+ * STR_GROW_HALF or STR_GROW_EXACT. Huge arrays also grow by whole pages.
+ * Returns 1 on success, otherwise 0 (if growth is not one of these). */
+int StrSetGrowth(Str* const s, const int growth) {
+	if (growth != STR_GROW_DOUBLE && growth != STR_GROW_HALF &&
+		growth != STR_GROW_EXACT) return 0;
+	s->growth = growth;
+	return 1;
+}
+
+/* Make room in s for at least n more bytes, so that adding them later does not
+ * grow the array. Unlike growth when full, this reserves the exact amount
+ * (rounded up to whole pages if huge).
+ * Returns 1 on success, otherwise 0, in which case s is left unchanged. */
+int StrReserve(Str* const s, const size_t n) {
+	size_t cap;
+	if (n > SIZE_MAX - s->size) return 0;
+	if (s->cap >= s->size + n) return 1;
+	cap = StrRoundCap(s->size + n);
+	return cap && StrSetCap(s, cap);
+}
+
+/* Release the unused capacity of s and of its index. The initial array,
+ * allocated along with s itself, is kept as it is.
+ * Returns 1 on success, otherwise 0, in which case s is left unchanged. */
+int StrShrinkToFit(Str* const s) {
+	struct StrIndex* const idx = s->index;
+	if (idx && idx->count < idx->cap) {
+		struct StrIndex* const shrunk = StrRealloc(s->alloc, idx,
+			sizeof(*idx) + (idx->cap - 1) * sizeof(size_t),
+			sizeof(*idx) + (idx->count - 1) * sizeof(size_t));
+		if (!shrunk) return 0;
+		s->index = shrunk;
+		shrunk->cap = shrunk->count;
+	}
+	if (StrIsInline(s) || s->cap == s->size) return 1;
+	return StrSetCap(s, s->size) != 0;
+}
+
+/* Move the bytes of s into a reference-counted buffer, which StrCopy, StrTake
+ * and StrDrop (and their variants) of s then share rather than copy. A Str
+ * sharing a buffer copies it, once, when first changed, so the other Strs
+ * using it are unaffected. Changing the count is atomic, so Strs sharing a
+ * buffer may be used (and deleted) by different threads at once.
+ * Returns 1 on success, otherwise 0, in which case s is left unchanged. */
+int StrShare(Str* const s) {
+	struct StrShared* b;
+	if (s->shared) return 1;
+	if (s->size > SIZE_MAX - sizeof(*b)) return 0;
+	b = StrAlloc(s->alloc, sizeof(*b) + s->size);
+	if (!b) return 0;
+	b->refs = 1;
+	b->alloc = s->alloc;
+	memcpy(b + 1, s->arr, s->size);
+	if (!StrIsInline(s)) StrFree(s->alloc, s->arr);
+	s->arr = (char*)(b + 1);
+	s->cap = s->size;
+	s->shared = b;
+	return 1;
+}
+
+/* Insert the characters of t (which may be s itself) into s before the
+ * index-th character (or at the end, if index == StrLength(s)), like
+ * StrReplaceRange.
+ * Returns 1 on success, otherwise 0 (including if index > StrLength(s)). */
+int StrInsert(Str* const s, const size_t index, const Str* const t) {
+	if (index > s->length) return 0;
+	return StrReplaceBytes(s, index, index, t->arr, t->size - 1, t->length);
+}
+
+/* Remove the characters of s from index first to last (not inclusive), where
+ * last is clamped to StrLength(s), like StrReplaceRange.
+ * Returns 1 on success, otherwise 0 (including if first > last). */
+int StrErase(Str* const s, const size_t first, size_t last) {
+	if (last > s->length) last = s->length;
+	if (first > last) return 0;
+	return StrReplaceBytes(s, first, last, "", 0, 0);
+}
+
+/* If n < StrLength(s), remove n characters from the end of s; otherwise, set s
+ * to an empty string.
+ * Returns 1 on success, otherwise 0. */
+int StrTrim(Str* const s, size_t n) {
+	if (!StrDetach(s)) return 0;
+	if (n >= s->length) {
+		s->length = 0;
+		s->size = 1;
+		s->arr[0] = 0;
+		StrIndexTruncate(s, 0);
+		return 1;
+	}
+
+	StrIndexTruncate(s, s->length - n);
+	const char* cs = &(s->arr[s->size-1]);
+	while (n--) {
+		size_t size = UTF8Size(UTF8Before(cs));
+		cs -= size;
+		if (!size) return 0;
+		--s->length;
+		s->size -= size;
+	}
+	s->arr[s->size - 1] = 0;
+	return 1;
+}
+
+/* Create a new string iterator from a string s, using the allocator of s.
+ * Returns a pointer to the string iterator if successful, otherwise 0. */
+StrIter* StrIterNew(const Str* const s) {
+	if (!s) return 0;
+	StrIter* it = StrAlloc(s->alloc, sizeof(*it));
+	if (!it) return 0;
+	StrIterInit(it, s);
+	it->alloc = s->alloc;
+	return it;
+}
+
+/* Free a string iterator (doesn't free the underlying Str). */
+void StrIterDel(StrIter* it) { StrFree(it->alloc, it); }
+
+/* Create a view of the whole of s. */
+StrView StrViewOf(const Str* const s) {
+	StrView v;
+	v.arr = s->arr;
+	v.length = s->length;
+	v.size = s->size - 1;
+	return v;
+}
+
+/* Create a view of a slice of s from indices first to last (not inclusive),
+ * following the same rules as StrSlice. No memory is allocated. */
+StrView StrViewSlice(const Str* const s, const size_t first, const size_t last)
+{
+	const char* const end = &(s->arr[s->size-1]);
+	StrView v;
+
+	if (first > last || first > s->length) {
+		v.arr = end;
+		v.length = 0;
+		v.size = 0;
+		return v;
+	}
+
+	v.arr = StrCharPtr(s, first);
+	if (last < s->length) {
+		v.size = StrCharPtr(s, last) - v.arr;
+		v.length = last - first;
+	}
+	else {
+		v.size = end - v.arr;
+		v.length = s->length - first;
+	}
+	return v;
+}
+
+/* Create a view of the præfix of s of length n, or of the whole of s if
+ * n >= StrLength(s). */
+StrView StrViewTake(const Str* const s, const size_t n) {
+	return StrViewSlice(s, 0, n);
+}
+
+/* Create a view of the postfix of s without its first n characters, or an
+ * empty view if n >= StrLength(s). */
+StrView StrViewDrop(const Str* const s, const size_t n) {
+	return StrViewSlice(s, n, s->length);
+}
+
+/* Create a view of the longest præfix of s such that for each Unicode
+ * character c in the præfix, p(c) != 0. */
+StrView StrViewTakeWhile(const Str* const s, int (*p)(unsigned int)) {
+	const char* const end = &(s->arr[s->size-1]);
+	const char* cs = s->arr;
+	StrView v;
+
+	v.arr = s->arr;
+	v.length = 0;
+	while (cs < end) {
+		const unsigned int c = UTF8At(cs);
+		if (c == -1 || !p(c)) break;
+		cs += UTF8Size(c);
+		++v.length;
+	}
+	v.size = cs - s->arr;
+	return v;
+}
+
+/* Create a view of s without its longest præfix such that for each Unicode
+ * character c in the præfix, p(c) != 0. */
+StrView StrViewDropWhile(const Str* const s, int (*p)(unsigned int)) {
+	const StrView taken = StrViewTakeWhile(s, p);
+	StrView v;
+	v.arr = taken.arr + taken.size;
+	v.length = s->length - taken.length;
+	v.size = s->size - 1 - taken.size;
+	return v;
+}
+
+/* Returns 1 if v contains no characters, otherwise returns 0. */
+int StrViewIsNull(const StrView v) { return v.length == 0; }
+
+/* Returns 1 if the views v and w contain the same characters, 0 otherwise. */
+int StrViewEqual(const StrView v, const StrView w) {
+	if (v.length != w.length || v.size != w.size) return 0;
+	return !memcmp(v.arr, w.arr, v.size);
+}
+
+/* Three-way comparison of the views v and w, like StrCompare. */
+int StrViewCompare(const StrView v, const StrView w, size_t* const diffIndex) {
+	return UTF8Compare(v.arr, v.size, w.arr, w.size, diffIndex);
+}
+
+/* Returns 1 if the view v has w as a præfix, 0 otherwise. */
+int StrViewStartsWith(const StrView v, const StrView w) {
+	if (w.length > v.length || w.size > v.size) return 0;
+	/* a valid UTF-8 præfix in bytes is also a præfix in characters */
+	return !memcmp(v.arr, w.arr, w.size);
+}
+
+/* Returns 1 if the view v has w as a postfix, 0 otherwise. */
+int StrViewEndsWith(const StrView v, const StrView w) {
+	if (w.length > v.length || w.size > v.size) return 0;
+	return !memcmp(v.arr + v.size - w.size, w.arr, w.size);
+}
+
+/* Returns the first index of the character c in v if found, otherwise returns
+ * -1. */
+size_t StrViewFindChar(const StrView v, const unsigned int c) {
+	return UTF8FindChar(v.arr, v.size, c);
+}
+
+/* If v is not empty and its first character is valid, returns that character
+ * and removes it from the view; otherwise, if v is empty, returns 0; otherwise,
+ * returns -1. Repeated calls iterate over v forwards. */
+unsigned int StrViewNext(StrView* const v) {
+	if (!v->size) return 0;
+	const unsigned int c = UTF8At(v->arr);
+	if (c != -1) {
+		const size_t size = UTF8Size(c);
+		v->arr += size;
+		v->size -= size;
+		--v->length;
+	}
+	return c;
+}
+
+/* If v is not empty and its last character is valid, returns that character
+ * and removes it from the view; otherwise, if v is empty, returns 0; otherwise,
+ * returns -1. Repeated calls iterate over v backwards. */
+unsigned int StrViewPrev(StrView* const v) {
+	if (!v->size) return 0;
+	const unsigned int c = UTF8Before(v->arr + v->size);
+	if (c != -1) {
+		v->size -= UTF8Size(c);
+		--v->length;
+	}
+	return c;
+}
+
+/* Create a new Str containing a copy of the characters in v.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str. */
+Str* StrNewFromView(const StrView v) {
+	return StrNewFromViewInArena(0, v);
+}
+
+/* Like StrNewFromView, but the Str is created in the arena a (or on the heap
+ * if a is 0). */
+Str* StrNewFromViewInArena(StrArena* const a, const StrView v) {
+	return StrNewUnchecked(a ? &a->alloc : 0, v.arr, v.size, v.length);
+}
+
+/* Adds the characters in the view v to the end of s. v may be a view of s.
+ * Returns 1 on success, otherwise 0. */
+int StrAddView(Str* const s, const StrView v) {
+	/* v may point into s, which can move when resized */
+	const size_t offset = v.arr - s->arr;
+	const int inside = v.arr >= s->arr && v.arr < s->arr + s->size;
+	if (!StrResize(s, s->size + v.size)) return 0;
+
+	memmove(&(s->arr[s->size-1]), inside ? s->arr + offset : v.arr, v.size);
+	s->length += v.length;
+	s->size += v.size;
+	s->arr[s->size-1] = 0;
+	return 1;
+}
+
+#define MATCHER_NONE ((uint32_t)-1)
+#define MATCHER_MAX_LEADS 8
+
+/* Aho-Corasick automaton, as a DFA over classes of bytes: bytes that appear in
+ * no pattern share class 0, and each other byte gets its own class. State 0 is
+ * the root.
+ * The table has a row of stride = classes + 1 entries for each state: its
+ * transitions, followed by its report, which is the nearest state with
+ * patterns ending there among the state and its suffixes (following failure
+ * links), or 0 if none. States are stored in the table premultiplied by the
+ * stride, so that a step is a single lookup. */
+struct StrMatcher {
+	const StrAllocator* alloc;
+	size_t classes;
+	size_t stride;
+	size_t states;
+	uint32_t* next; /* Table of transitions and reports */
+	uint32_t* dict; /* report of the failure link of a state */
+	uint32_t* out; /* First pattern ending at a state, or MATCHER_NONE */
+	uint32_t* same; /* Next pattern with the same bytes, or MATCHER_NONE */
+	size_t* sizes; /* Size in bytes of each pattern */
+	size_t leadCount; /* Amount of distinct first bytes, or 0 if too many */
+	unsigned char leads[MATCHER_MAX_LEADS];
+	unsigned char classOf[256];
+};
+
+/* Create a matcher of the n patterns (which may contain duplicates) in the
+ * array patterns, using the default allocator. Empty patterns never match.
+ * Returns 0 if unable to create, otherwise a pointer to the matcher. */
+StrMatcher* StrMatcherNew(const Str* const* const patterns, const size_t n) {
+	const StrAllocator* const alloc = defaultAllocator;
+	size_t i, j, states = 1, total = 1, classes = 1, stride, head = 0, tail = 1;
+	uint32_t* queue;
+	StrMatcher* m;
+	if (n >= MATCHER_NONE) return 0;
+	for (i = 0; i < n; ++i) {
+		total += patterns[i]->size - 1;
+		if (total >= MATCHER_NONE) return 0;
+	}
+
+	m = StrAlloc(alloc, sizeof(*m));
+	if (!m) return 0;
+	memset(m, 0, sizeof(*m));
+	m->alloc = alloc;
+	for (i = 0; i < n; ++i) {
+		const unsigned char* const p = (const unsigned char*)patterns[i]->arr;
+		for (j = 0; j + 1 < patterns[i]->size; ++j)
+			if (!m->classOf[p[j]]) m->classOf[p[j]] = classes++;
+	}
+	m->classes = classes;
+	m->stride = stride = classes + 1;
+
+	if (total > (MATCHER_NONE - 1) / stride) goto fail;
+	m->next = StrAlloc(alloc, total * stride * sizeof(uint32_t));
+	m->dict = StrAlloc(alloc, total * sizeof(uint32_t));
+	m->out = StrAlloc(alloc, total * sizeof(uint32_t));
+	m->same = StrAlloc(alloc, (n ? n : 1) * sizeof(uint32_t));
+	m->sizes = StrAlloc(alloc, (n ? n : 1) * sizeof(size_t));
+	if (!m->next || !m->dict || !m->out || !m->same || !m->sizes) goto fail;
+	memset(m->next, 0, total * stride * sizeof(uint32_t));
+	memset(m->out, 0xff, total * sizeof(uint32_t));
+
+	/* trie, where a transition of 0 means none (no edge leads to the root) */
+	for (i = 0; i < n; ++i) {
+		const unsigned char* const p = (const unsigned char*)patterns[i]->arr;
+		uint32_t state = 0;
+		m->sizes[i] = patterns[i]->size - 1;
+		m->same[i] = MATCHER_NONE;
+		if (!m->sizes[i]) continue;
+		for (j = 0; j < m->sizes[i]; ++j) {
+			uint32_t* const t = &(m->next[state * stride + m->classOf[p[j]]]);
+			if (!*t) *t = states++;
+			state = *t;
+		}
+		/* keep duplicates in the order given */
+		if (m->out[state] == MATCHER_NONE) m->out[state] = i;
+		else {
+			uint32_t q = m->out[state];
+			while (m->same[q] != MATCHER_NONE) q = m->same[q];
+			m->same[q] = i;
+		}
+	}
+	m->states = states;
+
+	/* breadth-first, fill in failure transitions to complete the DFA, using
+	 * dict to hold the failure link until the state is dequeued */
+	queue = StrAlloc(alloc, states * sizeof(uint32_t));
+	if (!queue) goto fail;
+	queue[0] = 0;
+	m->dict[0] = 0;
+	while (head < tail) {
+		const uint32_t u = queue[head++];
+		const uint32_t f = m->dict[u];
+		uint32_t* const row = &(m->next[u * stride]);
+		size_t c;
+		m->dict[u] = u ? m->next[f * stride + classes] : 0;
+		row[classes] = m->out[u] != MATCHER_NONE ? u : m->dict[u];
+		for (c = 0; c < classes; ++c) {
+			const uint32_t g = u ? m->next[f * stride + c] : 0;
+			if (row[c]) {
+				m->dict[row[c]] = g;
+				queue[tail++] = row[c];
+			}
+			else row[c] = g;
+		}
+	}
+	StrFree(alloc, queue);
+
+	/* prefilter on the first bytes of patterns, if there are few enough */
+	for (i = 0; i < 256; ++i) {
+		if (!m->next[m->classOf[i]]) continue;
+		if (m->leadCount == MATCHER_MAX_LEADS) {
+			m->leadCount = 0;
+			break;
+		}
+		m->leads[m->leadCount++] = (unsigned char)i;
+	}
+
+	/* premultiply the transitions (but not the reports) by the stride */
+	for (i = 0; i < states; ++i)
+		for (j = 0; j < classes; ++j) m->next[i * stride + j] *= stride;
+	return m;
+
+fail:
+	StrMatcherDel(m);
+	return 0;
+}
+
+/* Free the memory of the matcher m and then m itself. */
+void StrMatcherDel(StrMatcher* const m) {
+	const StrAllocator* const alloc = m->alloc;
+	StrFree(alloc, m->next);
+	StrFree(alloc, m->dict);
+	StrFree(alloc, m->out);
+	StrFree(alloc, m->same);
+	StrFree(alloc, m->sizes);
+	StrFree(alloc, m);
+}
+
+/* Returns the offset of the first byte from i in the n bytes at p that can
+ * start a pattern of m, or n if there is none. */
+static size_t MatcherSkip(const StrMatcher* const m,
+	const unsigned char* const p, size_t i, const size_t n)
+{
+#ifdef BLOCK_SIZE
+	for (; i + BLOCK_SIZE <= n; i += BLOCK_SIZE) {
+		unsigned int mask = 0;
+		size_t j;
+#if defined(__AVX2__)
+		const __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+		for (j = 0; j < m->leadCount; ++j) {
+			mask |= _mm256_movemask_epi8(
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8(m->leads[j])));
+		}
+#else
+		const __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+		for (j = 0; j < m->leadCount; ++j) {
+			mask |= _mm_movemask_epi8(
+				_mm_cmpeq_epi8(v, _mm_set1_epi8(m->leads[j])));
+		}
+#endif
+		if (mask) return i + __builtin_ctz(mask);
+	}
+#endif
+	while (i < n && !m->next[m->classOf[p[i]]]) ++i;
+	return i;
+}
+
+/* Search for all the patterns of m in s in one pass, calling callback with ctx
+ * and each occurrence (which is only valid during the call), in order of their
+ * ends, longest first for occurrences ending at the same byte. Occurrences may
+ * overlap. The search stops early if callback returns nonzero. callback may be
+ * 0, to only count the occurrences.
+ * Returns the amount of occurrences that were found. */
+size_t StrMatcherRun(const StrMatcher* const m, const Str* const s,
+	int (*callback)(void* ctx, const StrMatch* match), void* const ctx)
+{
+	const unsigned char* const p = (const unsigned char*)s->arr;
+	const size_t n = s->size - 1;
+	/* character index of the byte at lastByte, kept to count from */
+	size_t i = 0, count = 0, lastByte = 0, lastIndex = 0;
+	uint32_t row = 0;
+
+	while (i < n) {
+		uint32_t t;
+		if (!row && m->leadCount) {
+			i = MatcherSkip(m, p, i, n);
+			if (i == n) break;
+		}
+		row = m->next[row + m->classOf[p[i++]]];
+		for (t = m->next[row + m->classes]; t; t = m->dict[t]) {
+			uint32_t q;
+			for (q = m->out[t]; q != MATCHER_NONE; q = m->same[q]) {
+				StrMatch match;
+				match.pattern = q;
+				match.byteOffset = i - m->sizes[q];
+				if (match.byteOffset >= lastByte) {
+					lastIndex += UTF8CountChars(s->arr + lastByte,
+						match.byteOffset - lastByte);
+				}
+				else {
+					lastIndex -= UTF8CountChars(s->arr + match.byteOffset,
+						lastByte - match.byteOffset);
+				}
+				lastByte = match.byteOffset;
+				match.index = lastIndex;
+				++count;
+				if (callback && callback(ctx, &match)) return count;
+			}
+		}
+	}
+	return count;
+}
+
+struct MatcherArray {
+	StrMatch* matches;
+	size_t max;
+	size_t count;
+};
+
+static int MatcherAppend(void* const ctx, const StrMatch* const match) {
+	struct MatcherArray* const a = ctx;
+	if (a->count < a->max) a->matches[a->count] = *match;
+	++a->count;
+	return 0;
+}
+
+/* Search for all the patterns of m in s in one pass, like StrMatcherRun,
+ * storing up to max of the occurrences in the array matches.
+ * Returns the amount of occurrences, which may be more than max. */
+size_t StrMatcherFind(const StrMatcher* const m, const Str* const s,
+	StrMatch* const matches, const size_t max)
+{
+	struct MatcherArray a;
+	a.matches = matches;
+	a.max = max;
+	a.count = 0;
+	return StrMatcherRun(m, s, MatcherAppend, &a);
+}
+
+/* Maximum size in bytes of a chunk of a rope */
+#define ROPE_CHUNK 1000
+
+/* Node of a rope, which is a treap ordered by position and heap-ordered by
+ * priority, with a chunk of UTF-8 in every node. */
+struct StrRopeNode {
+	struct StrRopeNode* left;
+	struct StrRopeNode* right;
+	uint32_t priority;
+	size_t size; /* Amount of bytes in the chunk */
+	size_t length; /* Amount of characters in the chunk */
+	size_t totalSize; /* Amount of bytes in the subtree */
+	size_t totalLength; /* Amount of characters in the subtree */
+	size_t count; /* Amount of nodes in the subtree */
+	char arr[ROPE_CHUNK];
+};
+
+struct StrRope {
+	struct StrRopeNode* root;
+	const StrAllocator* alloc;
+	uint32_t seed; /* State of the generator of priorities */
+};
+
+typedef struct StrRopeNode RopeNode;
+
+/* Recompute the totals of the subtree t from its children. */
+static void RopeUpdate(RopeNode* const t) {
+	t->totalSize = t->size;
+	t->totalLength = t->length;
+	t->count = 1;
+	if (t->left) {
+		t->totalSize += t->left->totalSize;
+		t->totalLength += t->left->totalLength;
+		t->count += t->left->count;
+	}
+	if (t->right) {
+		t->totalSize += t->right->totalSize;
+		t->totalLength += t->right->totalLength;
+		t->count += t->right->count;
+	}
+}
+
+/* Allocate a node of the rope r with the next random priority of r, and
+ * nothing else set. Returns 0 if unable to allocate. */
+static RopeNode* RopeNodeAlloc(StrRope* const r) {
+	RopeNode* const t = StrAlloc(r->alloc, sizeof(*t));
+	if (!t) return 0;
+	/* xorshift */
+	r->seed ^= r->seed << 13;
+	r->seed ^= r->seed >> 17;
+	r->seed ^= r->seed << 5;
+	t->priority = r->seed;
+	return t;
+}
+
+/* Create a node of the rope r with the n bytes at cs, which contain length
+ * characters. Returns 0 if unable to allocate. */
+static RopeNode* RopeNodeNew(StrRope* const r, const char* const cs,
+	const size_t n, const size_t length)
+{
+	RopeNode* const t = RopeNodeAlloc(r);
+	if (!t) return 0;
+	t->left = t->right = 0;
+	memcpy(t->arr, cs, n);
+	t->size = n;
+	t->length = length;
+	RopeUpdate(t);
+	return t;
+}
+
+/* Free the subtree t of the rope r. */
+static void RopeFree(StrRope* const r, RopeNode* const t) {
+	if (!t) return;
+	RopeFree(r, t->left);
+	RopeFree(r, t->right);
+	StrFree(r->alloc, t);
+}
+
+/* Join the subtrees l and r, with all of l before all of r. */
+static RopeNode* RopeMerge(RopeNode* const l, RopeNode* const r) {
+	if (!l) return r;
+	if (!r) return l;
+	if (l->priority > r->priority) {
+		l->right = RopeMerge(l->right, r);
+		RopeUpdate(l);
+		return l;
+	}
+	r->left = RopeMerge(l, r->left);
+	RopeUpdate(r);
+	return r;
+}
+
+/* Split the subtree t into its first index characters (*l) and the rest (*r).
+ * If the split falls inside a chunk, the node *spare (which must not be 0,
+ * and must come from RopeNodeAlloc) is used for the second part of it and
+ * *spare is set to 0. */
+static void RopeSplit(RopeNode* const t, const size_t index, RopeNode** const l,
+	RopeNode** const r, RopeNode** const spare)
+{
+	size_t before;
+	if (!t) {
+		*l = *r = 0;
+		return;
+	}
+	before = t->left ? t->left->totalLength : 0;
+	if (index <= before) {
+		RopeSplit(t->left, index, l, &(t->left), spare);
+		RopeUpdate(t);
+		*r = t;
+	}
+	else if (index >= before + t->length) {
+		RopeSplit(t->right, index - before - t->length, &(t->right), r, spare);
+		RopeUpdate(t);
+		*l = t;
+	}
+	else {
+		RopeNode* const u = *spare;
+		const size_t offset =
+			UTF8Advance(t->arr, t->arr + t->size, index - before) - t->arr;
+		*spare = 0;
+		memcpy(u->arr, t->arr + offset, t->size - offset);
+		u->size = t->size - offset;
+		u->length = t->length - (index - before);
+		u->left = u->right = 0;
+		RopeUpdate(u);
+		t->size = offset;
+		t->length = index - before;
+		*r = RopeMerge(u, t->right);
+		t->right = 0;
+		RopeUpdate(t);
+		*l = t;
+	}
+}
+
+/* Returns the node of the subtree t containing the character at index, where
+ * *index is made relative to the node. An index at the end of a chunk is
+ * taken to be in that chunk, rather than at the start of the next one. */
+static RopeNode* RopeFind(RopeNode* t, size_t* const index) {
+	while (t) {
+		const size_t before = t->left ? t->left->totalLength : 0;
+		if (*index <= before && t->left) t = t->left;
+		else if (*index > before + t->length && t->right) {
+			*index -= before + t->length;
+			t = t->right;
+		}
+		else {
+			*index -= before;
+			return t;
+		}
+	}
+	return 0;
+}
+
+/* Add size bytes and length characters to the totals of the subtrees on the
+ * path from t to the node containing index (see RopeFind). */
+static void RopeGrowPath(RopeNode* t, size_t index, const size_t size,
+	const size_t length)
+{
+	while (t) {
+		const size_t before = t->left ? t->left->totalLength : 0;
+		t->totalSize += size;
+		t->totalLength += length;
+		if (index <= before && t->left) t = t->left;
+		else if (index > before + t->length && t->right) {
+			index -= before + t->length;
+			t = t->right;
+		}
+		else return;
+	}
+}
+
+/* Join the subtrees l and r like RopeMerge, moving the first chunk of r into
+ * the last chunk of l if it fits, so that edits do not leave many small
+ * chunks behind. */
+static RopeNode* RopeJoin(StrRope* const rope, RopeNode* const l, RopeNode* r) {
+	RopeNode* a;
+	RopeNode* b;
+	RopeNode* spare = 0;
+	size_t end;
+	if (!l || !r) return RopeMerge(l, r);
+	for (a = l; a->right; a = a->right);
+	for (b = r; b->left; b = b->left);
+	if (a->size + b->size > ROPE_CHUNK) return RopeMerge(l, r);
+
+	/* b is a whole chunk, so no spare node is needed */
+	RopeSplit(r, b->length, &b, &r, &spare);
+	end = l->totalLength;
+	memcpy(a->arr + a->size, b->arr, b->size);
+	a->size += b->size;
+	a->length += b->length;
+	RopeGrowPath(l, end, b->size, b->length);
+	StrFree(rope->alloc, b);
+	return RopeMerge(l, r);
+}
+
+/* Create a subtree of the rope r with the n bytes of valid UTF-8 at cs, in
+ * chunks that end at character boundaries.
+ * Returns 1 on success (storing the subtree in *t), otherwise 0. */
+static int RopeBuild(StrRope* const r, const char* cs, size_t n,
+	RopeNode** const t)
+{
+	*t = 0;
+	while (n) {
+		size_t size = n < ROPE_CHUNK ? n : ROPE_CHUNK;
+		RopeNode* u;
+		while (size < n && (cs[size] & 0xc0) == 0x80) --size;
+		u = RopeNodeNew(r, cs, size, UTF8CountChars(cs, size));
+		if (!u) {
+			RopeFree(r, *t);
+			*t = 0;
+			return 0;
+		}
+		*t = RopeMerge(*t, u);
+		cs += size;
+		n -= size;
+	}
 	return 1;
 }
 
-/* If n < StrLength(s), remove n characters from the end of s; otherwise, set s
- * to an empty string.
- * Returns 1 on success, otherwise 0. */
-int StrTrim(Str* const s, size_t n) {
-	if (n >= s->length) {
-		s->length = 0;
-		s->size = 1;
-		s->arr[0] = 0;
+/* Create a new, empty rope, which uses the default allocator.
+ * Returns 0 if unable to create, otherwise a pointer to the rope. */
+StrRope* StrRopeNew(void) {
+	return StrRopeNewWithAllocator(0);
+}
+
+/* Like StrRopeNew, but the rope and its chunks use alloc (or the default
+ * allocator if alloc is 0). */
+StrRope* StrRopeNewWithAllocator(const StrAllocator* alloc) {
+	StrRope* r;
+	if (!alloc) alloc = defaultAllocator;
+	r = StrAlloc(alloc, sizeof(*r));
+	if (!r) return 0;
+	r->root = 0;
+	r->alloc = alloc;
+	r->seed = 2463534242u;
+	return r;
+}
+
+/* Create a new rope with the characters of s.
+ * Returns 0 if unable to create, otherwise a pointer to the rope. */
+StrRope* StrRopeNewFromStr(const Str* const s) {
+	StrRope* const r = StrRopeNew();
+	if (!r) return 0;
+	if (!RopeBuild(r, s->arr, s->size - 1, &(r->root))) {
+		StrRopeDel(r);
+		return 0;
+	}
+	return r;
+}
+
+/* Free the memory of the rope r and then r itself. */
+void StrRopeDel(StrRope* const r) {
+	RopeFree(r, r->root);
+	StrFree(r->alloc, r);
+}
+
+/* Returns the amount of characters in r. */
+size_t StrRopeLength(const StrRope* const r) {
+	return r->root ? r->root->totalLength : 0;
+}
+
+/* Returns the amount of bytes in r. */
+size_t StrRopeSize(const StrRope* const r) {
+	return r->root ? r->root->totalSize : 0;
+}
+
+/* Returns the depth of the subtree t (0 if it is empty). */
+static size_t RopeDepth(const RopeNode* const t) {
+	size_t l, r;
+	if (!t) return 0;
+	l = RopeDepth(t->left);
+	r = RopeDepth(t->right);
+	return 1 + (l > r ? l : r);
+}
+
+/* Returns the depth of the tree of chunks of r (0 if it is empty), which is
+ * expected to be O(log n) in the amount of chunks, as their priorities are
+ * random. Takes O(n) time. */
+size_t StrRopeDepth(const StrRope* const r) {
+	return RopeDepth(r->root);
+}
+
+/* Returns the code point of the index-th (starting from 0) character of r if
+ * index < StrRopeLength(r), otherwise 0. Takes O(log n) time. */
+unsigned int StrRopeAt(const StrRope* const r, const size_t index) {
+	size_t i = index + 1, k;
+	const RopeNode* t;
+	if (index >= StrRopeLength(r)) return 0;
+	/* find the chunk that the character ends in */
+	t = RopeFind(r->root, &i);
+	return StrIterDecode(UTF8Advance(t->arr, t->arr + t->size, i - 1), &k);
+}
+
+/* Copy the chunks of the subtree t to out, in order.
+ * Returns a pointer to the byte after the last one copied. */
+static char* RopeCopy(const RopeNode* const t, char* out) {
+	if (!t) return out;
+	out = RopeCopy(t->left, out);
+	memcpy(out, t->arr, t->size);
+	return RopeCopy(t->right, out + t->size);
+}
+
+/* Create a new Str containing the characters of r.
+ * Returns 0 if unsuccessful, otherwise a pointer to the new Str. */
+Str* StrRopeToStr(const StrRope* const r) {
+	const size_t size = StrRopeSize(r);
+	Str* const s = StrNewSetCap(size < INIT_CAP ? INIT_CAP : size + 1);
+	if (!s) return 0;
+	RopeCopy(r->root, s->arr);
+	s->arr[size] = 0;
+	s->length = StrRopeLength(r);
+	s->size = size + 1;
+	return s;
+}
+
+/* Prærequisites: index <= StrRopeLength(r).
+ * Insert the n UTF-8 encoded bytes at cs into r before the index-th character
+ * (or at the end, if index == StrRopeLength(r)), in O(log n + m) time for m
+ * inserted bytes. The bytes are validated first, so on failure r is left
+ * unchanged.
+ * Returns 1 on success, otherwise 0 (including if index is out of range or if
+ * the bytes contain a zero byte or are not valid UTF-8). */
+int StrRopeInsert(StrRope* const r, const size_t index, const char* const cs,
+	const size_t n)
+{
+	RopeNode* t;
+	RopeNode* l;
+	RopeNode* m;
+	RopeNode* spare;
+	size_t length, i = index;
+	if (index > StrRopeLength(r)) return 0;
+	if (!n) return 1;
+	if (!UTF8Check(cs, n, UTF8_NOZERO, &length, 0)) return 0;
+
+	/* small insertions go straight into a chunk with room for them */
+	t = RopeFind(r->root, &i);
+	if (t && t->size + n <= ROPE_CHUNK) {
+		char* const at = (char*)UTF8Advance(t->arr, t->arr + t->size, i);
+		memmove(at + n, at, t->arr + t->size - at);
+		memcpy(at, cs, n);
+		t->size += n;
+		t->length += length;
+		RopeGrowPath(r->root, index, n, length);
 		return 1;
 	}
 
-	const char* cs = &(s->arr[s->size]);
-	while (n--) {
-		size_t size = UTF8Size(UTF8Before(cs));
-		cs -= size;
-		if (!size) return 0;
-		--s->length;
-		s->size -= size;
+	spare = RopeNodeAlloc(r);
+	if (!spare) return 0;
+	if (!RopeBuild(r, cs, n, &m)) {
+		StrFree(r->alloc, spare);
+		return 0;
 	}
-	s->arr[s->size - 1] = 0;
+	RopeSplit(r->root, index, &l, &t, &spare);
+	r->root = RopeJoin(r, RopeJoin(r, l, m), t);
+	StrFree(r->alloc, spare);
 	return 1;
 }
 
-/* Create a new string iterator from a string s.
- * Returns a pointer to the string iterator if successful, otherwise 0. */
-StrIter* StrIterNew(const Str* const s) {
+/* Remove the characters of r from index first to last (not inclusive), where
+ * last is clamped to StrRopeLength(r), in O(log n) time (plus freeing the
+ * removed chunks).
+ * Returns 1 on success, otherwise 0 (including if first > last). */
+int StrRopeErase(StrRope* const r, const size_t first, size_t last) {
+	RopeNode* l;
+	RopeNode* m;
+	RopeNode* t;
+	RopeNode* spare[2];
+	if (last > StrRopeLength(r)) last = StrRopeLength(r);
+	if (first > last) return 0;
+	if (first == last) return 1;
+
+	spare[0] = RopeNodeAlloc(r);
+	spare[1] = RopeNodeAlloc(r);
+	if (!spare[0] || !spare[1]) {
+		StrFree(r->alloc, spare[0]);
+		StrFree(r->alloc, spare[1]);
+		return 0;
+	}
+	RopeSplit(r->root, last, &m, &t, &spare[0]);
+	RopeSplit(m, first, &l, &m, &spare[1]);
+	RopeFree(r, m);
+	r->root = RopeJoin(r, l, t);
+	StrFree(r->alloc, spare[0]);
+	StrFree(r->alloc, spare[1]);
+	return 1;
+}
+
+/* Move all of the characters of t to the end of r in O(log n) time, leaving t
+ * empty. r and t must use the same allocator. */
+void StrRopeConcat(StrRope* const r, StrRope* const t) {
+	r->root = RopeJoin(r, r->root, t->root);
+	t->root = 0;
+}
+
+/* Move the characters of r from index on (if any) to a new rope, in O(log n)
+ * time. The new rope uses the allocator of r.
+ * Returns 0 if unable to create the new rope, otherwise a pointer to it. */
+StrRope* StrRopeSplit(StrRope* const r, const size_t index) {
+	StrRope* const t = StrRopeNewWithAllocator(r->alloc);
+	RopeNode* spare;
+	if (!t) return 0;
+	spare = RopeNodeAlloc(r);
+	if (!spare) {
+		StrRopeDel(t);
+		return 0;
+	}
+	RopeSplit(r->root, index, &(r->root), &(t->root), &spare);
+	StrFree(r->alloc, spare);
+	return t;
+}
+
+/* Initialize the iterator it to the first chunk of r. */
+void StrRopeIterInit(StrRopeIter* const it, const StrRope* const r) {
+	it->rope = r;
+	it->chunk = 0;
+}
+
+/* If there are chunks left, stores a view of the next chunk of the rope of it
+ * in *v (valid until the rope is changed) and returns 1; otherwise returns 0.
+ * Each call takes O(log n) time. */
+int StrRopeIterNext(StrRopeIter* const it, StrView* const v) {
+	const RopeNode* t = it->rope->root;
+	size_t k = it->chunk;
+	if (!t || k >= t->count) return 0;
+	for (;;) {
+		const size_t before = t->left ? t->left->count : 0;
+		if (k < before) t = t->left;
+		else if (k > before) {
+			k -= before + 1;
+			t = t->right;
+		}
+		else break;
+	}
+	v->arr = t->arr;
+	v->length = t->length;
+	v->size = t->size;
+	++it->chunk;
+	return 1;
+}
+
+/* Text of a gap buffer is arr[0..gapStart) followed by arr[gapEnd..cap), with
+ * the cursor at the gap. The gap is never empty, so that there is always room
+ * for a final zero when flattening. */
+struct StrGap {
+	char* arr;
+	size_t cap;
+	size_t gapStart;
+	size_t gapEnd;
+	size_t lengthBefore; /* Amount of characters before the gap */
+	size_t lengthAfter; /* Amount of characters after the gap */
+	const StrAllocator* alloc;
+};
+
+/* Make the gap of g at least n + 1 bytes long, at least doubling the array if
+ * it needs to grow. Returns 1 on success, otherwise 0. */
+static int GapReserve(StrGap* const g, const size_t n) {
+	const size_t after = g->cap - g->gapEnd;
+	size_t cap;
+	char* arr;
+	if (g->gapEnd - g->gapStart > n) return 1;
+	if (n > SIZE_MAX / 2 - g->cap) return 0;
+	cap = g->cap + n + 1;
+	if (cap < 2 * g->cap) cap = 2 * g->cap;
+	arr = StrRealloc(g->alloc, g->arr, g->cap, cap);
+	if (!arr) return 0;
+	memmove(arr + cap - after, arr + g->gapEnd, after);
+	g->arr = arr;
+	g->gapEnd = cap - after;
+	g->cap = cap;
+	return 1;
+}
+
+/* Create a new gap buffer with the characters of s (or empty if s is 0), with
+ * the cursor at the end, using the default allocator.
+ * Returns 0 if unable to create, otherwise a pointer to the gap buffer. */
+StrGap* StrGapNew(const Str* const s) {
+	const size_t size = s ? s->size - 1 : 0;
+	StrGap* const g = StrAlloc(defaultAllocator, sizeof(*g));
+	if (!g) return 0;
+	g->alloc = defaultAllocator;
+	g->cap = size < INIT_CAP ? INIT_CAP : 2 * size;
+	g->arr = StrAlloc(g->alloc, g->cap);
+	if (!g->arr) {
+		StrFree(g->alloc, g);
+		return 0;
+	}
+	if (size) memcpy(g->arr, s->arr, size);
+	g->gapStart = size;
+	g->gapEnd = g->cap;
+	g->lengthBefore = s ? s->length : 0;
+	g->lengthAfter = 0;
+	return g;
+}
+
+/* Free the memory of the gap buffer g and then g itself. */
+void StrGapDel(StrGap* const g) {
+	StrFree(g->alloc, g->arr);
+	StrFree(g->alloc, g);
+}
+
+/* Returns the amount of characters in g. */
+size_t StrGapLength(const StrGap* const g) {
+	return g->lengthBefore + g->lengthAfter;
+}
+
+/* Returns the index of the character after the cursor of g. */
+size_t StrGapCursor(const StrGap* const g) { return g->lengthBefore; }
+
+/* Insert the n UTF-8 encoded bytes at cs into g at the cursor, leaving the
+ * cursor after them, in O(n) amortized time. The bytes are validated first, so
+ * on failure g is left unchanged.
+ * Returns 1 on success, otherwise 0 (including if the bytes contain a zero
+ * byte or are not valid UTF-8). */
+int StrGapInsert(StrGap* const g, const char* const cs, const size_t n) {
+	size_t length;
+	if (!n) return 1;
+	if (!UTF8Check(cs, n, UTF8_NOZERO, &length, 0)) return 0;
+	if (!GapReserve(g, n)) return 0;
+	memcpy(g->arr + g->gapStart, cs, n);
+	g->gapStart += n;
+	g->lengthBefore += length;
+	return 1;
+}
+
+/* Delete up to n characters after the cursor of g, in time proportional to
+ * their size.
+ * Returns the amount of characters deleted. */
+size_t StrGapDelete(StrGap* const g, const size_t n) {
+	const size_t k = n < g->lengthAfter ? n : g->lengthAfter;
+	g->gapEnd = UTF8Advance(g->arr + g->gapEnd, g->arr + g->cap, k) - g->arr;
+	g->lengthAfter -= k;
+	return k;
+}
+
+/* Delete up to n characters before the cursor of g, in time proportional to
+ * their size.
+ * Returns the amount of characters deleted. */
+size_t StrGapBackspace(StrGap* const g, const size_t n) {
+	const size_t k = n < g->lengthBefore ? n : g->lengthBefore;
+	size_t i;
+	for (i = 0; i < k; ++i)
+		g->gapStart -= UTF8Size(UTF8Before(g->arr + g->gapStart));
+	g->lengthBefore -= k;
+	return k;
+}
+
+/* Move the cursor of g forwards by up to n characters, in time proportional to
+ * their size.
+ * Returns the amount of characters moved over. */
+size_t StrGapForward(StrGap* const g, const size_t n) {
+	const size_t k = n < g->lengthAfter ? n : g->lengthAfter;
+	const char* const end =
+		UTF8Advance(g->arr + g->gapEnd, g->arr + g->cap, k);
+	const size_t span = end - (g->arr + g->gapEnd);
+	memmove(g->arr + g->gapStart, g->arr + g->gapEnd, span);
+	g->gapStart += span;
+	g->gapEnd += span;
+	g->lengthBefore += k;
+	g->lengthAfter -= k;
+	return k;
+}
+
+/* Move the cursor of g backwards by up to n characters, in time proportional
+ * to their size.
+ * Returns the amount of characters moved over. */
+size_t StrGapBack(StrGap* const g, const size_t n) {
+	const size_t k = n < g->lengthBefore ? n : g->lengthBefore;
+	const char* p = g->arr + g->gapStart;
+	size_t i, span;
+	for (i = 0; i < k; ++i) p -= UTF8Size(UTF8Before(p));
+	span = g->arr + g->gapStart - p;
+	memmove(g->arr + g->gapEnd - span, p, span);
+	g->gapStart -= span;
+	g->gapEnd -= span;
+	g->lengthBefore -= k;
+	g->lengthAfter += k;
+	return k;
+}
+
+/* Move the cursor of g to before the index-th character (or to the end, if
+ * index >= StrGapLength(g)), in time proportional to the distance moved. */
+void StrGapSeek(StrGap* const g, const size_t index) {
+	if (index < g->lengthBefore) StrGapBack(g, g->lengthBefore - index);
+	else StrGapForward(g, index - g->lengthBefore);
+}
+
+/* Returns a view of the characters of g before the cursor, which is valid
+ * until g is changed. */
+StrView StrGapBefore(const StrGap* const g) {
+	StrView v;
+	v.arr = g->arr;
+	v.length = g->lengthBefore;
+	v.size = g->gapStart;
+	return v;
+}
+
+/* Returns a view of the characters of g after the cursor, which is valid until
+ * g is changed. */
+StrView StrGapAfter(const StrGap* const g) {
+	StrView v;
+	v.arr = g->arr + g->gapEnd;
+	v.length = g->lengthAfter;
+	v.size = g->cap - g->gapEnd;
+	return v;
+}
+
+/* Turn g into a Str, which takes over its array, and free g. Only the
+ * characters after the cursor are moved, so this takes O(1) time when the
+ * cursor is at the end.
+ * Returns 0 if unable to create the Str (leaving g as it was), otherwise a
+ * pointer to the Str. */
+Str* StrGapFlatten(StrGap* const g) {
+	Str* const s = StrAlloc(g->alloc, sizeof(*s));
 	if (!s) return 0;
-	StrIter* it = malloc(sizeof(*it));
-	if (!it) return 0;
-	it->str = s;
-	it->cs = s->arr;
-	return it;
+	StrGapForward(g, g->lengthAfter);
+	g->arr[g->gapStart] = 0;
+	s->arr = g->arr;
+	s->length = g->lengthBefore;
+	s->size = g->gapStart + 1;
+	s->cap = g->cap;
+	s->index = 0;
+	s->alloc = g->alloc;
+	s->growth = STR_GROW_DOUBLE;
+	s->shared = 0;
+	StrFree(g->alloc, g);
+	return s;
 }
 
-/* Free a string iterator (doesn't free the underlying Str). */
-void StrIterDel(StrIter* it) { free(it); }
-
-/* Returns 1 if there are more characters left to be iterated over forwards in
- * the underlying string, otherwise 0. */
-int StrIterHasNext(const StrIter* const it) {
-	return it->cs < it->str->arr + it->str->size - 1;
-}
-
-/* If there are more characters to be iterated over forwards and the next
- * character is valid, returns the next character, then increments the iterator;
- * otherwise, if there are no more characters to be iterated over forwards,
- * returns 0; otherwise, returns -1. */
-unsigned int StrIterNext(StrIter* const it) {
-	if (!StrIterHasNext(it)) return 0;
-	const unsigned int c = UTF8At(it->cs);
-	if (c != -1) it->cs += UTF8Size(c);
-	return c;
+/* Width of a group of control bytes of an intern table, probed at once */
+#define INTERN_GROUP 16
+#define INTERN_EMPTY 0x80
+
+/* Slot of an intern table */
+struct StrInternSlot {
+	Str* str;
+	uint64_t hash;
+};
+
+/* Open addressing hash table of distinct strings, in the manner of Swiss
+ * tables. Each slot has a control byte: INTERN_EMPTY, or the low 7 bits of the
+ * hash of its string, so that a group of slots is matched against a hash with
+ * a single comparison. The first INTERN_GROUP - 1 control bytes are repeated
+ * after the last, so that a group may start at any slot. Strings are never
+ * removed, and at most 7/8 of the slots are full. */
+struct StrInternTable {
+	const StrAllocator* alloc;
+	unsigned char* ctrl; /* cap + INTERN_GROUP - 1 control bytes */
+	struct StrInternSlot* slots;
+	size_t cap; /* Amount of slots, a power of 2 */
+	size_t count;
+};
+
+/* Returns a mask of the control bytes of the group at ctrl equal to b. */
+static unsigned int InternMatch(const unsigned char* const ctrl,
+	const unsigned char b)
+{
+#ifdef BLOCK_SIZE
+	const __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)b)));
+#else
+	unsigned int mask = 0, i;
+	for (i = 0; i < INTERN_GROUP; ++i)
+		if (ctrl[i] == b) mask |= 1u << i;
+	return mask;
+#endif
 }
 
-/* Returns 1 if there have are more characters left to be iterated over
- * backwards in the underlying string, otherwise 0. */
-int StrIterHasPrev(const StrIter* const it) {
-	return it->cs > it->str->arr;
+/* Returns the slot of the table t holding the n bytes at cs with hash h, or
+ * the empty slot where they belong if there is none. */
+static size_t InternProbe(const StrInternTable* const t, const char* const cs,
+	const size_t n, const uint64_t h)
+{
+	const size_t mask = t->cap - 1;
+	const unsigned char h2 = h & 0x7f;
+	size_t pos = (h >> 7) & mask, step = 0;
+	for (;;) {
+		unsigned int match = InternMatch(t->ctrl + pos, h2);
+		unsigned int empty;
+		while (match) {
+			const size_t i = (pos + __builtin_ctz(match)) & mask;
+			const Str* const s = t->slots[i].str;
+			if (t->slots[i].hash == h && s->size - 1 == n &&
+				!memcmp(s->arr, cs, n)) return i;
+			match &= match - 1;
+		}
+		empty = InternMatch(t->ctrl + pos, INTERN_EMPTY);
+		if (empty) return (pos + __builtin_ctz(empty)) & mask;
+		step += INTERN_GROUP;
+		pos = (pos + step) & mask;
+	}
 }
 
-/* If there are more characters to be iterated over backwards and the next
- * character is valid, returns the next character, then increments the iterator;
- * otherwise, if there are no more characters to be iterated over backwards,
- * returns 0; otherwise, returns -1. */
-unsigned int StrIterPrev(StrIter* const it) {
-	if (!StrIterHasPrev(it)) return 0;
-	const unsigned int c = UTF8Before(it->cs);
-	if (c != -1) it->cs -= UTF8Size(c);
-	return c;
+/* Set the control byte of slot i of the table t, and its repetition. */
+static void InternSetCtrl(StrInternTable* const t, const size_t i,
+	const unsigned char b)
+{
+	t->ctrl[i] = b;
+	if (i < INTERN_GROUP - 1) t->ctrl[t->cap + i] = b;
+}
+
+/* Allocate the slots of the table t for cap (a power of 2, at least
+ * INTERN_GROUP) slots, all empty.
+ * Returns 1 on success, otherwise 0, leaving t as it was. */
+static int InternAllocate(StrInternTable* const t, const size_t cap) {
+	unsigned char* ctrl;
+	struct StrInternSlot* slots;
+	if (cap > SIZE_MAX / sizeof(*slots)) return 0;
+	ctrl = StrAlloc(t->alloc, cap + INTERN_GROUP - 1);
+	if (!ctrl) return 0;
+	slots = StrAlloc(t->alloc, cap * sizeof(*slots));
+	if (!slots) {
+		StrFree(t->alloc, ctrl);
+		return 0;
+	}
+	memset(ctrl, INTERN_EMPTY, cap + INTERN_GROUP - 1);
+	t->ctrl = ctrl;
+	t->slots = slots;
+	t->cap = cap;
+	return 1;
+}
+
+/* Double the amount of slots of the table t, moving every string over.
+ * Returns 1 on success, otherwise 0, leaving t as it was. */
+static int InternGrow(StrInternTable* const t) {
+	unsigned char* const ctrl = t->ctrl;
+	struct StrInternSlot* const slots = t->slots;
+	const size_t cap = t->cap;
+	size_t i;
+	if (cap > SIZE_MAX / 2 || !InternAllocate(t, 2 * cap)) return 0;
+	for (i = 0; i < cap; ++i) {
+		size_t j;
+		if (ctrl[i] == INTERN_EMPTY) continue;
+		/* the strings are distinct, so only an empty slot is found */
+		j = InternProbe(t, 0, -1, slots[i].hash);
+		t->slots[j] = slots[i];
+		InternSetCtrl(t, j, ctrl[i]);
+	}
+	StrFree(t->alloc, ctrl);
+	StrFree(t->alloc, slots);
+	return 1;
+}
+
+/* Create a new, empty intern table, using the default allocator.
+ * Returns 0 if unable to create, otherwise a pointer to the table. */
+StrInternTable* StrInternTableNew(void) {
+	StrInternTable* const t = StrAlloc(defaultAllocator, sizeof(*t));
+	if (!t) return 0;
+	t->alloc = defaultAllocator;
+	t->count = 0;
+	if (!InternAllocate(t, INTERN_GROUP)) {
+		StrFree(t->alloc, t);
+		return 0;
+	}
+	return t;
+}
+
+/* Free the memory of the table t, including every string interned in it, and
+ * then t itself. */
+void StrInternTableDel(StrInternTable* const t) {
+	size_t i;
+	for (i = 0; i < t->cap; ++i)
+		if (t->ctrl[i] != INTERN_EMPTY) StrDel(t->slots[i].str);
+	StrFree(t->alloc, t->ctrl);
+	StrFree(t->alloc, t->slots);
+	StrFree(t->alloc, t);
+}
+
+/* Returns the amount of distinct strings interned in the table t. */
+size_t StrInternTableCount(const StrInternTable* const t) { return t->count; }
+
+/* Returns the canonical Str in the table t with the characters of the view v,
+ * whose hash with seed 0 is h, interning a copy of them first if needed.
+ * Returns 0 if unable to intern, otherwise a pointer to the Str. */
+static const Str* InternAdd(StrInternTable* const t, const StrView v,
+	const uint64_t h)
+{
+	size_t i = InternProbe(t, v.arr, v.size, h);
+	Str* s;
+	if (t->ctrl[i] != INTERN_EMPTY) return t->slots[i].str;
+
+	if (t->count + 1 > t->cap / 8 * 7) {
+		if (!InternGrow(t)) return 0;
+		i = InternProbe(t, v.arr, v.size, h);
+	}
+	/* the array is sized exactly, as it never grows */
+	s = StrNewSetCapWithAllocator(t->alloc, v.size + 1);
+	if (!s) return 0;
+	memcpy(s->arr, v.arr, v.size);
+	s->arr[v.size] = 0;
+	s->size = v.size + 1;
+	s->length = v.length;
+	/* the hash and the whole index are stored now, so lookups and StrHash
+	 * with seed 0 only ever read them */
+	s->index = StrIndexNew(s->alloc, 1);
+	if (!s->index) {
+		StrDel(s);
+		return 0;
+	}
+	s->index->hash = h;
+	s->index->hashSeed = 0;
+	s->index->hashed = 1;
+	if (s->length >= INDEX_STRIDE && s->size - 1 != s->length) {
+		StrIndexExtend(s, -1, -1);
+		if (s->index->count * INDEX_STRIDE < s->length) {
+			StrDel(s);
+			return 0;
+		}
+	}
+
+	t->slots[i].str = s;
+	t->slots[i].hash = h;
+	InternSetCtrl(t, i, h & 0x7f);
+	++t->count;
+	return s;
+}
+
+/* Returns the canonical Str in the table t with the same characters as the view
+ * v, interning a copy of them first if there is none. Interned Strs must not
+ * be changed or deleted, and stay valid until t is deleted, so two of them
+ * from the same table are equal exactly if they are the same pointer. They
+ * may be read by several threads at once, as non-mutating functions do not
+ * change them (except StrHash with a seed other than 0, which caches it).
+ * Returns 0 if unable to intern, otherwise a pointer to the Str. */
+const Str* StrInternView(StrInternTable* const t, const StrView v) {
+	return InternAdd(t, v, UTF8Hash(v.arr, v.size, 0));
+}
+
+/* Like StrInternView, with the characters of s. */
+const Str* StrIntern(StrInternTable* const t, const Str* const s) {
+	return InternAdd(t, StrViewOf(s), StrHash(s, 0));
+}
+
+/* Returns the canonical Str in the table t with the same characters as s, or 0
+ * if there is none. As this does not change t, it may be called by several
+ * threads at once (with different s, whose hash is cached), as long as no
+ * string is being interned at the same time. */
+const Str* StrInternFind(const StrInternTable* const t, const Str* const s) {
+	const size_t i = InternProbe(t, s->arr, s->size - 1, StrHash(s, 0));
+	return t->ctrl[i] == INTERN_EMPTY ? 0 : t->slots[i].str;
+}
+
+/* Ranges of at most this many Strs are insertion sorted */
+#define SORT_INSERTION 16
+/* Ranges of fewer Strs than this are sorted by multikey quicksort rather than
+ * radix sort */
+#define SORT_RADIX 1024
+
+/* Byte of the Str s at offset depth, which is at most its size - 1, so that 0
+ * marks its end. */
+#define SORT_BYTE(s, depth) ((unsigned char)(s)->arr[depth])
+
+/* Range of an array of Strs to sort, whose first depth bytes are all equal */
+struct SortTask {
+	Str** v;
+	size_t n;
+	size_t depth;
+};
+
+/* Sort the n Strs at v, with equal first depth bytes, by insertion. This is
+ * stable. */
+static void SortInsertion(Str** const v, const size_t n, const size_t depth) {
+	size_t i, j;
+	for (i = 1; i < n; ++i) {
+		Str* const s = v[i];
+		for (j = i; j > 0 && strcmp(v[j-1]->arr + depth, s->arr + depth) > 0; --j)
+			v[j] = v[j-1];
+		v[j] = s;
+	}
+}
+
+static void SortSwap(Str** const v, size_t i, size_t j, size_t n) {
+	while (n--) {
+		Str* const s = v[i];
+		v[i++] = v[j];
+		v[j++] = s;
+	}
+}
+
+/* Sort the n Strs at v, with equal first depth bytes, by multikey quicksort:
+ * they are split into those whose next byte is less than, equal to or greater
+ * than a pivot, and the equal ones are sorted from the byte after. */
+static void SortMultikey(Str** v, size_t n, size_t depth) {
+	while (n > SORT_INSERTION) {
+		const unsigned int x = SORT_BYTE(v[0], depth);
+		const unsigned int y = SORT_BYTE(v[n/2], depth);
+		const unsigned int z = SORT_BYTE(v[n-1], depth);
+		/* median of the three */
+		const unsigned int p = x < y ? (y < z ? y : x < z ? z : x) :
+			(x < z ? x : y < z ? z : y);
+		size_t a = 0, b = 0, c = n - 1, d = n - 1, lt, gt, k;
+		for (;;) {
+			unsigned int e;
+			while (b <= c && (e = SORT_BYTE(v[b], depth)) <= p) {
+				if (e == p) SortSwap(v, a++, b, 1);
+				++b;
+			}
+			while (b <= c && (e = SORT_BYTE(v[c], depth)) >= p) {
+				if (e == p) SortSwap(v, c, d--, 1);
+				if (!c--) break;
+			}
+			if (b > c || c == (size_t)-1) break;
+			SortSwap(v, b++, c--, 1);
+		}
+		/* move the equal ones from both ends to the middle */
+		lt = b - a;
+		gt = d - c;
+		k = a < lt ? a : lt;
+		SortSwap(v, 0, b - k, k);
+		k = gt < n - 1 - d ? gt : n - 1 - d;
+		SortSwap(v, b, n - k, k);
+
+		SortMultikey(v, lt, depth);
+		SortMultikey(v + n - gt, gt, depth);
+		v += lt;
+		n -= lt + gt;
+		/* equal Strs that have ended are sorted */
+		if (!p) return;
+		++depth;
+	}
+	SortInsertion(v, n, depth);
+}
+
+/* Split the n Strs at v, with equal first depth bytes, in place into buckets
+ * by the next byte, which is stored at the same index in oracle, and store the
+ * size of each bucket in sizes. */
+static void SortPartition(Str** const v, const size_t n, const size_t depth,
+	unsigned char* const oracle, size_t* const sizes)
+{
+	Str** ends[256];
+	size_t i, last = 0;
+	memset(sizes, 0, 256 * sizeof(size_t));
+	for (i = 0; i < n; ++i) {
+		oracle[i] = SORT_BYTE(v[i], depth);
+		++sizes[oracle[i]];
+	}
+	if (sizes[oracle[0]] == n) return;
+
+	ends[0] = v + sizes[0];
+	if (sizes[0]) last = sizes[0];
+	for (i = 1; i < 256; ++i) {
+		ends[i] = ends[i-1] + sizes[i];
+		if (sizes[i]) last = sizes[i];
+	}
+	/* put each Str in place by following cycles, leaving every bucket but the
+	 * last full once the others are */
+	for (i = 0; i < n - last; ) {
+		Str* s = v[i];
+		unsigned char b = oracle[i];
+		while (--ends[b] > v + i) {
+			Str* const t = *ends[b];
+			const unsigned char c = oracle[ends[b] - v];
+			*ends[b] = s;
+			oracle[ends[b] - v] = b;
+			s = t;
+			b = c;
+		}
+		v[i] = s;
+		i += sizes[b];
+	}
+}
+
+/* Returns the amount of bytes after the first depth that the n > 0 Strs at v
+ * (whose first depth bytes are equal) all have in common. */
+static size_t SortCommonPrefix(Str** const v, const size_t n,
+	const size_t depth)
+{
+	size_t i, common = v[0]->size - 1 - depth;
+	for (i = 1; i < n && common; ++i) {
+		const size_t size = v[i]->size - 1 - depth;
+		common = UTF8Mismatch(v[0]->arr + depth, v[i]->arr + depth,
+			size < common ? size : common);
+	}
+	return common;
+}
+
+/* Sort the n Strs at v, with equal first depth bytes, by MSD radix sort, using
+ * n bytes at oracle. The largest bucket is sorted in the same call, and the
+ * others, of at most half the Strs each, recursively. */
+static void SortRadix(Str** v, size_t n, size_t depth, unsigned char* oracle) {
+	size_t sizes[256];
+	while (n >= SORT_RADIX) {
+		size_t i, offset, largest = 0, largestOffset = 0;
+		SortPartition(v, n, depth, oracle, sizes);
+		if (sizes[oracle[0]] == n) {
+			/* skip the rest of a common præfix at once, rather than a pass per
+			 * byte */
+			if (!oracle[0]) return;
+			depth += SortCommonPrefix(v, n, depth);
+			continue;
+		}
+		/* the Strs in bucket 0 have ended, so are equal */
+		offset = sizes[0];
+		for (i = 1; i < 256; ++i) {
+			if (sizes[i] > largest) {
+				if (largest) SortRadix(v + largestOffset, largest, depth + 1,
+					oracle + largestOffset);
+				largest = sizes[i];
+				largestOffset = offset;
+			}
+			else if (sizes[i] > 1) SortRadix(v + offset, sizes[i], depth + 1,
+				oracle + offset);
+			offset += sizes[i];
+		}
+		v += largestOffset;
+		n = largest;
+		oracle += largestOffset;
+		++depth;
+	}
+	SortMultikey(v, n, depth);
+}
+
+/* Sort the n Strs at v, with equal first depth bytes, by stable MSD radix sort,
+ * distributing them through tmp and oracle, which have room for n each. */
+static void SortRadixStable(Str** v, size_t n, size_t depth,
+	unsigned char* oracle, Str** tmp)
+{
+	size_t sizes[256], starts[256];
+	while (n > SORT_INSERTION) {
+		size_t i, offset, largest = 0, largestOffset = 0;
+		memset(sizes, 0, sizeof(sizes));
+		for (i = 0; i < n; ++i) {
+			oracle[i] = SORT_BYTE(v[i], depth);
+			++sizes[oracle[i]];
+		}
+		if (sizes[oracle[0]] == n) {
+			if (!oracle[0]) return;
+			depth += SortCommonPrefix(v, n, depth);
+			continue;
+		}
+		starts[0] = 0;
+		for (i = 1; i < 256; ++i) starts[i] = starts[i-1] + sizes[i-1];
+		for (i = 0; i < n; ++i) tmp[starts[oracle[i]]++] = v[i];
+		memcpy(v, tmp, n * sizeof(*v));
+
+		offset = sizes[0];
+		for (i = 1; i < 256; ++i) {
+			if (sizes[i] > largest) {
+				if (largest) SortRadixStable(v + largestOffset, largest,
+					depth + 1, oracle, tmp);
+				largest = sizes[i];
+				largestOffset = offset;
+			}
+			else if (sizes[i] > 1) SortRadixStable(v + offset, sizes[i],
+				depth + 1, oracle, tmp);
+			offset += sizes[i];
+		}
+		v += largestOffset;
+		n = largest;
+		++depth;
+	}
+	SortInsertion(v, n, depth);
+}
+
+/* Sort the n Strs at v (in place) by their bytes, which puts them in order of
+ * code points. Large arrays are sorted by MSD radix sort, which reads each byte
+ * once per level, and smaller ranges by multikey quicksort, which compares
+ * each byte of a common præfix once. The order of equal Strs is not kept. */
+void StrSort(Str** const v, const size_t n) {
+	unsigned char* oracle;
+	if (n < SORT_RADIX) {
+		SortMultikey(v, n, 0);
+		return;
+	}
+	/* without room for the next bytes, fall back to multikey quicksort */
+	oracle = StrAlloc(defaultAllocator, n);
+	if (!oracle) {
+		SortMultikey(v, n, 0);
+		return;
+	}
+	SortRadix(v, n, 0, oracle);
+	StrFree(defaultAllocator, oracle);
+}
+
+/* Like StrSort, but equal Strs keep their order. This needs memory for n more
+ * pointers.
+ * Returns 1 on success, otherwise 0 (if unable to allocate), in which case v is
+ * left unchanged. */
+int StrSortStable(Str** const v, const size_t n) {
+	unsigned char* oracle;
+	Str** tmp;
+	if (n <= SORT_INSERTION) {
+		SortInsertion(v, n, 0);
+		return 1;
+	}
+	if (n > SIZE_MAX / sizeof(*tmp)) return 0;
+	oracle = StrAlloc(defaultAllocator, n);
+	tmp = StrAlloc(defaultAllocator, n * sizeof(*tmp));
+	if (oracle && tmp) SortRadixStable(v, n, 0, oracle, tmp);
+	StrFree(defaultAllocator, oracle);
+	StrFree(defaultAllocator, tmp);
+	return oracle && tmp;
+}
+
+/* Tasks of StrSortParallel, shared by its threads */
+struct SortTasks {
+	struct SortTask* tasks;
+	size_t count;
+	size_t next; /* Next task to be taken, changed atomically */
+	Str** v; /* Start of the whole array */
+	unsigned char* oracle;
+};
+
+/* Sort the tasks of ctx, a struct SortTasks, one at a time until none are
+ * left. */
+static void* SortWorker(void* const ctx) {
+	struct SortTasks* const t = ctx;
+	for (;;) {
+		const size_t i = __atomic_fetch_add(&t->next, 1, __ATOMIC_RELAXED);
+		const struct SortTask* task;
+		if (i >= t->count) return 0;
+		task = &t->tasks[i];
+		SortRadix(task->v, task->n, task->depth, t->oracle + (task->v - t->v));
+	}
+}
+
+static int SortTaskCompare(const void* const a, const void* const b) {
+	const size_t m = ((const struct SortTask*)a)->n;
+	const size_t n = ((const struct SortTask*)b)->n;
+	return m < n ? 1 : m > n ? -1 : 0;
 }
 
+/* Like StrSort, but the work is shared by the given amount of threads (or one
+ * per online processor, if threads is 0), including the calling one. The
+ * array is split by radix sort into buckets, splitting large buckets again,
+ * until there are enough of them to share evenly, and then each thread sorts
+ * the largest bucket left. Uses fewer threads if unable to create them. */
+void StrSortParallel(Str** const v, const size_t n, unsigned int threads) {
+	struct SortTasks t;
+	pthread_t* ids;
+	size_t i, j, cap, limit, started = 0;
+	if (!threads) {
+		const long k = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = k > 0 ? (unsigned int)k : 1;
+	}
+	if (threads < 2 || n < (size_t)SORT_RADIX * threads) {
+		StrSort(v, n);
+		return;
+	}
+
+	cap = 256;
+	t.v = v;
+	t.next = 0;
+	t.count = 1;
+	t.oracle = StrAlloc(defaultAllocator, n);
+	t.tasks = StrAlloc(defaultAllocator, cap * sizeof(*t.tasks));
+	if (!t.oracle || !t.tasks) goto fail;
+	t.tasks[0].v = v;
+	t.tasks[0].n = n;
+	t.tasks[0].depth = 0;
+
+	/* split tasks until none is larger than a fraction of the work per
+	 * thread, or is made of equal Strs */
+	limit = n / threads / 4;
+	if (limit < SORT_RADIX) limit = SORT_RADIX;
+	for (i = 0; i < t.count; ) {
+		struct SortTask task = t.tasks[i];
+		size_t sizes[256], offset;
+		if (task.n <= limit) {
+			++i;
+			continue;
+		}
+		SortPartition(task.v, task.n, task.depth,
+			t.oracle + (task.v - v), sizes);
+		if (sizes[t.oracle[task.v - v]] == task.n) {
+			if (!t.oracle[task.v - v]) t.tasks[i] = t.tasks[--t.count];
+			else t.tasks[i].depth += SortCommonPrefix(task.v, task.n, task.depth);
+			continue;
+		}
+		/* replace the task with its buckets */
+		t.tasks[i] = t.tasks[--t.count];
+		if (t.count + 256 > cap) {
+			struct SortTask* const grown = StrRealloc(defaultAllocator,
+				t.tasks, cap * sizeof(*t.tasks), 2 * cap * sizeof(*t.tasks));
+			if (!grown) goto fail;
+			t.tasks = grown;
+			cap *= 2;
+		}
+		offset = sizes[0];
+		for (j = 1; j < 256; ++j) {
+			if (sizes[j] > 1) {
+				t.tasks[t.count].v = task.v + offset;
+				t.tasks[t.count].n = sizes[j];
+				t.tasks[t.count].depth = task.depth + 1;
+				++t.count;
+			}
+			offset += sizes[j];
+		}
+	}
+	qsort(t.tasks, t.count, sizeof(*t.tasks), SortTaskCompare);
+
+	ids = StrAlloc(defaultAllocator, (threads - 1) * sizeof(*ids));
+	if (ids) {
+		for (; started < threads - 1; ++started)
+			if (pthread_create(&ids[started], 0, SortWorker, &t)) break;
+	}
+	SortWorker(&t);
+	for (i = 0; i < started; ++i) pthread_join(ids[i], 0);
+	StrFree(defaultAllocator, ids);
+	StrFree(defaultAllocator, t.oracle);
+	StrFree(defaultAllocator, t.tasks);
+	return;
+
+fail:
+	/* the tasks so far only split v, so sort it as a whole */
+	StrFree(defaultAllocator, t.oracle);
+	StrFree(defaultAllocator, t.tasks);
+	StrSort(v, n);
+}
+
+/* Move the first of each run of equal Strs in the n sorted Strs at v to the
+ * front, in order, and the others after them, so that they can be deleted.
+ * Returns the amount of distinct Strs. */
+size_t StrUnique(Str** const v, const size_t n) {
+	size_t i, count = 1;
+	if (!n) return 0;
+	for (i = 1; i < n; ++i) {
+		if (StrEqual(v[i], v[count-1])) continue;
+		SortSwap(v, count++, i, 1);
+	}
+	return count;
+}
@@ -5,37 +5,192 @@
 #define __NIKOLASHN_UTF8STR_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* Mutable UTF-8 strings in C. */
 
+struct StrIndex;
+struct StrShared;
+struct StrArena;
+struct StrMatcher;
+struct StrRope;
+struct StrGap;
+struct StrInternTable;
+
+/* Allocator of the memory used by Strs, as a set of functions that are passed
+ * ctx as their first argument. */
+struct StrAllocator {
+	/* Allocate n bytes. Returns 0 on failure. */
+	void* (*allocate)(void* ctx, size_t n);
+	/* Resize the block at p of n bytes to m bytes, moving it if needed.
+	 * Returns 0 on failure, leaving the block as it was. */
+	void* (*reallocate)(void* ctx, void* p, size_t n, size_t m);
+	/* Optional (may be 0): grow the block at p of n bytes to m bytes without
+	 * moving it. Returns 1 on success, 0 if not possible. */
+	int (*extend)(void* ctx, void* p, size_t n, size_t m);
+	/* Free the block at p. */
+	void (*release)(void* ctx, void* p);
+	void* ctx;
+};
+
+typedef struct StrAllocator StrAllocator;
+
+/* Region that Strs can be allocated in, to be released all at once */
+typedef struct StrArena StrArena;
+
+/* Compiled set of patterns to search for in Strs all at once */
+typedef struct StrMatcher StrMatcher;
+
+/* Balanced tree of chunks of UTF-8, for large strings edited anywhere */
+typedef struct StrRope StrRope;
+
+/* String with a movable gap at a cursor, for edits clustered at one place */
+typedef struct StrGap StrGap;
+
+/* Set of distinct strings, each with a single canonical Str */
+typedef struct StrInternTable StrInternTable;
+
+/* A Str is created and deleted by the functions below and used through
+ * pointers. Its array may be allocated along with it, so a Str must not be
+ * copied by value. After StrShare, copies of it share its array instead, and
+ * Strs sharing an array may be used by different threads at once. */
 struct Str {
 	char* arr; /* Underlying array of bytes. Maintains a final zero. */
 	size_t length; /* Amount of UTF-8 characters (not including zero) */
 	size_t size; /* Amount of bytes of data in container (including zero) */
 	size_t cap; /* Capacity of container in bytes (including zero) */
+	/* Byte offsets of every few characters and the hash cached by StrHash,
+	 * built lazily by lookups and StrHash (or 0). As they may extend it, a Str
+	 * must not be used by several threads at once, even through non-mutating
+	 * functions, unless it is interned (see StrInternView). */
+	struct StrIndex* index;
+	const StrAllocator* alloc; /* Allocator of the Str and its memory */
+	/* Reference-counted buffer that arr lies in, copied before any change to
+	 * it (or 0, if the array belongs to this Str alone) */
+	struct StrShared* shared;
+	int growth; /* How cap grows when the array is full (STR_GROW_...) */
 };
 
 typedef struct Str Str;
 
+/* Growth policies of Strs, set with StrSetGrowth */
+#define STR_GROW_DOUBLE 0 /* double cap (the default) */
+#define STR_GROW_HALF 1 /* grow cap by half */
+#define STR_GROW_EXACT 2 /* grow cap to exactly the size needed */
+
+/* Unicode normalization forms, for StrNormalize and StrIsNormalized */
+#define STR_NFC 0 /* canonical decomposition, then canonical composition */
+#define STR_NFD 1 /* canonical decomposition */
+#define STR_NFKC 2 /* compatibility decomposition, then canonical composition */
+#define STR_NFKD 3 /* compatibility decomposition */
+
 struct StrIter {
 	const Str* str;
 	const char* cs;
+	const StrAllocator* alloc;
 };
 
 typedef struct StrIter StrIter;
 
+/* Read-only view of a run of characters of a Str (or another valid UTF-8 byte
+ * array), which does not own its bytes. It stays valid for as long as the
+ * viewed bytes are not changed or moved. */
+struct StrView {
+	const char* arr; /* First byte of the view. Not zero-terminated. */
+	size_t length; /* Amount of UTF-8 characters */
+	size_t size; /* Amount of bytes (there is no final zero) */
+};
+
+typedef struct StrView StrView;
+
+/* Occurrence of a pattern of a StrMatcher in a Str. */
+struct StrMatch {
+	size_t pattern; /* Position of the pattern in the array it was given in */
+	size_t index; /* Index of the first character of the occurrence */
+	size_t byteOffset; /* Byte offset of the occurrence */
+};
+
+typedef struct StrMatch StrMatch;
+
+/* Iterator over the chunks of a StrRope, in order */
+struct StrRopeIter {
+	const StrRope* rope;
+	size_t chunk; /* Index of the next chunk */
+};
+
+typedef struct StrRopeIter StrRopeIter;
+
 /* Creation and deletion */
 Str* StrNew(const char* const cs);
+Str* StrNewFromBytes(const char* const cs, const size_t n);
+Str* StrNewStrict(const char* const cs);
+Str* StrNewFromBytesStrict(const char* const cs, const size_t n);
+Str* StrNewFromUTF16(const uint16_t* const cs, const size_t n,
+	size_t* const errOffset);
+Str* StrNewFromLatin1(const char* const cs, const size_t n,
+	size_t* const errOffset);
 Str* StrNewSetCap(const size_t initCap);
 void StrDel(Str* const s);
 
+/* Allocator functions */
+void StrSetAllocator(const StrAllocator* const alloc);
+const StrAllocator* StrGetAllocator(void);
+Str* StrNewWithAllocator(const StrAllocator* const alloc, const char* const cs);
+Str* StrNewSetCapWithAllocator(const StrAllocator* alloc, const size_t initCap);
+
+/* Arena functions */
+StrArena* StrArenaNew(const size_t chunkSize);
+void StrArenaReset(StrArena* const a);
+void StrArenaDel(StrArena* const a);
+const StrAllocator* StrArenaAllocator(StrArena* const a);
+Str* StrNewInArena(StrArena* const a, const char* const cs);
+Str* StrNewFromBytesInArena(StrArena* const a, const char* const cs,
+	const size_t n);
+Str* StrNewSetCapInArena(StrArena* const a, const size_t initCap);
+Str* StrNewFromViewInArena(StrArena* const a, const StrView v);
+Str* StrCopyInArena(StrArena* const a, const Str* const s);
+Str* StrSliceInArena(StrArena* const a, const Str* const s, const size_t first,
+	const size_t last);
+Str* StrTakeInArena(StrArena* const a, const Str* const s, const size_t n);
+Str* StrDropInArena(StrArena* const a, const Str* const s, const size_t n);
+Str* StrTakeWhileInArena(StrArena* const a, const Str* const s,
+	int (*p)(unsigned int));
+Str* StrDropWhileInArena(StrArena* const a, const Str* const s,
+	int (*p)(unsigned int));
+Str* StrReverseInArena(StrArena* const a, const Str* const s);
+Str* StrReplaceAllInArena(StrArena* const a, const Str* const s,
+	const Str* const from, const Str* const to);
+Str* StrToLowerInArena(StrArena* const a, const Str* const s);
+Str* StrToUpperInArena(StrArena* const a, const Str* const s);
+Str* StrCaseFoldInArena(StrArena* const a, const Str* const s);
+Str* StrNormalizeInArena(StrArena* const a, const Str* const s, const int form);
+
 /* Non-mutating functions */
+int StrValidate(const char* const cs, const size_t n, size_t* const errOffset);
 int StrIsNull(const Str* const s);
 int StrEqual(const Str* const s, const Str* const t);
+int StrCompare(const Str* const s, const Str* const t, size_t* const diffIndex);
+int StrCompareFold(const Str* const s, const Str* const t);
+int StrEqualFold(const Str* const s, const Str* const t);
+int StrIsNormalized(const Str* const s, const int form);
 int StrStartsWith(const Str* const s, const Str* const t);
 int StrEndsWith(const Str* const s, const Str* const t);
+uint64_t StrHash(const Str* const s, const uint64_t seed);
 size_t StrLength(const Str* const s);
 size_t StrFindChar(const Str* const s, const unsigned int c);
+size_t StrCountChar(const Str* const s, const unsigned int c);
+size_t StrDecodeUTF32(const Str* const s, uint32_t* const out,
+	const size_t cap);
+size_t StrToUTF16(const Str* const s, uint16_t* const out, const size_t cap,
+	size_t* const errOffset);
+size_t StrToLatin1(const Str* const s, char* const out, const size_t cap,
+	size_t* const errOffset);
+size_t StrFind(const Str* const s, const Str* const needle, const size_t from,
+	size_t* const byteOffset);
+size_t StrFindLast(const Str* const s, const Str* const needle,
+	const size_t end, size_t* const byteOffset);
+size_t StrCharToByte(const Str* const s, const size_t index);
+size_t StrByteToChar(const Str* const s, const size_t offset);
 unsigned int StrAt(const Str* const s, const size_t index);
 unsigned int StrFirst(const Str* const s);
 unsigned int StrLast(const Str* const s);
@@ -46,19 +201,177 @@ Str* StrDrop(const Str* const s, const size_t n);
 Str* StrTakeWhile(const Str* const s, int (*p)(unsigned int));
 Str* StrDropWhile(const Str* const s, int (*p)(unsigned int));
 Str* StrReverse(const Str* const s);
+Str* StrReplaceAll(const Str* const s, const Str* const from,
+	const Str* const to);
+Str* StrToLower(const Str* const s);
+Str* StrToUpper(const Str* const s);
+Str* StrCaseFold(const Str* const s);
+Str* StrNormalize(const Str* const s, const int form);
 
 /* Mutating functions */
 int StrAddChar(Str* const s, const unsigned int c);
 int StrAddChars(Str* const s, const char* cs);
+int StrAddBytes(Str* const s, const char* const cs, const size_t n);
+int StrAddCharsStrict(Str* const s, const char* cs);
+int StrAddBytesStrict(Str* const s, const char* const cs, const size_t n);
 int StrAdd(Str* const s, const Str* const t);
+int StrAddCodepoints(Str* const s, const uint32_t* const cps, const size_t n);
 int StrTrim(Str* const s, size_t n);
+int StrInsert(Str* const s, const size_t index, const Str* const t);
+int StrErase(Str* const s, const size_t first, size_t last);
+int StrReplaceRange(Str* const s, const size_t first, size_t last,
+	const Str* const t);
+int StrReplaceAllInPlace(Str* const s, const Str* const from,
+	const Str* const to);
+int StrSetGrowth(Str* const s, const int growth);
+int StrReserve(Str* const s, const size_t n);
+int StrShrinkToFit(Str* const s);
+int StrShare(Str* const s);
 
 /* Iterator functions */
 StrIter* StrIterNew(const Str* const s);
 void StrIterDel(StrIter* it);
-int StrIterHasNext(const StrIter* const it);
-unsigned int StrIterNext(StrIter* const it);
-int StrIterHasPrev(const StrIter* const it);
-unsigned int StrIterPrev(StrIter* const it);
+
+/* Initialize the caller-provided iterator it to the start of s. No memory is
+ * allocated, and it must not be passed to StrIterDel. */
+static inline void StrIterInit(StrIter* const it, const Str* const s) {
+	it->str = s;
+	it->cs = s->arr;
+	it->alloc = 0;
+}
+
+/* Returns 1 if there are more characters left to be iterated over forwards in
+ * the underlying string, otherwise 0. */
+static inline int StrIterHasNext(const StrIter* const it) {
+	return it->cs < it->str->arr + it->str->size - 1;
+}
+
+/* Decode the character at the start of the valid UTF-8 at cs, storing its size
+ * in bytes in *n. */
+static inline unsigned int StrIterDecode(const char* const cs, size_t* const n)
+{
+	const unsigned char* const p = (const unsigned char*)cs;
+	if (p[0] < 0x80) {
+		*n = 1;
+		return p[0];
+	}
+	if (p[0] < 0xe0) {
+		*n = 2;
+		return ((p[0] & 0x1f) << 6) | (p[1] & 0x3f);
+	}
+	if (p[0] < 0xf0) {
+		*n = 3;
+		return ((p[0] & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+	}
+	*n = 4;
+	return ((p[0] & 0x07) << 18) | ((p[1] & 0x3f) << 12) |
+		((p[2] & 0x3f) << 6) | (p[3] & 0x3f);
+}
+
+/* If there are more characters to be iterated over forwards, returns the next
+ * character, then increments the iterator; otherwise returns 0. */
+static inline unsigned int StrIterNext(StrIter* const it) {
+	size_t n;
+	unsigned int c;
+	if (!StrIterHasNext(it)) return 0;
+	c = StrIterDecode(it->cs, &n);
+	it->cs += n;
+	return c;
+}
+
+/* Returns 1 if there are more characters left to be iterated over backwards in
+ * the underlying string, otherwise 0. */
+static inline int StrIterHasPrev(const StrIter* const it) {
+	return it->cs > it->str->arr;
+}
+
+/* If there are more characters to be iterated over backwards, returns the
+ * previous character, then decrements the iterator; otherwise returns 0. */
+static inline unsigned int StrIterPrev(StrIter* const it) {
+	size_t n;
+	if (!StrIterHasPrev(it)) return 0;
+	do { --it->cs; } while ((*it->cs & 0xc0) == 0x80);
+	return StrIterDecode(it->cs, &n);
+}
+
+/* Loop over the characters of the Str s, assigning each in turn to the
+ * unsigned int c, using the StrIter it (both declared by the caller) as the
+ * cursor. Nothing is allocated, and the body may break out of the loop. */
+#define STR_FOREACH(c, it, s) \
+	for (StrIterInit(&(it), (s)); \
+		StrIterHasNext(&(it)) && ((c) = StrIterNext(&(it)), 1); )
+
+/* View functions */
+StrView StrViewOf(const Str* const s);
+StrView StrViewSlice(const Str* const s, const size_t first, const size_t last);
+StrView StrViewTake(const Str* const s, const size_t n);
+StrView StrViewDrop(const Str* const s, const size_t n);
+StrView StrViewTakeWhile(const Str* const s, int (*p)(unsigned int));
+StrView StrViewDropWhile(const Str* const s, int (*p)(unsigned int));
+int StrViewIsNull(const StrView v);
+int StrViewEqual(const StrView v, const StrView w);
+int StrViewCompare(const StrView v, const StrView w, size_t* const diffIndex);
+int StrViewStartsWith(const StrView v, const StrView w);
+int StrViewEndsWith(const StrView v, const StrView w);
+size_t StrViewFindChar(const StrView v, const unsigned int c);
+unsigned int StrViewNext(StrView* const v);
+unsigned int StrViewPrev(StrView* const v);
+Str* StrNewFromView(const StrView v);
+int StrAddView(Str* const s, const StrView v);
+
+/* Matcher functions */
+StrMatcher* StrMatcherNew(const Str* const* const patterns, const size_t n);
+void StrMatcherDel(StrMatcher* const m);
+size_t StrMatcherRun(const StrMatcher* const m, const Str* const s,
+	int (*callback)(void* ctx, const StrMatch* match), void* const ctx);
+size_t StrMatcherFind(const StrMatcher* const m, const Str* const s,
+	StrMatch* const matches, const size_t max);
+
+/* Rope functions */
+StrRope* StrRopeNew(void);
+StrRope* StrRopeNewWithAllocator(const StrAllocator* alloc);
+StrRope* StrRopeNewFromStr(const Str* const s);
+void StrRopeDel(StrRope* const r);
+size_t StrRopeLength(const StrRope* const r);
+size_t StrRopeSize(const StrRope* const r);
+size_t StrRopeDepth(const StrRope* const r);
+unsigned int StrRopeAt(const StrRope* const r, const size_t index);
+Str* StrRopeToStr(const StrRope* const r);
+int StrRopeInsert(StrRope* const r, const size_t index, const char* const cs,
+	const size_t n);
+int StrRopeErase(StrRope* const r, const size_t first, const size_t last);
+void StrRopeConcat(StrRope* const r, StrRope* const t);
+StrRope* StrRopeSplit(StrRope* const r, const size_t index);
+void StrRopeIterInit(StrRopeIter* const it, const StrRope* const r);
+int StrRopeIterNext(StrRopeIter* const it, StrView* const v);
+
+/* Gap buffer functions */
+StrGap* StrGapNew(const Str* const s);
+void StrGapDel(StrGap* const g);
+size_t StrGapLength(const StrGap* const g);
+size_t StrGapCursor(const StrGap* const g);
+int StrGapInsert(StrGap* const g, const char* const cs, const size_t n);
+size_t StrGapDelete(StrGap* const g, const size_t n);
+size_t StrGapBackspace(StrGap* const g, const size_t n);
+size_t StrGapForward(StrGap* const g, const size_t n);
+size_t StrGapBack(StrGap* const g, const size_t n);
+void StrGapSeek(StrGap* const g, const size_t index);
+StrView StrGapBefore(const StrGap* const g);
+StrView StrGapAfter(const StrGap* const g);
+Str* StrGapFlatten(StrGap* const g);
+
+/* Intern table functions */
+StrInternTable* StrInternTableNew(void);
+void StrInternTableDel(StrInternTable* const t);
+size_t StrInternTableCount(const StrInternTable* const t);
+const Str* StrInternView(StrInternTable* const t, const StrView v);
+const Str* StrIntern(StrInternTable* const t, const Str* const s);
+const Str* StrInternFind(const StrInternTable* const t, const Str* const s);
+
+/* Sort functions */
+void StrSort(Str** const v, const size_t n);
+int StrSortStable(Str** const v, const size_t n);
+void StrSortParallel(Str** const v, const size_t n, unsigned int threads);
+size_t StrUnique(Str** const v, const size_t n);
 
 #endif
@@ -0,0 +1,8457 @@
+/* Generated by tools/gen_tables.py from Unicode 14.0.0. Do not edit. */
+/* Private to utf8str.c */
+
+#ifndef __NIKOLASHN_UTF8TABLES_H
+#define __NIKOLASHN_UTF8TABLES_H
+
+#define UNICODE_VERSION "14.0.0"
+
+/* Case mappings, looked up by caseStage2[(caseStage1[c >> 7] << 7) |
+ * (c & 127)] for c < CASE_LIMIT, which is the index of a record of the
+ * lower, upper and fold mappings of c. Each is either a difference to add
+ * to c, or CASE_LONG + i, where caseLong[i] is the amount of code points
+ * of the mapping, which follow it. */
+
+#define CASE_SHIFT 7
+#define CASE_LIMIT 0x1e980
+#define CASE_LONG 0x40000000
+
+static const unsigned char caseStage1[979] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 12, 12,
+	12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 15, 16, 17,
+	18, 19, 20, 21, 12, 12, 22, 23, 12, 12, 12, 12,
+	12, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 25, 26, 27, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 28, 29, 30, 31,
+	12, 12, 12, 12, 12, 12, 32, 33, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 34, 12,
+	12, 12, 12, 12, 12, 12, 35, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 36, 37, 38, 39, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 40, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 41, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	42, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 43,
+};
+
+static const uint16_t caseStage2[5632] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+	1, 1, 1, 1, 1, 1, 1, 4, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 5, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 8, 9, 6, 7, 6, 7, 6, 7,
+	0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 10, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+	13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6,
+	7, 0, 17, 18, 19, 6, 7, 16, 20, 21, 22, 23,
+	6, 7, 24, 0, 22, 25, 26, 27, 6, 7, 6, 7,
+	6, 7, 28, 6, 7, 28, 0, 0, 6, 7, 28, 6,
+	7, 29, 29, 6, 7, 6, 7, 30, 6, 7, 0, 0,
+	6, 7, 0, 31, 0, 0, 0, 0, 32, 33, 34, 32,
+	33, 34, 32, 33, 34, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 6, 7, 35, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 36, 32, 33, 34, 6, 7, 37, 38,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 39, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 0, 0, 0, 0, 40, 6, 7, 41, 42, 43,
+	43, 6, 7, 44, 45, 46, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 47, 48, 49, 50, 51, 0, 52, 52,
+	0, 53, 0, 54, 55, 0, 0, 0, 52, 56, 0, 57,
+	0, 58, 59, 0, 60, 61, 59, 62, 63, 0, 0, 61,
+	0, 64, 65, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+	0, 67, 0, 0, 68, 0, 69, 68, 0, 0, 0, 70,
+	68, 71, 72, 72, 73, 0, 0, 0, 0, 0, 74, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 7, 6, 7, 0, 0, 6, 7,
+	0, 0, 0, 26, 26, 26, 0, 78, 0, 0, 0, 0,
+	0, 0, 79, 0, 80, 80, 80, 0, 81, 0, 82, 82,
+	83, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 84, 85, 85, 85, 86, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 87, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	88, 89, 89, 90, 91, 92, 0, 0, 0, 93, 94, 95,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	96, 97, 98, 99, 100, 101, 0, 6, 7, 102, 6, 7,
+	0, 39, 39, 39, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+	104, 104, 104, 104, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 105, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 106, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 0, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 109,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 0, 110, 0, 0, 0, 0,
+	0, 110, 0, 0, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 0,
+	0, 111, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 113, 113, 113, 113,
+	113, 113, 0, 0, 114, 114, 114, 114, 114, 114, 0, 0,
+	115, 116, 117, 118, 118, 119, 120, 121, 122, 0, 0, 0,
+	0, 0, 0, 0, 123, 123, 123, 123, 123, 123, 123, 123,
+	123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+	123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+	123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 0,
+	0, 123, 123, 123, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0,
+	0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 127, 128, 129, 130, 131, 132,
+	0, 0, 133, 0, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 134, 134, 134, 134, 134, 134, 134, 134,
+	135, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134,
+	134, 134, 0, 0, 135, 135, 135, 135, 135, 135, 0, 0,
+	134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135,
+	135, 135, 135, 135, 134, 134, 134, 134, 134, 134, 134, 134,
+	135, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134,
+	134, 134, 0, 0, 135, 135, 135, 135, 135, 135, 0, 0,
+	136, 134, 137, 134, 138, 134, 139, 134, 0, 135, 0, 135,
+	0, 135, 0, 135, 134, 134, 134, 134, 134, 134, 134, 134,
+	135, 135, 135, 135, 135, 135, 135, 135, 140, 140, 141, 141,
+	141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 0, 0,
+	146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+	158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+	170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+	182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+	134, 134, 194, 195, 196, 0, 197, 198, 135, 135, 199, 199,
+	200, 0, 201, 0, 0, 0, 202, 203, 204, 0, 205, 206,
+	207, 207, 207, 207, 208, 0, 0, 0, 134, 134, 209, 83,
+	0, 0, 210, 211, 135, 135, 212, 212, 0, 0, 0, 0,
+	134, 134, 213, 86, 214, 98, 215, 216, 135, 135, 217, 217,
+	102, 0, 0, 0, 0, 0, 218, 219, 220, 0, 221, 222,
+	223, 223, 224, 224, 225, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 226, 0,
+	0, 0, 227, 228, 0, 0, 0, 0, 0, 0, 229, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 231, 231, 231, 231,
+	231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+	232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+	232, 232, 232, 232, 0, 0, 0, 6, 7, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+	233, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+	234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 6, 7, 235, 236,
+	237, 238, 239, 6, 7, 6, 7, 6, 7, 240, 241, 242,
+	243, 0, 6, 7, 0, 6, 7, 0, 0, 0, 0, 0,
+	0, 0, 244, 244, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 6, 7, 6, 7, 0, 0, 0, 6, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+	245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+	245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+	245, 245, 0, 245, 0, 0, 0, 0, 0, 245, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 7, 6, 7, 246, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 6, 7, 247, 0, 0,
+	6, 7, 6, 7, 248, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 249, 250, 251, 252, 249, 0, 253, 254, 255, 256,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 257, 258, 259, 6, 7, 6, 7, 0,
+	0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 6, 7,
+	6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+	261, 261, 261, 261, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 262, 263, 264, 265,
+	266, 267, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 268, 269, 270, 271, 272, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 0, 0, 0, 0,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 275, 275, 275, 275,
+	275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 275, 275,
+	275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
+	275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 0, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 0, 276,
+	276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+	276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 0, 276,
+	276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+	277, 277, 277, 277, 277, 277, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+	278, 278, 278, 278, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0,
+};
+
+static const int32_t caseRecords[279][3] = {
+	{ 0, 0, 0 },
+	{ 32, 0, 32 },
+	{ 0, -32, 0 },
+	{ 0, 743, 775 },
+	{ 0, 1073741824, 1073741827 },
+	{ 0, 121, 0 },
+	{ 1, 0, 1 },
+	{ 0, -1, 0 },
+	{ 1073741830, 0, 1073741830 },
+	{ 0, -232, 0 },
+	{ 0, 1073741833, 1073741836 },
+	{ -121, 0, -121 },
+	{ 0, -300, -268 },
+	{ 0, 195, 0 },
+	{ 210, 0, 210 },
+	{ 206, 0, 206 },
+	{ 205, 0, 205 },
+	{ 79, 0, 79 },
+	{ 202, 0, 202 },
+	{ 203, 0, 203 },
+	{ 207, 0, 207 },
+	{ 0, 97, 0 },
+	{ 211, 0, 211 },
+	{ 209, 0, 209 },
+	{ 0, 163, 0 },
+	{ 213, 0, 213 },
+	{ 0, 130, 0 },
+	{ 214, 0, 214 },
+	{ 218, 0, 218 },
+	{ 217, 0, 217 },
+	{ 219, 0, 219 },
+	{ 0, 56, 0 },
+	{ 2, 0, 2 },
+	{ 1, -1, 1 },
+	{ 0, -2, 0 },
+	{ 0, -79, 0 },
+	{ 0, 1073741839, 1073741842 },
+	{ -97, 0, -97 },
+	{ -56, 0, -56 },
+	{ -130, 0, -130 },
+	{ 10795, 0, 10795 },
+	{ -163, 0, -163 },
+	{ 10792, 0, 10792 },
+	{ 0, 10815, 0 },
+	{ -195, 0, -195 },
+	{ 69, 0, 69 },
+	{ 71, 0, 71 },
+	{ 0, 10783, 0 },
+	{ 0, 10780, 0 },
+	{ 0, 10782, 0 },
+	{ 0, -210, 0 },
+	{ 0, -206, 0 },
+	{ 0, -205, 0 },
+	{ 0, -202, 0 },
+	{ 0, -203, 0 },
+	{ 0, 42319, 0 },
+	{ 0, 42315, 0 },
+	{ 0, -207, 0 },
+	{ 0, 42280, 0 },
+	{ 0, 42308, 0 },
+	{ 0, -209, 0 },
+	{ 0, -211, 0 },
+	{ 0, 10743, 0 },
+	{ 0, 42305, 0 },
+	{ 0, 10749, 0 },
+	{ 0, -213, 0 },
+	{ 0, -214, 0 },
+	{ 0, 10727, 0 },
+	{ 0, -218, 0 },
+	{ 0, 42307, 0 },
+	{ 0, 42282, 0 },
+	{ 0, -69, 0 },
+	{ 0, -217, 0 },
+	{ 0, -71, 0 },
+	{ 0, -219, 0 },
+	{ 0, 42261, 0 },
+	{ 0, 42258, 0 },
+	{ 0, 84, 116 },
+	{ 116, 0, 116 },
+	{ 38, 0, 38 },
+	{ 37, 0, 37 },
+	{ 64, 0, 64 },
+	{ 63, 0, 63 },
+	{ 0, 1073741845, 1073741849 },
+	{ 0, -38, 0 },
+	{ 0, -37, 0 },
+	{ 0, 1073741853, 1073741857 },
+	{ 0, -31, 1 },
+	{ 0, -64, 0 },
+	{ 0, -63, 0 },
+	{ 8, 0, 8 },
+	{ 0, -62, -30 },
+	{ 0, -57, -25 },
+	{ 0, -47, -15 },
+	{ 0, -54, -22 },
+	{ 0, -8, 0 },
+	{ 0, -86, -54 },
+	{ 0, -80, -48 },
+	{ 0, 7, 0 },
+	{ 0, -116, 0 },
+	{ -60, 0, -60 },
+	{ 0, -96, -64 },
+	{ -7, 0, -7 },
+	{ 80, 0, 80 },
+	{ 0, -80, 0 },
+	{ 15, 0, 15 },
+	{ 0, -15, 0 },
+	{ 48, 0, 48 },
+	{ 0, -48, 0 },
+	{ 0, 1073741861, 1073741864 },
+	{ 7264, 0, 7264 },
+	{ 0, 3008, 0 },
+	{ 38864, 0, 0 },
+	{ 8, 0, 0 },
+	{ 0, -8, -8 },
+	{ 0, -6254, -6222 },
+	{ 0, -6253, -6221 },
+	{ 0, -6244, -6212 },
+	{ 0, -6242, -6210 },
+	{ 0, -6243, -6211 },
+	{ 0, -6236, -6204 },
+	{ 0, -6181, -6180 },
+	{ 0, 35266, 35267 },
+	{ -3008, 0, -3008 },
+	{ 0, 35332, 0 },
+	{ 0, 3814, 0 },
+	{ 0, 35384, 0 },
+	{ 0, 1073741867, 1073741870 },
+	{ 0, 1073741873, 1073741876 },
+	{ 0, 1073741879, 1073741882 },
+	{ 0, 1073741885, 1073741888 },
+	{ 0, 1073741891, 1073741894 },
+	{ 0, -59, -58 },
+	{ -7615, 0, 1073741827 },
+	{ 0, 8, 0 },
+	{ -8, 0, -8 },
+	{ 0, 1073741897, 1073741900 },
+	{ 0, 1073741903, 1073741907 },
+	{ 0, 1073741911, 1073741915 },
+	{ 0, 1073741919, 1073741923 },
+	{ 0, 74, 0 },
+	{ 0, 86, 0 },
+	{ 0, 100, 0 },
+	{ 0, 128, 0 },
+	{ 0, 112, 0 },
+	{ 0, 126, 0 },
+	{ 0, 1073741927, 1073741930 },
+	{ 0, 1073741933, 1073741936 },
+	{ 0, 1073741939, 1073741942 },
+	{ 0, 1073741945, 1073741948 },
+	{ 0, 1073741951, 1073741954 },
+	{ 0, 1073741957, 1073741960 },
+	{ 0, 1073741963, 1073741966 },
+	{ 0, 1073741969, 1073741972 },
+	{ -8, 1073741927, 1073741930 },
+	{ -8, 1073741933, 1073741936 },
+	{ -8, 1073741939, 1073741942 },
+	{ -8, 1073741945, 1073741948 },
+	{ -8, 1073741951, 1073741954 },
+	{ -8, 1073741957, 1073741960 },
+	{ -8, 1073741963, 1073741966 },
+	{ -8, 1073741969, 1073741972 },
+	{ 0, 1073741975, 1073741978 },
+	{ 0, 1073741981, 1073741984 },
+	{ 0, 1073741987, 1073741990 },
+	{ 0, 1073741993, 1073741996 },
+	{ 0, 1073741999, 1073742002 },
+	{ 0, 1073742005, 1073742008 },
+	{ 0, 1073742011, 1073742014 },
+	{ 0, 1073742017, 1073742020 },
+	{ -8, 1073741975, 1073741978 },
+	{ -8, 1073741981, 1073741984 },
+	{ -8, 1073741987, 1073741990 },
+	{ -8, 1073741993, 1073741996 },
+	{ -8, 1073741999, 1073742002 },
+	{ -8, 1073742005, 1073742008 },
+	{ -8, 1073742011, 1073742014 },
+	{ -8, 1073742017, 1073742020 },
+	{ 0, 1073742023, 1073742026 },
+	{ 0, 1073742029, 1073742032 },
+	{ 0, 1073742035, 1073742038 },
+	{ 0, 1073742041, 1073742044 },
+	{ 0, 1073742047, 1073742050 },
+	{ 0, 1073742053, 1073742056 },
+	{ 0, 1073742059, 1073742062 },
+	{ 0, 1073742065, 1073742068 },
+	{ -8, 1073742023, 1073742026 },
+	{ -8, 1073742029, 1073742032 },
+	{ -8, 1073742035, 1073742038 },
+	{ -8, 1073742041, 1073742044 },
+	{ -8, 1073742047, 1073742050 },
+	{ -8, 1073742053, 1073742056 },
+	{ -8, 1073742059, 1073742062 },
+	{ -8, 1073742065, 1073742068 },
+	{ 0, 1073742071, 1073742074 },
+	{ 0, 1073742077, 1073742080 },
+	{ 0, 1073742083, 1073742086 },
+	{ 0, 1073742089, 1073742092 },
+	{ 0, 1073742095, 1073742099 },
+	{ -74, 0, -74 },
+	{ -9, 1073742077, 1073742080 },
+	{ 0, -7205, -7173 },
+	{ 0, 1073742103, 1073742106 },
+	{ 0, 1073742109, 1073742112 },
+	{ 0, 1073742115, 1073742118 },
+	{ 0, 1073742121, 1073742124 },
+	{ 0, 1073742127, 1073742131 },
+	{ -86, 0, -86 },
+	{ -9, 1073742109, 1073742112 },
+	{ 0, 1073742135, 1073742139 },
+	{ 0, 1073742143, 1073742146 },
+	{ 0, 1073742149, 1073742153 },
+	{ -100, 0, -100 },
+	{ 0, 1073742157, 1073742161 },
+	{ 0, 1073742165, 1073742168 },
+	{ 0, 1073742171, 1073742174 },
+	{ 0, 1073742177, 1073742181 },
+	{ -112, 0, -112 },
+	{ 0, 1073742185, 1073742188 },
+	{ 0, 1073742191, 1073742194 },
+	{ 0, 1073742197, 1073742200 },
+	{ 0, 1073742203, 1073742206 },
+	{ 0, 1073742209, 1073742213 },
+	{ -128, 0, -128 },
+	{ -126, 0, -126 },
+	{ -9, 1073742191, 1073742194 },
+	{ -7517, 0, -7517 },
+	{ -8383, 0, -8383 },
+	{ -8262, 0, -8262 },
+	{ 28, 0, 28 },
+	{ 0, -28, 0 },
+	{ 16, 0, 16 },
+	{ 0, -16, 0 },
+	{ 26, 0, 26 },
+	{ 0, -26, 0 },
+	{ -10743, 0, -10743 },
+	{ -3814, 0, -3814 },
+	{ -10727, 0, -10727 },
+	{ 0, -10795, 0 },
+	{ 0, -10792, 0 },
+	{ -10780, 0, -10780 },
+	{ -10749, 0, -10749 },
+	{ -10783, 0, -10783 },
+	{ -10782, 0, -10782 },
+	{ -10815, 0, -10815 },
+	{ 0, -7264, 0 },
+	{ -35332, 0, -35332 },
+	{ -42280, 0, -42280 },
+	{ 0, 48, 0 },
+	{ -42308, 0, -42308 },
+	{ -42319, 0, -42319 },
+	{ -42315, 0, -42315 },
+	{ -42305, 0, -42305 },
+	{ -42258, 0, -42258 },
+	{ -42282, 0, -42282 },
+	{ -42261, 0, -42261 },
+	{ 928, 0, 928 },
+	{ -48, 0, -48 },
+	{ -42307, 0, -42307 },
+	{ -35384, 0, -35384 },
+	{ 0, -928, 0 },
+	{ 0, -38864, -38864 },
+	{ 0, 1073742217, 1073742220 },
+	{ 0, 1073742223, 1073742226 },
+	{ 0, 1073742229, 1073742232 },
+	{ 0, 1073742235, 1073742239 },
+	{ 0, 1073742243, 1073742247 },
+	{ 0, 1073742251, 1073742254 },
+	{ 0, 1073742257, 1073742260 },
+	{ 0, 1073742263, 1073742266 },
+	{ 0, 1073742269, 1073742272 },
+	{ 0, 1073742275, 1073742278 },
+	{ 0, 1073742281, 1073742284 },
+	{ 40, 0, 40 },
+	{ 0, -40, 0 },
+	{ 39, 0, 39 },
+	{ 0, -39, 0 },
+	{ 34, 0, 34 },
+	{ 0, -34, 0 },
+};
+
+static const uint32_t caseLong[463] = {
+	2, 83, 83, 2, 115, 115, 2, 105, 775, 2, 700, 78,
+	2, 700, 110, 2, 74, 780, 2, 106, 780, 3, 921, 776,
+	769, 3, 953, 776, 769, 3, 933, 776, 769, 3, 965, 776,
+	769, 2, 1333, 1362, 2, 1381, 1410, 2, 72, 817, 2, 104,
+	817, 2, 84, 776, 2, 116, 776, 2, 87, 778, 2, 119,
+	778, 2, 89, 778, 2, 121, 778, 2, 65, 702, 2, 97,
+	702, 2, 933, 787, 2, 965, 787, 3, 933, 787, 768, 3,
+	965, 787, 768, 3, 933, 787, 769, 3, 965, 787, 769, 3,
+	933, 787, 834, 3, 965, 787, 834, 2, 7944, 921, 2, 7936,
+	953, 2, 7945, 921, 2, 7937, 953, 2, 7946, 921, 2, 7938,
+	953, 2, 7947, 921, 2, 7939, 953, 2, 7948, 921, 2, 7940,
+	953, 2, 7949, 921, 2, 7941, 953, 2, 7950, 921, 2, 7942,
+	953, 2, 7951, 921, 2, 7943, 953, 2, 7976, 921, 2, 7968,
+	953, 2, 7977, 921, 2, 7969, 953, 2, 7978, 921, 2, 7970,
+	953, 2, 7979, 921, 2, 7971, 953, 2, 7980, 921, 2, 7972,
+	953, 2, 7981, 921, 2, 7973, 953, 2, 7982, 921, 2, 7974,
+	953, 2, 7983, 921, 2, 7975, 953, 2, 8040, 921, 2, 8032,
+	953, 2, 8041, 921, 2, 8033, 953, 2, 8042, 921, 2, 8034,
+	953, 2, 8043, 921, 2, 8035, 953, 2, 8044, 921, 2, 8036,
+	953, 2, 8045, 921, 2, 8037, 953, 2, 8046, 921, 2, 8038,
+	953, 2, 8047, 921, 2, 8039, 953, 2, 8122, 921, 2, 8048,
+	953, 2, 913, 921, 2, 945, 953, 2, 902, 921, 2, 940,
+	953, 2, 913, 834, 2, 945, 834, 3, 913, 834, 921, 3,
+	945, 834, 953, 2, 8138, 921, 2, 8052, 953, 2, 919, 921,
+	2, 951, 953, 2, 905, 921, 2, 942, 953, 2, 919, 834,
+	2, 951, 834, 3, 919, 834, 921, 3, 951, 834, 953, 3,
+	921, 776, 768, 3, 953, 776, 768, 2, 921, 834, 2, 953,
+	834, 3, 921, 776, 834, 3, 953, 776, 834, 3, 933, 776,
+	768, 3, 965, 776, 768, 2, 929, 787, 2, 961, 787, 2,
+	933, 834, 2, 965, 834, 3, 933, 776, 834, 3, 965, 776,
+	834, 2, 8186, 921, 2, 8060, 953, 2, 937, 921, 2, 969,
+	953, 2, 911, 921, 2, 974, 953, 2, 937, 834, 2, 969,
+	834, 3, 937, 834, 921, 3, 969, 834, 953, 2, 70, 70,
+	2, 102, 102, 2, 70, 73, 2, 102, 105, 2, 70, 76,
+	2, 102, 108, 3, 70, 70, 73, 3, 102, 102, 105, 3,
+	70, 70, 76, 3, 102, 102, 108, 2, 83, 84, 2, 115,
+	116, 2, 1348, 1350, 2, 1396, 1398, 2, 1348, 1333, 2, 1396,
+	1381, 2, 1348, 1339, 2, 1396, 1387, 2, 1358, 1350, 2, 1406,
+	1398, 2, 1348, 1341, 2, 1396, 1389,
+};
+
+/* Normalization properties, looked up by normStage2[(normStage1[c >> 7]
+ * << 7) | (c & 127)] for c < NORM_LIMIT, which is the index of a record of
+ * the canonical combining class of c, its quick check values, two bits for
+ * each of NFC, NFD, NFKC and NFKD in turn (0 for yes, 1 for no and 2 for
+ * maybe), and the offsets of its full canonical and compatibility
+ * decompositions in normDecomp (or 0 if c decomposes to itself, or is a
+ * Hangul syllable), where normDecomp[i] is the amount of code points of the
+ * decomposition, which follow it. */
+
+#define NORM_SHIFT 7
+#define NORM_LIMIT 0x2fa80
+
+static const uint16_t normStage1[1525] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10,
+	11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+	23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+	0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+	0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 0,
+	59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+	70, 71, 72, 73, 74, 75, 76, 77, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 80, 81,
+	82, 83, 84, 85, 0, 86, 87, 88, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+	89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 90,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 91, 92, 93, 94, 95, 96,
+	97, 98, 99, 100, 101, 102, 103, 104, 0, 0, 0, 105,
+	0, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0, 108,
+	0, 0, 0, 0, 109, 110, 0, 0, 0, 0, 111, 0,
+	0, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 0,
+	122, 123, 0, 124, 125, 126, 127, 0, 128, 0, 129, 130,
+	131, 132, 0, 0, 125, 0, 133, 134, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 135, 136, 0, 0, 0, 0, 0,
+	0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 139, 140, 141, 0, 0, 0,
+	142, 143, 144, 145, 146, 147, 148, 149, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	150, 0, 136, 0, 0, 151, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 152, 153, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 154, 155, 0, 0, 0, 0, 156, 157,
+	158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 160, 161, 162, 163,
+	164,
+};
+
+static const uint16_t normStage2[21120] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 3, 0, 0, 0, 0, 4, 0, 0, 5, 6,
+	7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+	15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25,
+	26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 0,
+	0, 36, 37, 38, 39, 40, 0, 0, 41, 42, 43, 44,
+	45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+	0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64,
+	65, 66, 0, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+	76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85,
+	86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+	98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107,
+	108, 109, 110, 111, 112, 0, 113, 114, 115, 116, 117, 118,
+	0, 119, 120, 121, 122, 123, 124, 125, 126, 0, 0, 127,
+	128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+	138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147,
+	148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 0, 0,
+	158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+	170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 182, 183, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+	185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 186, 187, 188, 189,
+	190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+	202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+	213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222,
+	223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 0, 0,
+	233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+	245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+	257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+	0, 0, 269, 270, 0, 0, 0, 0, 0, 0, 271, 272,
+	273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 285, 286, 287, 288, 289, 290, 291, 292,
+	293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297,
+	298, 299, 0, 0, 300, 301, 181, 302, 303, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 304, 304, 304, 304, 305, 304, 304, 304, 304, 304, 304,
+	304, 305, 305, 304, 305, 304, 305, 304, 304, 306, 307, 307,
+	307, 307, 306, 308, 307, 307, 307, 307, 307, 309, 309, 310,
+	310, 310, 310, 311, 311, 307, 307, 307, 307, 310, 310, 307,
+	310, 310, 307, 307, 312, 312, 312, 312, 313, 307, 307, 307,
+	307, 305, 305, 305, 314, 315, 304, 316, 317, 318, 305, 307,
+	307, 307, 305, 305, 305, 307, 307, 0, 305, 305, 305, 307,
+	307, 307, 307, 305, 306, 307, 307, 305, 319, 320, 320, 319,
+	320, 320, 319, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 0, 0, 0, 0, 321, 0, 0, 0,
+	0, 0, 322, 0, 0, 0, 323, 0, 0, 0, 0, 0,
+	7, 324, 325, 326, 327, 328, 329, 0, 330, 0, 331, 332,
+	333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 334, 335, 336, 337, 338, 339, 340, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 342,
+	343, 344, 345, 0, 346, 347, 348, 349, 350, 351, 352, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	353, 354, 355, 0, 356, 357, 0, 0, 0, 358, 0, 0,
+	0, 0, 0, 0, 359, 360, 0, 361, 0, 0, 0, 362,
+	0, 0, 0, 0, 363, 364, 365, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 366, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	368, 369, 0, 370, 0, 0, 0, 371, 0, 0, 0, 0,
+	372, 373, 374, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 375, 376, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 377, 378, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 379, 380, 381, 382,
+	0, 0, 383, 384, 0, 0, 385, 386, 387, 388, 389, 390,
+	0, 0, 391, 392, 393, 394, 395, 396, 0, 0, 397, 398,
+	399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 0, 0,
+	409, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 411, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 307, 305, 305, 305, 305, 307, 305, 305, 305, 412, 307,
+	305, 305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 307,
+	305, 305, 307, 305, 305, 412, 413, 305, 414, 415, 416, 417,
+	418, 419, 420, 421, 422, 423, 423, 424, 425, 426, 0, 427,
+	0, 428, 429, 0, 305, 307, 0, 422, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+	305, 305, 305, 305, 430, 431, 432, 0, 0, 0, 0, 0,
+	0, 0, 433, 434, 435, 436, 437, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 438, 439, 440, 430, 431,
+	432, 441, 442, 304, 304, 310, 307, 305, 305, 305, 305, 305,
+	307, 305, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 443, 0, 0, 0,
+	0, 444, 445, 446, 447, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 448, 0, 449, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 450,
+	0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 305,
+	305, 305, 305, 307, 305, 0, 0, 305, 305, 0, 307, 305,
+	305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 305, 305,
+	307, 305, 305, 307, 307, 307, 305, 307, 307, 305, 307, 305,
+	305, 305, 307, 305, 307, 305, 307, 305, 307, 305, 305, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 307, 305,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305,
+	305, 305, 0, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	0, 305, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 307, 307, 307, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 307, 307,
+	305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305,
+	305, 305, 305, 307, 307, 307, 307, 307, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 307,
+	305, 305, 307, 305, 305, 307, 305, 305, 305, 307, 307, 307,
+	438, 439, 440, 305, 305, 305, 307, 305, 305, 307, 307, 305,
+	305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0,
+	0, 0, 0, 0, 0, 453, 0, 0, 454, 0, 0, 0,
+	0, 0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+	0, 305, 307, 305, 305, 0, 0, 0, 457, 458, 459, 460,
+	461, 462, 463, 464, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	465, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 467, 468, 456, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 466, 0, 0, 0, 0, 469, 470, 0, 471,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472,
+	0, 0, 473, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 474, 475, 476, 0, 0, 477, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	465, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	478, 0, 0, 479, 480, 456, 0, 0, 0, 0, 0, 0,
+	0, 0, 466, 466, 0, 0, 0, 0, 481, 482, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 484, 485,
+	486, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 487, 0, 0, 0, 0, 456, 0, 0,
+	0, 0, 0, 0, 0, 488, 489, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	465, 0, 0, 0, 490, 0, 466, 0, 0, 0, 0, 491,
+	492, 0, 493, 494, 0, 456, 0, 0, 0, 0, 0, 0,
+	0, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 466, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 495, 496,
+	497, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 498, 0, 0, 0, 0, 466,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0,
+	500, 501, 502, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 503, 0, 0, 0, 0, 504, 504, 456, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	505, 505, 505, 505, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 506,
+	0, 0, 0, 0, 507, 507, 456, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 508, 508, 508, 508,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 509, 510, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 511, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 307, 307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 307,
+	0, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 513,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0,
+	0, 0, 515, 0, 0, 0, 0, 516, 0, 0, 0, 0,
+	517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 518, 0, 0, 0, 0, 0, 0, 0, 519, 520, 521,
+	522, 523, 524, 525, 526, 527, 520, 520, 520, 520, 0, 0,
+	520, 528, 305, 305, 456, 0, 305, 305, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 529, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 530, 0, 0, 0, 0, 531, 0,
+	0, 0, 0, 532, 0, 0, 0, 0, 533, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 534, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 535, 0,
+	0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0,
+	0, 0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+	466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+	466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+	466, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 412, 305, 307,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 305, 307, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305,
+	305, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 305, 305, 305, 305, 305, 307, 307, 307,
+	307, 307, 307, 305, 305, 307, 0, 307, 307, 305, 305, 307,
+	307, 305, 305, 305, 305, 305, 307, 305, 305, 305, 305, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 537, 0, 538, 0, 539, 0,
+	540, 0, 541, 0, 0, 0, 542, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 465, 466, 0, 0, 0, 0, 0, 543,
+	0, 544, 0, 0, 545, 546, 0, 547, 456, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+	307, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 0,
+	312, 307, 307, 307, 307, 307, 305, 305, 307, 307, 307, 307,
+	305, 0, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0,
+	0, 307, 0, 0, 0, 0, 0, 0, 305, 0, 0, 0,
+	305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 548, 549, 550, 0, 551, 552, 553, 554,
+	555, 556, 557, 558, 559, 560, 561, 0, 562, 563, 564, 565,
+	566, 567, 568, 3, 569, 570, 571, 572, 573, 574, 575, 576,
+	577, 578, 0, 579, 580, 581, 11, 582, 583, 584, 585, 586,
+	587, 588, 589, 590, 591, 346, 592, 593, 351, 594, 595, 288,
+	587, 590, 346, 592, 354, 351, 594, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 596, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 597, 598, 599, 600, 577,
+	601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+	613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624,
+	625, 626, 627, 628, 629, 630, 631, 347, 305, 305, 307, 305,
+	305, 305, 305, 305, 305, 305, 307, 305, 305, 320, 632, 307,
+	309, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 306, 413, 413, 307, 633, 305, 319, 307, 305, 307,
+	634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645,
+	646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657,
+	658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669,
+	670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681,
+	682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693,
+	694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705,
+	706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717,
+	718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+	730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741,
+	742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753,
+	754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765,
+	766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+	778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789,
+	0, 0, 0, 0, 790, 791, 792, 793, 794, 795, 796, 797,
+	798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809,
+	810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821,
+	822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833,
+	834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845,
+	846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857,
+	858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+	870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 0, 0,
+	0, 0, 0, 0, 880, 881, 882, 883, 884, 885, 886, 887,
+	888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899,
+	900, 901, 0, 0, 902, 903, 904, 905, 906, 907, 0, 0,
+	908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919,
+	920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931,
+	932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+	944, 945, 0, 0, 946, 947, 948, 949, 950, 951, 0, 0,
+	952, 953, 954, 955, 956, 957, 958, 959, 0, 960, 0, 961,
+	0, 962, 0, 963, 964, 965, 966, 967, 968, 969, 970, 971,
+	972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983,
+	984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 0, 0,
+	994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005,
+	1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+	1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+	1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+	1042, 1043, 1044, 1045, 1046, 0, 1047, 1048, 1049, 1050, 1051, 1052,
+	1053, 1054, 1055, 1054, 1056, 1057, 1058, 1059, 1060, 0, 1061, 1062,
+	1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+	0, 0, 1075, 1076, 1077, 1078, 1079, 1080, 0, 1081, 1082, 1083,
+	1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+	1096, 1097, 1098, 1099, 0, 0, 1100, 1101, 1102, 0, 1103, 1104,
+	1105, 1106, 1107, 1108, 1109, 1110, 1111, 0, 1112, 1113, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 1114, 0, 0, 0, 0, 0, 1115, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1116, 1117, 1118, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1119,
+	1120, 0, 1121, 1122, 0, 0, 0, 0, 1123, 0, 1124, 0,
+	0, 0, 0, 0, 0, 0, 0, 1125, 1126, 1127, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1128,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1129, 595, 0, 0, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
+	1138, 1139, 1140, 1141, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+	1134, 1135, 1136, 1137, 1138, 1139, 1140, 0, 3, 574, 11, 302,
+	575, 285, 579, 301, 580, 1141, 585, 181, 586, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1142, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	305, 305, 312, 312, 305, 305, 305, 305, 312, 312, 312, 305,
+	305, 0, 0, 0, 0, 305, 0, 0, 0, 312, 312, 305,
+	307, 305, 312, 312, 307, 307, 307, 307, 305, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1143, 1144, 1145, 1146, 0, 1147, 1148, 1149, 0, 1150, 578, 555,
+	555, 555, 285, 1151, 556, 556, 559, 301, 0, 561, 1152, 0,
+	0, 564, 1153, 565, 565, 565, 0, 0, 1154, 1155, 1156, 0,
+	1157, 0, 1158, 0, 1157, 0, 1159, 1160, 550, 1145, 0, 574,
+	552, 1161, 0, 560, 11, 1162, 1163, 1164, 1165, 595, 0, 1166,
+	352, 592, 1167, 1168, 1169, 0, 0, 0, 0, 551, 573, 574,
+	595, 287, 0, 0, 0, 0, 0, 0, 1170, 1171, 1172, 1173,
+	1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+	556, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
+	559, 1145, 551, 560, 595, 1197, 1198, 1199, 590, 1200, 1201, 1202,
+	1203, 302, 1204, 1205, 301, 598, 573, 580, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1206, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1207, 1208,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1209, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1210, 1211, 1212, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1213, 0, 0, 0,
+	0, 1214, 0, 0, 1215, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1216, 0, 1217, 0, 0, 0, 0, 0,
+	1218, 1219, 0, 1220, 1221, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1222, 0, 0,
+	1223, 0, 0, 1224, 0, 1225, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1226, 0, 1227, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1228, 1229, 1230, 1231, 1232, 0, 0,
+	1233, 1234, 0, 0, 1235, 1236, 0, 0, 0, 0, 0, 0,
+	1237, 1238, 0, 0, 1239, 1240, 0, 0, 1241, 1242, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1243, 1244, 1245, 1246,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1247, 1248, 1249, 1250, 0, 0, 0, 0, 0, 0, 1251, 1252,
+	1253, 1254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1255, 1256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 10, 5, 6, 1130, 1131, 1132, 1133, 1134,
+	1135, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267,
+	1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+	1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+	1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
+	1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
+	1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 548, 550, 1145, 551, 552, 1161,
+	554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565,
+	1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573,
+	574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585,
+	1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 1129, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1337, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1338, 1339, 1340, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1341, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 287, 1189, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+	305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1342, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1344, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
+	1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+	1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376,
+	1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388,
+	1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+	1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+	1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+	1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436,
+	1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
+	1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
+	1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+	1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484,
+	1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496,
+	1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508,
+	1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+	1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+	1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+	1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
+	1557, 1558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 633, 413, 306, 412, 1559, 1559, 0, 0, 0, 0,
+	0, 0, 1560, 0, 1368, 1561, 1562, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1563, 0, 1564, 0, 1565, 0, 1566, 0, 1567, 0, 1568, 0,
+	1569, 0, 1570, 0, 1571, 0, 1572, 0, 1573, 0, 1574, 0,
+	0, 1575, 0, 1576, 0, 1577, 0, 0, 0, 0, 0, 0,
+	1578, 1579, 0, 1580, 1581, 0, 1582, 1583, 0, 1584, 1585, 0,
+	1586, 1587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1588, 0, 0, 0, 0, 1589, 1589, 1590, 1591, 0, 1592, 1593,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1594, 0, 1595, 0, 1596, 0, 1597, 0, 1598, 0, 1599, 0,
+	1600, 0, 1601, 0, 1602, 0, 1603, 0, 1604, 0, 1605, 0,
+	0, 1606, 0, 1607, 0, 1608, 0, 0, 0, 0, 0, 0,
+	1609, 1610, 0, 1611, 1612, 0, 1613, 1614, 0, 1615, 1616, 0,
+	1617, 1618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1619, 0, 0, 1620, 1621, 1622, 1623, 0, 0, 0, 1624, 1625,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+	1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
+	1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660,
+	1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+	1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684,
+	1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+	1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708,
+	1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 0,
+	0, 0, 1345, 1351, 1720, 1721, 1722, 1723, 1724, 1725, 1349, 1726,
+	1727, 1728, 1729, 1353, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+	1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749,
+	1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 0,
+	1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772,
+	1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796,
+	1797, 1798, 1411, 1799, 0, 0, 0, 0, 0, 0, 0, 0,
+	1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811,
+	1812, 1813, 1814, 1815, 1626, 1629, 1632, 1634, 1642, 1643, 1646, 1648,
+	1649, 1651, 1652, 1653, 1654, 1655, 1816, 1817, 1818, 1819, 1820, 1821,
+	1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 0,
+	1345, 1351, 1720, 1721, 1833, 1834, 1835, 1356, 1836, 1368, 1418, 1430,
+	1429, 1419, 1511, 1376, 1416, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+	1844, 1845, 1846, 1382, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,
+	1722, 1723, 1724, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+	1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875,
+	1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+	1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899,
+	1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911,
+	1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923,
+	1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+	1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947,
+	1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+	1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971,
+	1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+	1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995,
+	1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,
+	2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+	2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031,
+	2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043,
+	2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
+	2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
+	2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+	2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091,
+	2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+	2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115,
+	2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+	2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139,
+	2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+	2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163,
+	2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+	2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187,
+	2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 305, 0, 0, 0, 0, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2200, 2201, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2202, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1145, 1161, 1153, 0, 0, 0,
+	2203, 2204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 305, 0, 305, 305, 307, 0, 0, 305,
+	305, 0, 0, 0, 0, 0, 305, 305, 0, 305, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2205, 2206, 2207, 2208,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2209, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2211, 2212, 2213, 2214,
+	2215, 2216, 2217, 2218, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
+	2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237,
+	2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249,
+	2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261,
+	2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+	2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285,
+	2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297,
+	2298, 2299, 2300, 2301, 2230, 2302, 2303, 2304, 2305, 2306, 2307, 2308,
+	2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320,
+	2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332,
+	2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344,
+	2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356,
+	2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368,
+	2369, 2320, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2304, 2378,
+	2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390,
+	2391, 2392, 2393, 2394, 2395, 2396, 2397, 2230, 2398, 2399, 2400, 2401,
+	2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+	2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2306,
+	2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436,
+	2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448,
+	2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460,
+	2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472,
+	2473, 2474, 0, 0, 2475, 0, 2476, 0, 0, 2477, 2478, 2479,
+	2480, 2481, 2482, 2483, 2484, 2485, 2486, 0, 2487, 0, 2488, 0,
+	0, 2489, 2490, 0, 0, 0, 2491, 2492, 2493, 2494, 2495, 2496,
+	2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508,
+	2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520,
+	2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532,
+	2533, 2534, 2535, 2359, 2536, 2537, 2538, 2539, 2540, 2541, 2541, 2542,
+	2543, 2544, 2545, 2546, 2547, 2548, 2549, 2489, 2550, 2551, 2552, 2553,
+	2554, 2555, 0, 0, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563,
+	2503, 2564, 2565, 2566, 2475, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+	2574, 2575, 2576, 2577, 2578, 2512, 2579, 2513, 2580, 2581, 2582, 2583,
+	2584, 2476, 2251, 2585, 2586, 2587, 2321, 2408, 2588, 2589, 2520, 2590,
+	2521, 2591, 2592, 2593, 2478, 2594, 2595, 2596, 2597, 2598, 2479, 2599,
+	2600, 2601, 2602, 2603, 2604, 2535, 2605, 2606, 2359, 2607, 2539, 2608,
+	2609, 2610, 2611, 2612, 2544, 2613, 2488, 2614, 2545, 2302, 2615, 2546,
+	2616, 2548, 2617, 2618, 2619, 2620, 2621, 2550, 2484, 2622, 2551, 2623,
+	2552, 2624, 2218, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+	2634, 2635, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2636, 2637, 2638, 2639, 2640, 2641, 2641, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2642,
+	2643, 2644, 2645, 2646, 0, 0, 0, 0, 0, 2647, 2648, 2649,
+	2650, 1162, 1165, 2651, 2652, 2653, 2654, 2655, 2656, 1136, 2657, 2658,
+	2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 0,
+	2670, 2671, 2672, 2673, 2674, 0, 2675, 0, 2676, 2677, 0, 2678,
+	2679, 0, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689,
+	2690, 2690, 2691, 2691, 2691, 2691, 2692, 2692, 2692, 2692, 2693, 2693,
+	2693, 2693, 2694, 2694, 2694, 2694, 2695, 2695, 2695, 2695, 2696, 2696,
+	2696, 2696, 2697, 2697, 2697, 2697, 2698, 2698, 2698, 2698, 2699, 2699,
+	2699, 2699, 2700, 2700, 2700, 2700, 2701, 2701, 2701, 2701, 2702, 2702,
+	2702, 2702, 2703, 2703, 2704, 2704, 2705, 2705, 2706, 2706, 2707, 2707,
+	2708, 2708, 2709, 2709, 2709, 2709, 2710, 2710, 2710, 2710, 2711, 2711,
+	2711, 2711, 2712, 2712, 2712, 2712, 2713, 2713, 2714, 2714, 2714, 2714,
+	2715, 2715, 2716, 2716, 2716, 2716, 2717, 2717, 2717, 2717, 2718, 2718,
+	2719, 2719, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2720,
+	2720, 2720, 2720, 2721, 2721, 2722, 2722, 2723, 2723, 446, 2724, 2724,
+	2725, 2725, 2726, 2726, 2727, 2727, 2727, 2727, 2728, 2728, 2729, 2729,
+	2730, 2730, 2731, 2731, 2732, 2732, 2733, 2733, 2734, 2734, 2735, 2735,
+	2735, 2736, 2736, 2736, 2737, 2737, 2737, 2737, 2738, 2739, 2740, 2736,
+	2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752,
+	2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764,
+	2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776,
+	2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788,
+	2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800,
+	2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812,
+	2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+	2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836,
+	2837, 2838, 2740, 2839, 2736, 2741, 2840, 2841, 2745, 2842, 2746, 2747,
+	2843, 2844, 2751, 2845, 2752, 2753, 2846, 2847, 2755, 2848, 2756, 2757,
+	2786, 2787, 2790, 2791, 2792, 2796, 2797, 2798, 2799, 2803, 2804, 2805,
+	2849, 2809, 2850, 2851, 2815, 2852, 2816, 2817, 2830, 2853, 2854, 2825,
+	2855, 2826, 2827, 2738, 2739, 2856, 2740, 2857, 2742, 2743, 2744, 2745,
+	2858, 2748, 2749, 2750, 2751, 2859, 2755, 2758, 2759, 2760, 2761, 2762,
+	2764, 2765, 2766, 2767, 2768, 2769, 2860, 2770, 2771, 2772, 2773, 2774,
+	2775, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2788, 2789,
+	2793, 2794, 2795, 2796, 2797, 2800, 2801, 2802, 2803, 2861, 2806, 2807,
+	2808, 2809, 2812, 2813, 2814, 2815, 2862, 2818, 2819, 2863, 2822, 2823,
+	2824, 2825, 2864, 2740, 2857, 2745, 2858, 2751, 2859, 2755, 2865, 2768,
+	2866, 2867, 2868, 2796, 2797, 2803, 2815, 2862, 2825, 2864, 2869, 2870,
+	2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882,
+	2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894,
+	2867, 2895, 2896, 2897, 2898, 2872, 2873, 2874, 2875, 2876, 2877, 2878,
+	2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890,
+	2891, 2892, 2893, 2894, 2867, 2895, 2896, 2897, 2898, 2892, 2893, 2894,
+	2867, 2866, 2868, 2776, 2765, 2766, 2767, 2892, 2893, 2894, 2776, 2777,
+	2899, 2899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2900, 2901, 2901, 2902,
+	2903, 2904, 2905, 2906, 2907, 2907, 2908, 2909, 2910, 2911, 2912, 2913,
+	2913, 2914, 2915, 2915, 2916, 2916, 2917, 2918, 2918, 2919, 2920, 2920,
+	2921, 2921, 2922, 2923, 2923, 2924, 2924, 2925, 2926, 2927, 2928, 2928,
+	2929, 2930, 2931, 2932, 2933, 2933, 2934, 2935, 2936, 2937, 2938, 2939,
+	2939, 2940, 2940, 2941, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948,
+	0, 0, 2949, 2950, 2951, 2952, 2953, 2954, 2954, 2955, 2956, 2957,
+	2958, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968,
+	2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980,
+	2934, 2936, 2981, 2982, 2983, 2984, 2985, 2986, 2985, 2983, 2987, 2988,
+	2989, 2990, 2991, 2986, 2927, 2917, 2992, 2993, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005,
+	3006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3007, 3008, 3009, 3010,
+	3011, 3012, 3013, 3014, 3015, 1118, 0, 0, 0, 0, 0, 0,
+	305, 305, 305, 305, 305, 305, 305, 307, 307, 307, 307, 307,
+	307, 307, 305, 305, 1117, 3016, 3017, 3018, 3018, 1139, 1140, 3019,
+	3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031,
+	3032, 0, 0, 3033, 3034, 1124, 1124, 1124, 1124, 3018, 3018, 3018,
+	3007, 3008, 1116, 0, 3011, 3010, 3013, 3012, 3016, 1139, 1140, 3019,
+	3020, 3021, 3022, 3035, 3036, 3037, 1136, 3038, 3039, 3040, 1138, 0,
+	3041, 3042, 3043, 3044, 0, 0, 0, 0, 3045, 3046, 3047, 0,
+	3048, 0, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058,
+	3059, 3060, 3060, 3061, 3061, 3062, 3062, 3063, 3063, 3064, 3064, 3064,
+	3064, 3065, 3065, 3066, 3066, 3066, 3066, 3067, 3067, 3068, 3068, 3068,
+	3068, 3069, 3069, 3069, 3069, 3070, 3070, 3070, 3070, 3071, 3071, 3071,
+	3071, 3072, 3072, 3072, 3072, 3073, 3073, 3074, 3074, 3075, 3075, 3076,
+	3076, 3077, 3077, 3077, 3077, 3078, 3078, 3078, 3078, 3079, 3079, 3079,
+	3079, 3080, 3080, 3080, 3080, 3081, 3081, 3081, 3081, 3082, 3082, 3082,
+	3082, 3083, 3083, 3083, 3083, 3084, 3084, 3084, 3084, 3085, 3085, 3085,
+	3085, 3086, 3086, 3086, 3086, 3087, 3087, 3087, 3087, 3088, 3088, 3088,
+	3088, 3089, 3089, 3089, 3089, 3090, 3090, 3090, 3090, 3091, 3091, 3091,
+	3091, 3092, 3092, 2728, 2728, 3093, 3093, 3093, 3093, 3094, 3094, 3095,
+	3095, 3096, 3096, 3097, 3097, 0, 0, 0, 0, 3012, 3098, 3035,
+	3042, 3043, 3036, 3099, 1139, 1140, 3037, 1136, 3007, 3038, 1116, 3100,
+	1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 3010, 3011,
+	3039, 1138, 3040, 3013, 3044, 548, 550, 1145, 551, 552, 1161, 554,
+	555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334,
+	566, 567, 1189, 568, 1194, 1335, 1157, 3033, 3041, 3034, 3101, 3018,
+	3102, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579,
+	301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590, 292,
+	302, 293, 628, 3019, 3103, 3020, 3104, 3105, 3106, 3009, 3029, 3030,
+	3008, 3107, 1942, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116,
+	3117, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906,
+	1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+	1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930,
+	1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 3118, 3119, 3120,
+	1677, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+	1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648,
+	1649, 1650, 1651, 1652, 1653, 1654, 1655, 0, 0, 0, 1656, 1657,
+	1658, 1659, 1660, 1661, 0, 0, 1662, 1663, 1664, 1665, 1666, 1667,
+	0, 0, 1668, 1669, 1670, 1671, 1672, 1673, 0, 0, 1674, 1675,
+	1676, 0, 0, 0, 3121, 3122, 3123, 4, 3124, 3125, 3126, 0,
+	3127, 3128, 3129, 3130, 3131, 3132, 3133, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+	0, 3134, 3135, 3136, 3137, 3138, 0, 3139, 3140, 3141, 3142, 3143,
+	3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 1151, 3153, 3154,
+	3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166,
+	3167, 1336, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177,
+	3178, 0, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 305,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 305, 312, 307, 0, 0, 0, 0, 456,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 305, 305, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 307, 307, 305, 305, 305, 307, 305, 307, 307, 307,
+	307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 305, 307, 305, 307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3188, 0, 3189, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3190,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 456, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 3191, 3192,
+	0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 465, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 456, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 465, 465, 0, 466, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3193,
+	3194, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0,
+	305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0,
+	0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 3195,
+	3196, 466, 3197, 0, 0, 0, 456, 465, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3198, 3199, 0, 0, 0, 456,
+	465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	466, 0, 0, 0, 0, 0, 0, 0, 3200, 0, 0, 0,
+	0, 456, 456, 0, 0, 0, 0, 465, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 312, 312, 312, 312, 312, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+	305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3201, 3201, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 312, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3202, 3203, 3204, 3205, 3206, 3207,
+	3208, 512, 512, 312, 312, 312, 0, 0, 0, 3209, 512, 512,
+	512, 512, 512, 0, 0, 0, 0, 0, 0, 0, 0, 307,
+	307, 307, 307, 307, 307, 307, 307, 0, 0, 305, 305, 305,
+	305, 305, 307, 307, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305,
+	305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3210, 3211, 3212, 3213, 3214, 3215, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 305, 305, 305, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 548, 550, 1145, 551,
+	552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+	1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+	598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+	11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+	548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+	1335, 1157, 3, 572, 598, 573, 574, 601, 578, 0, 595, 287,
+	579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+	292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+	556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+	567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+	578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+	181, 586, 587, 590, 292, 302, 293, 628, 548, 0, 1145, 551,
+	0, 0, 554, 0, 0, 557, 558, 0, 0, 561, 562, 564,
+	1153, 0, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+	598, 573, 0, 601, 0, 285, 595, 287, 579, 301, 580, 1141,
+	0, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+	548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+	1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+	579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+	292, 302, 293, 628, 548, 550, 0, 551, 552, 1161, 554, 0,
+	0, 557, 558, 559, 560, 561, 562, 564, 1153, 0, 1334, 566,
+	567, 1189, 568, 1194, 1335, 0, 3, 572, 598, 573, 574, 601,
+	578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+	181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 0, 551,
+	552, 1161, 554, 0, 556, 557, 558, 559, 560, 0, 562, 0,
+	0, 0, 1334, 566, 567, 1189, 568, 1194, 1335, 0, 3, 572,
+	598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+	11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+	548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+	1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+	579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+	292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+	556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+	567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+	578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+	181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+	552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+	1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+	598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+	11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+	548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+	1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+	579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+	292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+	556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+	567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+	578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+	181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+	552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+	1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+	598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+	11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+	3216, 3217, 0, 0, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356,
+	3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232,
+	348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593, 357, 3239,
+	3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352, 354, 355,
+	3246, 3247, 3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351,
+	354, 352, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225,
+	3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233,
+	3234, 3235, 3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347,
+	3241, 353, 3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247,
+	3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352,
+	3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225, 3226, 3227,
+	3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235,
+	3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353,
+	3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247, 3248, 351,
+	594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352, 3218, 3219,
+	1167, 3220, 3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229,
+	3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237,
+	3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8,
+	3243, 3244, 3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249,
+	3250, 3251, 357, 347, 353, 351, 354, 352, 3218, 3219, 1167, 3220,
+	3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168,
+	3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237, 3238, 346,
+	592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244,
+	3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251,
+	357, 347, 353, 351, 354, 352, 3252, 3253, 0, 0, 1129, 10,
+	5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6,
+	1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131,
+	1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+	1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135,
+	305, 305, 305, 305, 305, 305, 305, 0, 305, 305, 305, 305,
+	305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+	305, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 305,
+	305, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	307, 307, 307, 307, 307, 307, 307, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+	305, 305, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3065, 3066, 3070, 3073,
+	0, 3092, 3076, 3071, 3081, 3093, 3087, 3088, 3089, 3090, 3077, 3083,
+	3085, 3079, 3086, 3075, 3078, 3068, 3069, 3072, 3074, 3080, 3082, 3084,
+	3254, 2713, 3255, 3256, 0, 3066, 3070, 0, 3091, 0, 0, 3071,
+	0, 3093, 3087, 3088, 3089, 3090, 3077, 3083, 3085, 3079, 3086, 0,
+	3078, 3068, 3069, 3072, 0, 3080, 0, 3084, 0, 0, 0, 0,
+	0, 0, 3070, 0, 0, 0, 0, 3071, 0, 3093, 0, 3088,
+	0, 3090, 3077, 3083, 0, 3079, 3086, 0, 3078, 0, 0, 3072,
+	0, 3080, 0, 3084, 0, 2713, 0, 3256, 0, 3066, 3070, 0,
+	3091, 0, 0, 3071, 3081, 3093, 3087, 0, 3089, 3090, 3077, 3083,
+	3085, 3079, 3086, 0, 3078, 3068, 3069, 3072, 0, 3080, 3082, 3084,
+	3254, 0, 3255, 0, 3065, 3066, 3070, 3073, 3091, 3092, 3076, 3071,
+	3081, 3093, 0, 3088, 3089, 3090, 3077, 3083, 3085, 3079, 3086, 3075,
+	3078, 3068, 3069, 3072, 3074, 3080, 3082, 3084, 0, 0, 0, 0,
+	0, 3066, 3070, 3073, 0, 3092, 3076, 3071, 3081, 3093, 0, 3088,
+	3089, 3090, 3077, 3083, 3085, 3079, 3086, 3075, 3078, 3068, 3069, 3072,
+	3074, 3080, 3082, 3084, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 0,
+	0, 0, 0, 0, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275,
+	3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287,
+	3288, 3289, 3290, 3291, 3292, 3293, 3294, 1145, 565, 3295, 3296, 0,
+	548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+	560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+	1335, 1157, 3297, 2129, 3298, 3299, 3300, 3301, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3302, 3303,
+	3304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3306, 3307, 1906, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1408, 3308, 3309, 3310,
+	1351, 3311, 3312, 1728, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320,
+	3321, 3322, 1444, 3323, 3324, 3325, 3326, 3327, 3328, 1345, 1720, 3329,
+	1855, 1723, 1856, 3330, 1500, 3331, 3332, 3333, 3334, 3335, 1838, 1418,
+	3336, 3337, 3338, 3339, 0, 0, 0, 0, 3340, 3341, 3342, 3343,
+	3344, 3345, 3346, 3347, 3348, 0, 0, 0, 0, 0, 0, 0,
+	3349, 3350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+	1134, 1135, 0, 0, 0, 0, 0, 0, 3351, 3352, 3353, 3354,
+	3355, 2497, 3356, 3357, 3358, 3359, 2498, 3360, 3361, 3362, 2499, 3363,
+	3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 2557,
+	3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 2562, 2500, 2501,
+	2563, 3384, 3385, 2308, 3386, 2502, 3387, 3388, 3389, 3390, 3390, 3390,
+	3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402,
+	3403, 3404, 3405, 3406, 3407, 3408, 3408, 2565, 3409, 3410, 3411, 3412,
+	2504, 3413, 3414, 3415, 2461, 3416, 3417, 3418, 3419, 3420, 3421, 3422,
+	3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434,
+	3435, 3436, 3437, 3438, 3439, 3440, 3441, 3441, 3442, 3443, 3444, 2304,
+	3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 2509, 3453, 3454, 3455,
+	3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467,
+	3468, 3469, 3470, 3471, 3472, 3473, 2250, 3474, 3475, 3476, 3476, 3477,
+	3478, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488,
+	3489, 3490, 3491, 2510, 3492, 3493, 3494, 3495, 2577, 3495, 3496, 2512,
+	3497, 3498, 3499, 3500, 2513, 2223, 3501, 3502, 3503, 3504, 3505, 3506,
+	3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518,
+	3519, 3520, 3521, 3522, 2514, 3523, 3524, 3525, 3526, 3527, 3528, 2516,
+	3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 2251, 2585, 3537, 3538,
+	3539, 3540, 3541, 3542, 3543, 3544, 2517, 3545, 3546, 3547, 3548, 2628,
+	3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560,
+	3561, 2321, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571,
+	3572, 2518, 2408, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 2589,
+	3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 2590, 3589, 3590, 3591,
+	3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 2592, 3601, 3602,
+	3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3611, 3612, 3613,
+	2594, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 2307, 3621, 3622, 3623,
+	3624, 3625, 3626, 3627, 2600, 3628, 3629, 3630, 3631, 3632, 3633, 3633,
+	2601, 2630, 3634, 3635, 3636, 3637, 3638, 2269, 2603, 3639, 3640, 2529,
+	3641, 3642, 2483, 3643, 3644, 2533, 3645, 3646, 3647, 3648, 3648, 3649,
+	3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661,
+	3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673,
+	3674, 3675, 2539, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684,
+	3685, 3686, 3687, 3688, 3689, 3690, 3691, 3477, 3692, 3693, 3694, 3695,
+	3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 2325, 3704, 3705, 3706,
+	3707, 3708, 3709, 2542, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717,
+	3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729,
+	2264, 3730, 3731, 3732, 3733, 3734, 3735, 2610, 3736, 3737, 3738, 3739,
+	3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751,
+	3752, 3753, 3754, 3755, 2615, 2616, 3756, 3757, 3758, 3759, 3760, 3761,
+	3762, 3763, 3764, 3765, 3766, 3767, 3768, 2617, 3769, 3770, 3771, 3772,
+	3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784,
+	3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796,
+	3797, 3798, 2623, 2623, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806,
+	3807, 3808, 2624, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817,
+	3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct {
+	unsigned char ccc, quickCheck;
+	uint16_t canonical, compatibility;
+} normRecords[3828] = {
+	{ 0, 0, 0, 0 },
+	{ 0, 80, 0, 1 },
+	{ 0, 80, 0, 3 },
+	{ 0, 80, 0, 6 },
+	{ 0, 80, 0, 8 },
+	{ 0, 80, 0, 11 },
+	{ 0, 80, 0, 13 },
+	{ 0, 80, 0, 15 },
+	{ 0, 80, 0, 18 },
+	{ 0, 80, 0, 20 },
+	{ 0, 80, 0, 23 },
+	{ 0, 80, 0, 25 },
+	{ 0, 80, 0, 27 },
+	{ 0, 80, 0, 31 },
+	{ 0, 80, 0, 35 },
+	{ 0, 68, 39, 39 },
+	{ 0, 68, 42, 42 },
+	{ 0, 68, 45, 45 },
+	{ 0, 68, 48, 48 },
+	{ 0, 68, 51, 51 },
+	{ 0, 68, 54, 54 },
+	{ 0, 68, 57, 57 },
+	{ 0, 68, 60, 60 },
+	{ 0, 68, 63, 63 },
+	{ 0, 68, 66, 66 },
+	{ 0, 68, 69, 69 },
+	{ 0, 68, 72, 72 },
+	{ 0, 68, 75, 75 },
+	{ 0, 68, 78, 78 },
+	{ 0, 68, 81, 81 },
+	{ 0, 68, 84, 84 },
+	{ 0, 68, 87, 87 },
+	{ 0, 68, 90, 90 },
+	{ 0, 68, 93, 93 },
+	{ 0, 68, 96, 96 },
+	{ 0, 68, 99, 99 },
+	{ 0, 68, 102, 102 },
+	{ 0, 68, 105, 105 },
+	{ 0, 68, 108, 108 },
+	{ 0, 68, 111, 111 },
+	{ 0, 68, 114, 114 },
+	{ 0, 68, 117, 117 },
+	{ 0, 68, 120, 120 },
+	{ 0, 68, 123, 123 },
+	{ 0, 68, 126, 126 },
+	{ 0, 68, 129, 129 },
+	{ 0, 68, 132, 132 },
+	{ 0, 68, 135, 135 },
+	{ 0, 68, 138, 138 },
+	{ 0, 68, 141, 141 },
+	{ 0, 68, 144, 144 },
+	{ 0, 68, 147, 147 },
+	{ 0, 68, 150, 150 },
+	{ 0, 68, 153, 153 },
+	{ 0, 68, 156, 156 },
+	{ 0, 68, 159, 159 },
+	{ 0, 68, 162, 162 },
+	{ 0, 68, 165, 165 },
+	{ 0, 68, 168, 168 },
+	{ 0, 68, 171, 171 },
+	{ 0, 68, 174, 174 },
+	{ 0, 68, 177, 177 },
+	{ 0, 68, 180, 180 },
+	{ 0, 68, 183, 183 },
+	{ 0, 68, 186, 186 },
+	{ 0, 68, 189, 189 },
+	{ 0, 68, 192, 192 },
+	{ 0, 68, 195, 195 },
+	{ 0, 68, 198, 198 },
+	{ 0, 68, 201, 201 },
+	{ 0, 68, 204, 204 },
+	{ 0, 68, 207, 207 },
+	{ 0, 68, 210, 210 },
+	{ 0, 68, 213, 213 },
+	{ 0, 68, 216, 216 },
+	{ 0, 68, 219, 219 },
+	{ 0, 68, 222, 222 },
+	{ 0, 68, 225, 225 },
+	{ 0, 68, 228, 228 },
+	{ 0, 68, 231, 231 },
+	{ 0, 68, 234, 234 },
+	{ 0, 68, 237, 237 },
+	{ 0, 68, 240, 240 },
+	{ 0, 68, 243, 243 },
+	{ 0, 68, 246, 246 },
+	{ 0, 68, 249, 249 },
+	{ 0, 68, 252, 252 },
+	{ 0, 68, 255, 255 },
+	{ 0, 68, 258, 258 },
+	{ 0, 68, 261, 261 },
+	{ 0, 68, 264, 264 },
+	{ 0, 68, 267, 267 },
+	{ 0, 68, 270, 270 },
+	{ 0, 68, 273, 273 },
+	{ 0, 68, 276, 276 },
+	{ 0, 68, 279, 279 },
+	{ 0, 68, 282, 282 },
+	{ 0, 68, 285, 285 },
+	{ 0, 68, 288, 288 },
+	{ 0, 68, 291, 291 },
+	{ 0, 68, 294, 294 },
+	{ 0, 68, 297, 297 },
+	{ 0, 68, 300, 300 },
+	{ 0, 68, 303, 303 },
+	{ 0, 68, 306, 306 },
+	{ 0, 68, 309, 309 },
+	{ 0, 68, 312, 312 },
+	{ 0, 68, 315, 315 },
+	{ 0, 68, 318, 318 },
+	{ 0, 68, 321, 321 },
+	{ 0, 68, 324, 324 },
+	{ 0, 68, 327, 327 },
+	{ 0, 68, 330, 330 },
+	{ 0, 80, 0, 333 },
+	{ 0, 80, 0, 336 },
+	{ 0, 68, 339, 339 },
+	{ 0, 68, 342, 342 },
+	{ 0, 68, 345, 345 },
+	{ 0, 68, 348, 348 },
+	{ 0, 68, 351, 351 },
+	{ 0, 68, 354, 354 },
+	{ 0, 68, 357, 357 },
+	{ 0, 68, 360, 360 },
+	{ 0, 68, 363, 363 },
+	{ 0, 68, 366, 366 },
+	{ 0, 80, 0, 369 },
+	{ 0, 80, 0, 372 },
+	{ 0, 68, 375, 375 },
+	{ 0, 68, 378, 378 },
+	{ 0, 68, 381, 381 },
+	{ 0, 68, 384, 384 },
+	{ 0, 68, 387, 387 },
+	{ 0, 68, 390, 390 },
+	{ 0, 80, 0, 393 },
+	{ 0, 68, 396, 396 },
+	{ 0, 68, 399, 399 },
+	{ 0, 68, 402, 402 },
+	{ 0, 68, 405, 405 },
+	{ 0, 68, 408, 408 },
+	{ 0, 68, 411, 411 },
+	{ 0, 68, 414, 414 },
+	{ 0, 68, 417, 417 },
+	{ 0, 68, 420, 420 },
+	{ 0, 68, 423, 423 },
+	{ 0, 68, 426, 426 },
+	{ 0, 68, 429, 429 },
+	{ 0, 68, 432, 432 },
+	{ 0, 68, 435, 435 },
+	{ 0, 68, 438, 438 },
+	{ 0, 68, 441, 441 },
+	{ 0, 68, 444, 444 },
+	{ 0, 68, 447, 447 },
+	{ 0, 68, 450, 450 },
+	{ 0, 68, 453, 453 },
+	{ 0, 68, 456, 456 },
+	{ 0, 68, 459, 459 },
+	{ 0, 68, 462, 462 },
+	{ 0, 68, 465, 465 },
+	{ 0, 68, 468, 468 },
+	{ 0, 68, 471, 471 },
+	{ 0, 68, 474, 474 },
+	{ 0, 68, 477, 477 },
+	{ 0, 68, 480, 480 },
+	{ 0, 68, 483, 483 },
+	{ 0, 68, 486, 486 },
+	{ 0, 68, 489, 489 },
+	{ 0, 68, 492, 492 },
+	{ 0, 68, 495, 495 },
+	{ 0, 68, 498, 498 },
+	{ 0, 68, 501, 501 },
+	{ 0, 68, 504, 504 },
+	{ 0, 68, 507, 507 },
+	{ 0, 68, 510, 510 },
+	{ 0, 68, 513, 513 },
+	{ 0, 68, 516, 516 },
+	{ 0, 68, 519, 519 },
+	{ 0, 68, 522, 522 },
+	{ 0, 68, 525, 525 },
+	{ 0, 68, 528, 528 },
+	{ 0, 68, 531, 531 },
+	{ 0, 68, 534, 534 },
+	{ 0, 80, 0, 537 },
+	{ 0, 68, 539, 539 },
+	{ 0, 68, 542, 542 },
+	{ 0, 68, 545, 545 },
+	{ 0, 68, 548, 548 },
+	{ 0, 80, 0, 551 },
+	{ 0, 80, 0, 555 },
+	{ 0, 80, 0, 559 },
+	{ 0, 80, 0, 563 },
+	{ 0, 80, 0, 566 },
+	{ 0, 80, 0, 569 },
+	{ 0, 80, 0, 572 },
+	{ 0, 80, 0, 575 },
+	{ 0, 80, 0, 578 },
+	{ 0, 68, 581, 581 },
+	{ 0, 68, 584, 584 },
+	{ 0, 68, 587, 587 },
+	{ 0, 68, 590, 590 },
+	{ 0, 68, 593, 593 },
+	{ 0, 68, 596, 596 },
+	{ 0, 68, 599, 599 },
+	{ 0, 68, 602, 602 },
+	{ 0, 68, 605, 605 },
+	{ 0, 68, 609, 609 },
+	{ 0, 68, 613, 613 },
+	{ 0, 68, 617, 617 },
+	{ 0, 68, 621, 621 },
+	{ 0, 68, 625, 625 },
+	{ 0, 68, 629, 629 },
+	{ 0, 68, 633, 633 },
+	{ 0, 68, 637, 637 },
+	{ 0, 68, 641, 641 },
+	{ 0, 68, 645, 645 },
+	{ 0, 68, 649, 649 },
+	{ 0, 68, 653, 653 },
+	{ 0, 68, 656, 656 },
+	{ 0, 68, 659, 659 },
+	{ 0, 68, 662, 662 },
+	{ 0, 68, 665, 665 },
+	{ 0, 68, 668, 668 },
+	{ 0, 68, 671, 671 },
+	{ 0, 68, 674, 674 },
+	{ 0, 68, 677, 677 },
+	{ 0, 68, 681, 681 },
+	{ 0, 68, 685, 685 },
+	{ 0, 68, 688, 688 },
+	{ 0, 68, 691, 691 },
+	{ 0, 80, 0, 694 },
+	{ 0, 80, 0, 697 },
+	{ 0, 80, 0, 700 },
+	{ 0, 68, 703, 703 },
+	{ 0, 68, 706, 706 },
+	{ 0, 68, 709, 709 },
+	{ 0, 68, 712, 712 },
+	{ 0, 68, 715, 715 },
+	{ 0, 68, 719, 719 },
+	{ 0, 68, 723, 723 },
+	{ 0, 68, 726, 726 },
+	{ 0, 68, 729, 729 },
+	{ 0, 68, 732, 732 },
+	{ 0, 68, 735, 735 },
+	{ 0, 68, 738, 738 },
+	{ 0, 68, 741, 741 },
+	{ 0, 68, 744, 744 },
+	{ 0, 68, 747, 747 },
+	{ 0, 68, 750, 750 },
+	{ 0, 68, 753, 753 },
+	{ 0, 68, 756, 756 },
+	{ 0, 68, 759, 759 },
+	{ 0, 68, 762, 762 },
+	{ 0, 68, 765, 765 },
+	{ 0, 68, 768, 768 },
+	{ 0, 68, 771, 771 },
+	{ 0, 68, 774, 774 },
+	{ 0, 68, 777, 777 },
+	{ 0, 68, 780, 780 },
+	{ 0, 68, 783, 783 },
+	{ 0, 68, 786, 786 },
+	{ 0, 68, 789, 789 },
+	{ 0, 68, 792, 792 },
+	{ 0, 68, 795, 795 },
+	{ 0, 68, 798, 798 },
+	{ 0, 68, 801, 801 },
+	{ 0, 68, 804, 804 },
+	{ 0, 68, 807, 807 },
+	{ 0, 68, 810, 810 },
+	{ 0, 68, 813, 813 },
+	{ 0, 68, 816, 816 },
+	{ 0, 68, 819, 819 },
+	{ 0, 68, 822, 822 },
+	{ 0, 68, 825, 825 },
+	{ 0, 68, 828, 828 },
+	{ 0, 68, 831, 831 },
+	{ 0, 68, 834, 834 },
+	{ 0, 68, 837, 837 },
+	{ 0, 68, 841, 841 },
+	{ 0, 68, 845, 845 },
+	{ 0, 68, 849, 849 },
+	{ 0, 68, 853, 853 },
+	{ 0, 68, 856, 856 },
+	{ 0, 68, 859, 859 },
+	{ 0, 68, 863, 863 },
+	{ 0, 68, 867, 867 },
+	{ 0, 68, 870, 870 },
+	{ 0, 80, 0, 873 },
+	{ 0, 80, 0, 875 },
+	{ 0, 80, 0, 877 },
+	{ 0, 80, 0, 879 },
+	{ 0, 80, 0, 881 },
+	{ 0, 80, 0, 883 },
+	{ 0, 80, 0, 885 },
+	{ 0, 80, 0, 887 },
+	{ 0, 80, 0, 889 },
+	{ 0, 80, 0, 891 },
+	{ 0, 80, 0, 894 },
+	{ 0, 80, 0, 897 },
+	{ 0, 80, 0, 900 },
+	{ 0, 80, 0, 903 },
+	{ 0, 80, 0, 906 },
+	{ 0, 80, 0, 909 },
+	{ 0, 80, 0, 911 },
+	{ 0, 80, 0, 913 },
+	{ 0, 80, 0, 915 },
+	{ 230, 34, 0, 0 },
+	{ 230, 0, 0, 0 },
+	{ 232, 0, 0, 0 },
+	{ 220, 0, 0, 0 },
+	{ 216, 34, 0, 0 },
+	{ 202, 0, 0, 0 },
+	{ 220, 34, 0, 0 },
+	{ 202, 34, 0, 0 },
+	{ 1, 0, 0, 0 },
+	{ 1, 34, 0, 0 },
+	{ 230, 85, 917, 917 },
+	{ 230, 85, 919, 919 },
+	{ 230, 85, 921, 921 },
+	{ 230, 85, 923, 923 },
+	{ 240, 34, 0, 0 },
+	{ 233, 0, 0, 0 },
+	{ 234, 0, 0, 0 },
+	{ 0, 85, 926, 926 },
+	{ 0, 80, 0, 928 },
+	{ 0, 85, 931, 931 },
+	{ 0, 84, 933, 936 },
+	{ 0, 68, 940, 940 },
+	{ 0, 85, 943, 943 },
+	{ 0, 68, 945, 945 },
+	{ 0, 68, 948, 948 },
+	{ 0, 68, 951, 951 },
+	{ 0, 68, 954, 954 },
+	{ 0, 68, 957, 957 },
+	{ 0, 68, 960, 960 },
+	{ 0, 68, 963, 963 },
+	{ 0, 68, 967, 967 },
+	{ 0, 68, 970, 970 },
+	{ 0, 68, 973, 973 },
+	{ 0, 68, 976, 976 },
+	{ 0, 68, 979, 979 },
+	{ 0, 68, 982, 982 },
+	{ 0, 68, 985, 985 },
+	{ 0, 68, 989, 989 },
+	{ 0, 68, 992, 992 },
+	{ 0, 68, 995, 995 },
+	{ 0, 68, 998, 998 },
+	{ 0, 68, 1001, 1001 },
+	{ 0, 80, 0, 1004 },
+	{ 0, 80, 0, 1006 },
+	{ 0, 80, 0, 1008 },
+	{ 0, 84, 1010, 957 },
+	{ 0, 84, 1013, 970 },
+	{ 0, 80, 0, 1016 },
+	{ 0, 80, 0, 1018 },
+	{ 0, 80, 0, 1020 },
+	{ 0, 80, 0, 1022 },
+	{ 0, 80, 0, 1024 },
+	{ 0, 80, 0, 1026 },
+	{ 0, 80, 0, 1028 },
+	{ 0, 80, 0, 1030 },
+	{ 0, 68, 1032, 1032 },
+	{ 0, 68, 1035, 1035 },
+	{ 0, 68, 1038, 1038 },
+	{ 0, 68, 1041, 1041 },
+	{ 0, 68, 1044, 1044 },
+	{ 0, 68, 1047, 1047 },
+	{ 0, 68, 1050, 1050 },
+	{ 0, 68, 1053, 1053 },
+	{ 0, 68, 1056, 1056 },
+	{ 0, 68, 1059, 1059 },
+	{ 0, 68, 1062, 1062 },
+	{ 0, 68, 1065, 1065 },
+	{ 0, 68, 1068, 1068 },
+	{ 0, 68, 1071, 1071 },
+	{ 0, 68, 1074, 1074 },
+	{ 0, 68, 1077, 1077 },
+	{ 0, 68, 1080, 1080 },
+	{ 0, 68, 1083, 1083 },
+	{ 0, 68, 1086, 1086 },
+	{ 0, 68, 1089, 1089 },
+	{ 0, 68, 1092, 1092 },
+	{ 0, 68, 1095, 1095 },
+	{ 0, 68, 1098, 1098 },
+	{ 0, 68, 1101, 1101 },
+	{ 0, 68, 1104, 1104 },
+	{ 0, 68, 1107, 1107 },
+	{ 0, 68, 1110, 1110 },
+	{ 0, 68, 1113, 1113 },
+	{ 0, 68, 1116, 1116 },
+	{ 0, 68, 1119, 1119 },
+	{ 0, 68, 1122, 1122 },
+	{ 0, 68, 1125, 1125 },
+	{ 0, 68, 1128, 1128 },
+	{ 0, 68, 1131, 1131 },
+	{ 0, 68, 1134, 1134 },
+	{ 0, 68, 1137, 1137 },
+	{ 0, 68, 1140, 1140 },
+	{ 0, 68, 1143, 1143 },
+	{ 0, 68, 1146, 1146 },
+	{ 0, 68, 1149, 1149 },
+	{ 0, 68, 1152, 1152 },
+	{ 0, 68, 1155, 1155 },
+	{ 0, 68, 1158, 1158 },
+	{ 0, 68, 1161, 1161 },
+	{ 0, 68, 1164, 1164 },
+	{ 0, 68, 1167, 1167 },
+	{ 0, 68, 1170, 1170 },
+	{ 0, 68, 1173, 1173 },
+	{ 0, 68, 1176, 1176 },
+	{ 0, 68, 1179, 1179 },
+	{ 0, 68, 1182, 1182 },
+	{ 0, 68, 1185, 1185 },
+	{ 0, 80, 0, 1188 },
+	{ 222, 0, 0, 0 },
+	{ 228, 0, 0, 0 },
+	{ 10, 0, 0, 0 },
+	{ 11, 0, 0, 0 },
+	{ 12, 0, 0, 0 },
+	{ 13, 0, 0, 0 },
+	{ 14, 0, 0, 0 },
+	{ 15, 0, 0, 0 },
+	{ 16, 0, 0, 0 },
+	{ 17, 0, 0, 0 },
+	{ 18, 0, 0, 0 },
+	{ 19, 0, 0, 0 },
+	{ 20, 0, 0, 0 },
+	{ 21, 0, 0, 0 },
+	{ 22, 0, 0, 0 },
+	{ 23, 0, 0, 0 },
+	{ 24, 0, 0, 0 },
+	{ 25, 0, 0, 0 },
+	{ 30, 0, 0, 0 },
+	{ 31, 0, 0, 0 },
+	{ 32, 0, 0, 0 },
+	{ 0, 68, 1191, 1191 },
+	{ 0, 68, 1194, 1194 },
+	{ 0, 68, 1197, 1197 },
+	{ 0, 68, 1200, 1200 },
+	{ 0, 68, 1203, 1203 },
+	{ 27, 0, 0, 0 },
+	{ 28, 0, 0, 0 },
+	{ 29, 0, 0, 0 },
+	{ 33, 0, 0, 0 },
+	{ 34, 0, 0, 0 },
+	{ 35, 0, 0, 0 },
+	{ 0, 80, 0, 1206 },
+	{ 0, 80, 0, 1209 },
+	{ 0, 80, 0, 1212 },
+	{ 0, 80, 0, 1215 },
+	{ 0, 68, 1218, 1218 },
+	{ 0, 68, 1221, 1221 },
+	{ 0, 68, 1224, 1224 },
+	{ 36, 0, 0, 0 },
+	{ 0, 68, 1227, 1227 },
+	{ 0, 68, 1230, 1230 },
+	{ 0, 68, 1233, 1233 },
+	{ 7, 34, 0, 0 },
+	{ 9, 0, 0, 0 },
+	{ 0, 85, 1236, 1236 },
+	{ 0, 85, 1239, 1239 },
+	{ 0, 85, 1242, 1242 },
+	{ 0, 85, 1245, 1245 },
+	{ 0, 85, 1248, 1248 },
+	{ 0, 85, 1251, 1251 },
+	{ 0, 85, 1254, 1254 },
+	{ 0, 85, 1257, 1257 },
+	{ 7, 0, 0, 0 },
+	{ 0, 34, 0, 0 },
+	{ 0, 68, 1260, 1260 },
+	{ 0, 68, 1263, 1263 },
+	{ 0, 85, 1266, 1266 },
+	{ 0, 85, 1269, 1269 },
+	{ 0, 85, 1272, 1272 },
+	{ 0, 85, 1275, 1275 },
+	{ 0, 85, 1278, 1278 },
+	{ 0, 85, 1281, 1281 },
+	{ 0, 85, 1284, 1284 },
+	{ 0, 85, 1287, 1287 },
+	{ 0, 85, 1290, 1290 },
+	{ 0, 68, 1293, 1293 },
+	{ 0, 68, 1296, 1296 },
+	{ 0, 68, 1299, 1299 },
+	{ 0, 85, 1302, 1302 },
+	{ 0, 85, 1305, 1305 },
+	{ 0, 68, 1308, 1308 },
+	{ 0, 68, 1311, 1311 },
+	{ 0, 68, 1314, 1314 },
+	{ 0, 68, 1317, 1317 },
+	{ 0, 68, 1320, 1320 },
+	{ 84, 0, 0, 0 },
+	{ 91, 34, 0, 0 },
+	{ 0, 68, 1323, 1323 },
+	{ 0, 68, 1326, 1326 },
+	{ 0, 68, 1329, 1329 },
+	{ 0, 68, 1332, 1332 },
+	{ 0, 68, 1335, 1335 },
+	{ 0, 68, 1339, 1339 },
+	{ 0, 68, 1342, 1342 },
+	{ 0, 68, 1345, 1345 },
+	{ 9, 34, 0, 0 },
+	{ 0, 68, 1348, 1348 },
+	{ 0, 68, 1351, 1351 },
+	{ 0, 68, 1354, 1354 },
+	{ 0, 68, 1358, 1358 },
+	{ 0, 80, 0, 1361 },
+	{ 103, 0, 0, 0 },
+	{ 107, 0, 0, 0 },
+	{ 0, 80, 0, 1364 },
+	{ 118, 0, 0, 0 },
+	{ 122, 0, 0, 0 },
+	{ 0, 80, 0, 1367 },
+	{ 0, 80, 0, 1370 },
+	{ 0, 80, 0, 1373 },
+	{ 216, 0, 0, 0 },
+	{ 0, 85, 1375, 1375 },
+	{ 0, 85, 1378, 1378 },
+	{ 0, 85, 1381, 1381 },
+	{ 0, 85, 1384, 1384 },
+	{ 0, 85, 1387, 1387 },
+	{ 0, 85, 1390, 1390 },
+	{ 129, 0, 0, 0 },
+	{ 130, 0, 0, 0 },
+	{ 0, 85, 1393, 1393 },
+	{ 132, 0, 0, 0 },
+	{ 0, 85, 1396, 1396 },
+	{ 0, 85, 1399, 1399 },
+	{ 0, 80, 0, 1402 },
+	{ 0, 85, 1406, 1406 },
+	{ 0, 80, 0, 1409 },
+	{ 0, 85, 1413, 1413 },
+	{ 0, 85, 1416, 1416 },
+	{ 0, 85, 1419, 1419 },
+	{ 0, 85, 1422, 1422 },
+	{ 0, 85, 1425, 1425 },
+	{ 0, 85, 1428, 1428 },
+	{ 0, 85, 1431, 1431 },
+	{ 0, 68, 1434, 1434 },
+	{ 0, 80, 0, 1437 },
+	{ 0, 68, 1439, 1439 },
+	{ 0, 68, 1442, 1442 },
+	{ 0, 68, 1445, 1445 },
+	{ 0, 68, 1448, 1448 },
+	{ 0, 68, 1451, 1451 },
+	{ 0, 68, 1454, 1454 },
+	{ 0, 68, 1457, 1457 },
+	{ 0, 68, 1460, 1460 },
+	{ 0, 68, 1463, 1463 },
+	{ 0, 68, 1466, 1466 },
+	{ 0, 68, 1469, 1469 },
+	{ 0, 80, 0, 1472 },
+	{ 0, 80, 0, 1474 },
+	{ 0, 80, 0, 1476 },
+	{ 0, 80, 0, 1478 },
+	{ 0, 80, 0, 1480 },
+	{ 0, 80, 0, 1482 },
+	{ 0, 80, 0, 1484 },
+	{ 0, 80, 0, 1486 },
+	{ 0, 80, 0, 1488 },
+	{ 0, 80, 0, 1490 },
+	{ 0, 80, 0, 1492 },
+	{ 0, 80, 0, 1494 },
+	{ 0, 80, 0, 1496 },
+	{ 0, 80, 0, 1498 },
+	{ 0, 80, 0, 1500 },
+	{ 0, 80, 0, 1502 },
+	{ 0, 80, 0, 1504 },
+	{ 0, 80, 0, 1506 },
+	{ 0, 80, 0, 1508 },
+	{ 0, 80, 0, 1510 },
+	{ 0, 80, 0, 1512 },
+	{ 0, 80, 0, 1514 },
+	{ 0, 80, 0, 1516 },
+	{ 0, 80, 0, 1518 },
+	{ 0, 80, 0, 1520 },
+	{ 0, 80, 0, 1522 },
+	{ 0, 80, 0, 1524 },
+	{ 0, 80, 0, 1526 },
+	{ 0, 80, 0, 1528 },
+	{ 0, 80, 0, 1530 },
+	{ 0, 80, 0, 1532 },
+	{ 0, 80, 0, 1534 },
+	{ 0, 80, 0, 1536 },
+	{ 0, 80, 0, 1538 },
+	{ 0, 80, 0, 1540 },
+	{ 0, 80, 0, 1542 },
+	{ 0, 80, 0, 1544 },
+	{ 0, 80, 0, 1546 },
+	{ 0, 80, 0, 1548 },
+	{ 0, 80, 0, 1550 },
+	{ 0, 80, 0, 1552 },
+	{ 0, 80, 0, 1554 },
+	{ 0, 80, 0, 1556 },
+	{ 0, 80, 0, 1558 },
+	{ 0, 80, 0, 1560 },
+	{ 0, 80, 0, 1562 },
+	{ 0, 80, 0, 1564 },
+	{ 0, 80, 0, 1566 },
+	{ 0, 80, 0, 1568 },
+	{ 0, 80, 0, 1570 },
+	{ 0, 80, 0, 1572 },
+	{ 0, 80, 0, 1574 },
+	{ 0, 80, 0, 1576 },
+	{ 0, 80, 0, 1578 },
+	{ 0, 80, 0, 1580 },
+	{ 0, 80, 0, 1582 },
+	{ 0, 80, 0, 1584 },
+	{ 0, 80, 0, 1586 },
+	{ 0, 80, 0, 1588 },
+	{ 0, 80, 0, 1590 },
+	{ 0, 80, 0, 1592 },
+	{ 0, 80, 0, 1594 },
+	{ 0, 80, 0, 1596 },
+	{ 0, 80, 0, 1598 },
+	{ 0, 80, 0, 1600 },
+	{ 0, 80, 0, 1602 },
+	{ 0, 80, 0, 1604 },
+	{ 0, 80, 0, 1606 },
+	{ 0, 80, 0, 1608 },
+	{ 0, 80, 0, 1610 },
+	{ 0, 80, 0, 1612 },
+	{ 0, 80, 0, 1614 },
+	{ 0, 80, 0, 1616 },
+	{ 0, 80, 0, 1618 },
+	{ 0, 80, 0, 1620 },
+	{ 0, 80, 0, 1622 },
+	{ 0, 80, 0, 1624 },
+	{ 0, 80, 0, 1626 },
+	{ 0, 80, 0, 1628 },
+	{ 0, 80, 0, 1630 },
+	{ 0, 80, 0, 1632 },
+	{ 0, 80, 0, 1634 },
+	{ 0, 80, 0, 1636 },
+	{ 0, 80, 0, 1638 },
+	{ 214, 0, 0, 0 },
+	{ 218, 0, 0, 0 },
+	{ 0, 68, 1640, 1640 },
+	{ 0, 68, 1643, 1643 },
+	{ 0, 68, 1646, 1646 },
+	{ 0, 68, 1649, 1649 },
+	{ 0, 68, 1652, 1652 },
+	{ 0, 68, 1655, 1655 },
+	{ 0, 68, 1658, 1658 },
+	{ 0, 68, 1661, 1661 },
+	{ 0, 68, 1664, 1664 },
+	{ 0, 68, 1668, 1668 },
+	{ 0, 68, 1672, 1672 },
+	{ 0, 68, 1675, 1675 },
+	{ 0, 68, 1678, 1678 },
+	{ 0, 68, 1681, 1681 },
+	{ 0, 68, 1684, 1684 },
+	{ 0, 68, 1687, 1687 },
+	{ 0, 68, 1690, 1690 },
+	{ 0, 68, 1693, 1693 },
+	{ 0, 68, 1696, 1696 },
+	{ 0, 68, 1699, 1699 },
+	{ 0, 68, 1702, 1702 },
+	{ 0, 68, 1706, 1706 },
+	{ 0, 68, 1710, 1710 },
+	{ 0, 68, 1714, 1714 },
+	{ 0, 68, 1718, 1718 },
+	{ 0, 68, 1721, 1721 },
+	{ 0, 68, 1724, 1724 },
+	{ 0, 68, 1727, 1727 },
+	{ 0, 68, 1730, 1730 },
+	{ 0, 68, 1734, 1734 },
+	{ 0, 68, 1738, 1738 },
+	{ 0, 68, 1741, 1741 },
+	{ 0, 68, 1744, 1744 },
+	{ 0, 68, 1747, 1747 },
+	{ 0, 68, 1750, 1750 },
+	{ 0, 68, 1753, 1753 },
+	{ 0, 68, 1756, 1756 },
+	{ 0, 68, 1759, 1759 },
+	{ 0, 68, 1762, 1762 },
+	{ 0, 68, 1765, 1765 },
+	{ 0, 68, 1768, 1768 },
+	{ 0, 68, 1771, 1771 },
+	{ 0, 68, 1774, 1774 },
+	{ 0, 68, 1777, 1777 },
+	{ 0, 68, 1780, 1780 },
+	{ 0, 68, 1783, 1783 },
+	{ 0, 68, 1786, 1786 },
+	{ 0, 68, 1790, 1790 },
+	{ 0, 68, 1794, 1794 },
+	{ 0, 68, 1797, 1797 },
+	{ 0, 68, 1800, 1800 },
+	{ 0, 68, 1803, 1803 },
+	{ 0, 68, 1806, 1806 },
+	{ 0, 68, 1809, 1809 },
+	{ 0, 68, 1812, 1812 },
+	{ 0, 68, 1815, 1815 },
+	{ 0, 68, 1818, 1818 },
+	{ 0, 68, 1822, 1822 },
+	{ 0, 68, 1826, 1826 },
+	{ 0, 68, 1829, 1829 },
+	{ 0, 68, 1832, 1832 },
+	{ 0, 68, 1835, 1835 },
+	{ 0, 68, 1838, 1838 },
+	{ 0, 68, 1841, 1841 },
+	{ 0, 68, 1844, 1844 },
+	{ 0, 68, 1847, 1847 },
+	{ 0, 68, 1850, 1850 },
+	{ 0, 68, 1853, 1853 },
+	{ 0, 68, 1856, 1856 },
+	{ 0, 68, 1859, 1859 },
+	{ 0, 68, 1862, 1862 },
+	{ 0, 68, 1865, 1865 },
+	{ 0, 68, 1868, 1868 },
+	{ 0, 68, 1871, 1871 },
+	{ 0, 68, 1874, 1874 },
+	{ 0, 68, 1877, 1877 },
+	{ 0, 68, 1880, 1880 },
+	{ 0, 68, 1884, 1884 },
+	{ 0, 68, 1888, 1888 },
+	{ 0, 68, 1892, 1892 },
+	{ 0, 68, 1896, 1896 },
+	{ 0, 68, 1900, 1900 },
+	{ 0, 68, 1904, 1904 },
+	{ 0, 68, 1908, 1908 },
+	{ 0, 68, 1912, 1912 },
+	{ 0, 68, 1915, 1915 },
+	{ 0, 68, 1918, 1918 },
+	{ 0, 68, 1921, 1921 },
+	{ 0, 68, 1924, 1924 },
+	{ 0, 68, 1927, 1927 },
+	{ 0, 68, 1930, 1930 },
+	{ 0, 68, 1933, 1933 },
+	{ 0, 68, 1936, 1936 },
+	{ 0, 68, 1940, 1940 },
+	{ 0, 68, 1944, 1944 },
+	{ 0, 68, 1947, 1947 },
+	{ 0, 68, 1950, 1950 },
+	{ 0, 68, 1953, 1953 },
+	{ 0, 68, 1956, 1956 },
+	{ 0, 68, 1959, 1959 },
+	{ 0, 68, 1962, 1962 },
+	{ 0, 68, 1966, 1966 },
+	{ 0, 68, 1970, 1970 },
+	{ 0, 68, 1974, 1974 },
+	{ 0, 68, 1978, 1978 },
+	{ 0, 68, 1982, 1982 },
+	{ 0, 68, 1986, 1986 },
+	{ 0, 68, 1989, 1989 },
+	{ 0, 68, 1992, 1992 },
+	{ 0, 68, 1995, 1995 },
+	{ 0, 68, 1998, 1998 },
+	{ 0, 68, 2001, 2001 },
+	{ 0, 68, 2004, 2004 },
+	{ 0, 68, 2007, 2007 },
+	{ 0, 68, 2010, 2010 },
+	{ 0, 68, 2013, 2013 },
+	{ 0, 68, 2016, 2016 },
+	{ 0, 68, 2019, 2019 },
+	{ 0, 68, 2022, 2022 },
+	{ 0, 68, 2025, 2025 },
+	{ 0, 68, 2028, 2028 },
+	{ 0, 68, 2032, 2032 },
+	{ 0, 68, 2036, 2036 },
+	{ 0, 68, 2040, 2040 },
+	{ 0, 68, 2044, 2044 },
+	{ 0, 68, 2047, 2047 },
+	{ 0, 68, 2050, 2050 },
+	{ 0, 68, 2053, 2053 },
+	{ 0, 68, 2056, 2056 },
+	{ 0, 68, 2059, 2059 },
+	{ 0, 68, 2062, 2062 },
+	{ 0, 68, 2065, 2065 },
+	{ 0, 68, 2068, 2068 },
+	{ 0, 68, 2071, 2071 },
+	{ 0, 68, 2074, 2074 },
+	{ 0, 68, 2077, 2077 },
+	{ 0, 68, 2080, 2080 },
+	{ 0, 68, 2083, 2083 },
+	{ 0, 68, 2086, 2086 },
+	{ 0, 68, 2089, 2089 },
+	{ 0, 68, 2092, 2092 },
+	{ 0, 68, 2095, 2095 },
+	{ 0, 68, 2098, 2098 },
+	{ 0, 68, 2101, 2101 },
+	{ 0, 68, 2104, 2104 },
+	{ 0, 68, 2107, 2107 },
+	{ 0, 68, 2110, 2110 },
+	{ 0, 68, 2113, 2113 },
+	{ 0, 68, 2116, 2116 },
+	{ 0, 68, 2119, 2119 },
+	{ 0, 68, 2122, 2122 },
+	{ 0, 68, 2125, 2125 },
+	{ 0, 68, 2128, 2128 },
+	{ 0, 68, 2131, 2131 },
+	{ 0, 80, 0, 2134 },
+	{ 0, 84, 2137, 1953 },
+	{ 0, 68, 2140, 2140 },
+	{ 0, 68, 2143, 2143 },
+	{ 0, 68, 2146, 2146 },
+	{ 0, 68, 2149, 2149 },
+	{ 0, 68, 2152, 2152 },
+	{ 0, 68, 2156, 2156 },
+	{ 0, 68, 2160, 2160 },
+	{ 0, 68, 2164, 2164 },
+	{ 0, 68, 2168, 2168 },
+	{ 0, 68, 2172, 2172 },
+	{ 0, 68, 2176, 2176 },
+	{ 0, 68, 2180, 2180 },
+	{ 0, 68, 2184, 2184 },
+	{ 0, 68, 2188, 2188 },
+	{ 0, 68, 2192, 2192 },
+	{ 0, 68, 2196, 2196 },
+	{ 0, 68, 2200, 2200 },
+	{ 0, 68, 2204, 2204 },
+	{ 0, 68, 2208, 2208 },
+	{ 0, 68, 2212, 2212 },
+	{ 0, 68, 2216, 2216 },
+	{ 0, 68, 2220, 2220 },
+	{ 0, 68, 2224, 2224 },
+	{ 0, 68, 2228, 2228 },
+	{ 0, 68, 2232, 2232 },
+	{ 0, 68, 2235, 2235 },
+	{ 0, 68, 2238, 2238 },
+	{ 0, 68, 2241, 2241 },
+	{ 0, 68, 2244, 2244 },
+	{ 0, 68, 2247, 2247 },
+	{ 0, 68, 2250, 2250 },
+	{ 0, 68, 2254, 2254 },
+	{ 0, 68, 2258, 2258 },
+	{ 0, 68, 2262, 2262 },
+	{ 0, 68, 2266, 2266 },
+	{ 0, 68, 2270, 2270 },
+	{ 0, 68, 2274, 2274 },
+	{ 0, 68, 2278, 2278 },
+	{ 0, 68, 2282, 2282 },
+	{ 0, 68, 2286, 2286 },
+	{ 0, 68, 2290, 2290 },
+	{ 0, 68, 2293, 2293 },
+	{ 0, 68, 2296, 2296 },
+	{ 0, 68, 2299, 2299 },
+	{ 0, 68, 2302, 2302 },
+	{ 0, 68, 2305, 2305 },
+	{ 0, 68, 2308, 2308 },
+	{ 0, 68, 2311, 2311 },
+	{ 0, 68, 2314, 2314 },
+	{ 0, 68, 2318, 2318 },
+	{ 0, 68, 2322, 2322 },
+	{ 0, 68, 2326, 2326 },
+	{ 0, 68, 2330, 2330 },
+	{ 0, 68, 2334, 2334 },
+	{ 0, 68, 2338, 2338 },
+	{ 0, 68, 2342, 2342 },
+	{ 0, 68, 2346, 2346 },
+	{ 0, 68, 2350, 2350 },
+	{ 0, 68, 2354, 2354 },
+	{ 0, 68, 2358, 2358 },
+	{ 0, 68, 2362, 2362 },
+	{ 0, 68, 2366, 2366 },
+	{ 0, 68, 2370, 2370 },
+	{ 0, 68, 2374, 2374 },
+	{ 0, 68, 2378, 2378 },
+	{ 0, 68, 2382, 2382 },
+	{ 0, 68, 2386, 2386 },
+	{ 0, 68, 2390, 2390 },
+	{ 0, 68, 2394, 2394 },
+	{ 0, 68, 2397, 2397 },
+	{ 0, 68, 2400, 2400 },
+	{ 0, 68, 2403, 2403 },
+	{ 0, 68, 2406, 2406 },
+	{ 0, 68, 2410, 2410 },
+	{ 0, 68, 2414, 2414 },
+	{ 0, 68, 2418, 2418 },
+	{ 0, 68, 2422, 2422 },
+	{ 0, 68, 2426, 2426 },
+	{ 0, 68, 2430, 2430 },
+	{ 0, 68, 2434, 2434 },
+	{ 0, 68, 2438, 2438 },
+	{ 0, 68, 2442, 2442 },
+	{ 0, 68, 2446, 2446 },
+	{ 0, 68, 2449, 2449 },
+	{ 0, 68, 2452, 2452 },
+	{ 0, 68, 2455, 2455 },
+	{ 0, 68, 2458, 2458 },
+	{ 0, 68, 2461, 2461 },
+	{ 0, 68, 2464, 2464 },
+	{ 0, 68, 2467, 2467 },
+	{ 0, 68, 2470, 2470 },
+	{ 0, 68, 2473, 2473 },
+	{ 0, 68, 2476, 2476 },
+	{ 0, 68, 2480, 2480 },
+	{ 0, 68, 2484, 2484 },
+	{ 0, 68, 2488, 2488 },
+	{ 0, 68, 2492, 2492 },
+	{ 0, 68, 2496, 2496 },
+	{ 0, 68, 2500, 2500 },
+	{ 0, 68, 2503, 2503 },
+	{ 0, 68, 2506, 2506 },
+	{ 0, 68, 2510, 2510 },
+	{ 0, 68, 2514, 2514 },
+	{ 0, 68, 2518, 2518 },
+	{ 0, 68, 2522, 2522 },
+	{ 0, 68, 2526, 2526 },
+	{ 0, 68, 2530, 2530 },
+	{ 0, 68, 2533, 2533 },
+	{ 0, 68, 2536, 2536 },
+	{ 0, 68, 2540, 2540 },
+	{ 0, 68, 2544, 2544 },
+	{ 0, 68, 2548, 2548 },
+	{ 0, 68, 2552, 2552 },
+	{ 0, 68, 2555, 2555 },
+	{ 0, 68, 2558, 2558 },
+	{ 0, 68, 2562, 2562 },
+	{ 0, 68, 2566, 2566 },
+	{ 0, 68, 2570, 2570 },
+	{ 0, 68, 2574, 2574 },
+	{ 0, 68, 2577, 2577 },
+	{ 0, 68, 2580, 2580 },
+	{ 0, 68, 2584, 2584 },
+	{ 0, 68, 2588, 2588 },
+	{ 0, 68, 2592, 2592 },
+	{ 0, 68, 2596, 2596 },
+	{ 0, 68, 2600, 2600 },
+	{ 0, 68, 2604, 2604 },
+	{ 0, 68, 2607, 2607 },
+	{ 0, 68, 2610, 2610 },
+	{ 0, 68, 2614, 2614 },
+	{ 0, 68, 2618, 2618 },
+	{ 0, 68, 2622, 2622 },
+	{ 0, 68, 2626, 2626 },
+	{ 0, 68, 2630, 2630 },
+	{ 0, 68, 2634, 2634 },
+	{ 0, 68, 2637, 2637 },
+	{ 0, 68, 2640, 2640 },
+	{ 0, 68, 2644, 2644 },
+	{ 0, 68, 2648, 2648 },
+	{ 0, 68, 2652, 2652 },
+	{ 0, 68, 2656, 2656 },
+	{ 0, 68, 2660, 2660 },
+	{ 0, 68, 2664, 2664 },
+	{ 0, 68, 2667, 2667 },
+	{ 0, 68, 2670, 2670 },
+	{ 0, 68, 2674, 2674 },
+	{ 0, 68, 2678, 2678 },
+	{ 0, 68, 2682, 2682 },
+	{ 0, 68, 2686, 2686 },
+	{ 0, 68, 2690, 2690 },
+	{ 0, 68, 2694, 2694 },
+	{ 0, 68, 2697, 2697 },
+	{ 0, 68, 2700, 2700 },
+	{ 0, 68, 2704, 2704 },
+	{ 0, 68, 2708, 2708 },
+	{ 0, 68, 2712, 2712 },
+	{ 0, 68, 2716, 2716 },
+	{ 0, 68, 2719, 2719 },
+	{ 0, 68, 2722, 2722 },
+	{ 0, 68, 2726, 2726 },
+	{ 0, 68, 2730, 2730 },
+	{ 0, 68, 2734, 2734 },
+	{ 0, 68, 2738, 2738 },
+	{ 0, 68, 2741, 2741 },
+	{ 0, 68, 2744, 2744 },
+	{ 0, 68, 2748, 2748 },
+	{ 0, 68, 2752, 2752 },
+	{ 0, 68, 2756, 2756 },
+	{ 0, 68, 2760, 2760 },
+	{ 0, 68, 2764, 2764 },
+	{ 0, 68, 2768, 2768 },
+	{ 0, 68, 2771, 2771 },
+	{ 0, 68, 2775, 2775 },
+	{ 0, 68, 2779, 2779 },
+	{ 0, 68, 2783, 2783 },
+	{ 0, 68, 2786, 2786 },
+	{ 0, 68, 2789, 2789 },
+	{ 0, 68, 2793, 2793 },
+	{ 0, 68, 2797, 2797 },
+	{ 0, 68, 2801, 2801 },
+	{ 0, 68, 2805, 2805 },
+	{ 0, 68, 2809, 2809 },
+	{ 0, 68, 2813, 2813 },
+	{ 0, 68, 2816, 2816 },
+	{ 0, 68, 2819, 2819 },
+	{ 0, 68, 2823, 2823 },
+	{ 0, 68, 2827, 2827 },
+	{ 0, 68, 2831, 2831 },
+	{ 0, 68, 2835, 2835 },
+	{ 0, 68, 2839, 2839 },
+	{ 0, 68, 2843, 2843 },
+	{ 0, 85, 973, 973 },
+	{ 0, 68, 2846, 2846 },
+	{ 0, 85, 976, 976 },
+	{ 0, 68, 2849, 2849 },
+	{ 0, 85, 979, 979 },
+	{ 0, 68, 2852, 2852 },
+	{ 0, 85, 982, 982 },
+	{ 0, 68, 2855, 2855 },
+	{ 0, 85, 995, 995 },
+	{ 0, 68, 2858, 2858 },
+	{ 0, 85, 998, 998 },
+	{ 0, 68, 2861, 2861 },
+	{ 0, 85, 1001, 1001 },
+	{ 0, 68, 2864, 2864 },
+	{ 0, 68, 2868, 2868 },
+	{ 0, 68, 2872, 2872 },
+	{ 0, 68, 2877, 2877 },
+	{ 0, 68, 2882, 2882 },
+	{ 0, 68, 2887, 2887 },
+	{ 0, 68, 2892, 2892 },
+	{ 0, 68, 2897, 2897 },
+	{ 0, 68, 2902, 2902 },
+	{ 0, 68, 2906, 2906 },
+	{ 0, 68, 2910, 2910 },
+	{ 0, 68, 2915, 2915 },
+	{ 0, 68, 2920, 2920 },
+	{ 0, 68, 2925, 2925 },
+	{ 0, 68, 2930, 2930 },
+	{ 0, 68, 2935, 2935 },
+	{ 0, 68, 2940, 2940 },
+	{ 0, 68, 2944, 2944 },
+	{ 0, 68, 2948, 2948 },
+	{ 0, 68, 2953, 2953 },
+	{ 0, 68, 2958, 2958 },
+	{ 0, 68, 2963, 2963 },
+	{ 0, 68, 2968, 2968 },
+	{ 0, 68, 2973, 2973 },
+	{ 0, 68, 2978, 2978 },
+	{ 0, 68, 2982, 2982 },
+	{ 0, 68, 2986, 2986 },
+	{ 0, 68, 2991, 2991 },
+	{ 0, 68, 2996, 2996 },
+	{ 0, 68, 3001, 3001 },
+	{ 0, 68, 3006, 3006 },
+	{ 0, 68, 3011, 3011 },
+	{ 0, 68, 3016, 3016 },
+	{ 0, 68, 3020, 3020 },
+	{ 0, 68, 3024, 3024 },
+	{ 0, 68, 3029, 3029 },
+	{ 0, 68, 3034, 3034 },
+	{ 0, 68, 3039, 3039 },
+	{ 0, 68, 3044, 3044 },
+	{ 0, 68, 3049, 3049 },
+	{ 0, 68, 3054, 3054 },
+	{ 0, 68, 3058, 3058 },
+	{ 0, 68, 3062, 3062 },
+	{ 0, 68, 3067, 3067 },
+	{ 0, 68, 3072, 3072 },
+	{ 0, 68, 3077, 3077 },
+	{ 0, 68, 3082, 3082 },
+	{ 0, 68, 3087, 3087 },
+	{ 0, 68, 3092, 3092 },
+	{ 0, 68, 3095, 3095 },
+	{ 0, 68, 3098, 3098 },
+	{ 0, 68, 3102, 3102 },
+	{ 0, 68, 3105, 3105 },
+	{ 0, 68, 3109, 3109 },
+	{ 0, 68, 3112, 3112 },
+	{ 0, 68, 3116, 3116 },
+	{ 0, 68, 3119, 3119 },
+	{ 0, 68, 3122, 3122 },
+	{ 0, 85, 940, 940 },
+	{ 0, 68, 3125, 3125 },
+	{ 0, 80, 0, 3128 },
+	{ 0, 85, 3131, 3131 },
+	{ 0, 80, 0, 3133 },
+	{ 0, 84, 3136, 3139 },
+	{ 0, 68, 3143, 3143 },
+	{ 0, 68, 3147, 3147 },
+	{ 0, 68, 3150, 3150 },
+	{ 0, 68, 3154, 3154 },
+	{ 0, 68, 3157, 3157 },
+	{ 0, 68, 3161, 3161 },
+	{ 0, 85, 945, 945 },
+	{ 0, 68, 3164, 3164 },
+	{ 0, 85, 948, 948 },
+	{ 0, 68, 3167, 3167 },
+	{ 0, 84, 3170, 3173 },
+	{ 0, 84, 3177, 3180 },
+	{ 0, 84, 3184, 3187 },
+	{ 0, 68, 3191, 3191 },
+	{ 0, 68, 3194, 3194 },
+	{ 0, 68, 3197, 3197 },
+	{ 0, 85, 963, 963 },
+	{ 0, 68, 3201, 3201 },
+	{ 0, 68, 3204, 3204 },
+	{ 0, 68, 3208, 3208 },
+	{ 0, 68, 3211, 3211 },
+	{ 0, 68, 3214, 3214 },
+	{ 0, 85, 951, 951 },
+	{ 0, 84, 3217, 3220 },
+	{ 0, 84, 3224, 3227 },
+	{ 0, 84, 3231, 3234 },
+	{ 0, 68, 3238, 3238 },
+	{ 0, 68, 3241, 3241 },
+	{ 0, 68, 3244, 3244 },
+	{ 0, 85, 985, 985 },
+	{ 0, 68, 3248, 3248 },
+	{ 0, 68, 3251, 3251 },
+	{ 0, 68, 3254, 3254 },
+	{ 0, 68, 3257, 3257 },
+	{ 0, 68, 3261, 3261 },
+	{ 0, 68, 3264, 3264 },
+	{ 0, 68, 3267, 3267 },
+	{ 0, 85, 957, 957 },
+	{ 0, 68, 3270, 3270 },
+	{ 0, 84, 3273, 3276 },
+	{ 0, 85, 933, 936 },
+	{ 0, 85, 3280, 3280 },
+	{ 0, 68, 3282, 3282 },
+	{ 0, 68, 3286, 3286 },
+	{ 0, 68, 3289, 3289 },
+	{ 0, 68, 3293, 3293 },
+	{ 0, 68, 3296, 3296 },
+	{ 0, 68, 3300, 3300 },
+	{ 0, 85, 954, 954 },
+	{ 0, 68, 3303, 3303 },
+	{ 0, 85, 960, 960 },
+	{ 0, 68, 3306, 3306 },
+	{ 0, 85, 3309, 15 },
+	{ 0, 80, 0, 3311 },
+	{ 0, 85, 3314, 1 },
+	{ 0, 85, 3316, 1 },
+	{ 0, 80, 0, 3318 },
+	{ 0, 80, 0, 3320 },
+	{ 0, 80, 0, 3323 },
+	{ 0, 80, 0, 3325 },
+	{ 0, 80, 0, 3328 },
+	{ 0, 80, 0, 3332 },
+	{ 0, 80, 0, 3335 },
+	{ 0, 80, 0, 3339 },
+	{ 0, 80, 0, 3342 },
+	{ 0, 80, 0, 3346 },
+	{ 0, 80, 0, 3349 },
+	{ 0, 80, 0, 3352 },
+	{ 0, 80, 0, 3355 },
+	{ 0, 80, 0, 3358 },
+	{ 0, 80, 0, 3361 },
+	{ 0, 80, 0, 3366 },
+	{ 0, 80, 0, 3368 },
+	{ 0, 80, 0, 3370 },
+	{ 0, 80, 0, 3372 },
+	{ 0, 80, 0, 3374 },
+	{ 0, 80, 0, 3376 },
+	{ 0, 80, 0, 3378 },
+	{ 0, 80, 0, 3380 },
+	{ 0, 80, 0, 3382 },
+	{ 0, 80, 0, 3384 },
+	{ 0, 80, 0, 3386 },
+	{ 0, 80, 0, 3388 },
+	{ 0, 80, 0, 3390 },
+	{ 0, 80, 0, 3392 },
+	{ 0, 80, 0, 3395 },
+	{ 0, 80, 0, 3399 },
+	{ 0, 80, 0, 3403 },
+	{ 0, 80, 0, 3405 },
+	{ 0, 80, 0, 3408 },
+	{ 0, 80, 0, 3412 },
+	{ 0, 80, 0, 3416 },
+	{ 0, 80, 0, 3418 },
+	{ 0, 80, 0, 3421 },
+	{ 0, 80, 0, 3423 },
+	{ 0, 80, 0, 3426 },
+	{ 0, 80, 0, 3428 },
+	{ 0, 80, 0, 3431 },
+	{ 0, 80, 0, 3435 },
+	{ 0, 80, 0, 3438 },
+	{ 0, 85, 3440, 3440 },
+	{ 0, 85, 1492, 1492 },
+	{ 0, 85, 54, 54 },
+	{ 0, 80, 0, 3442 },
+	{ 0, 80, 0, 3444 },
+	{ 0, 80, 0, 3446 },
+	{ 0, 80, 0, 3448 },
+	{ 0, 80, 0, 3450 },
+	{ 0, 80, 0, 3452 },
+	{ 0, 80, 0, 3456 },
+	{ 0, 80, 0, 3458 },
+	{ 0, 80, 0, 3460 },
+	{ 0, 80, 0, 3462 },
+	{ 0, 80, 0, 3466 },
+	{ 0, 80, 0, 3470 },
+	{ 0, 80, 0, 3475 },
+	{ 0, 80, 0, 3479 },
+	{ 0, 80, 0, 3483 },
+	{ 0, 80, 0, 3487 },
+	{ 0, 80, 0, 3491 },
+	{ 0, 80, 0, 3495 },
+	{ 0, 80, 0, 3499 },
+	{ 0, 80, 0, 3503 },
+	{ 0, 80, 0, 3507 },
+	{ 0, 80, 0, 3511 },
+	{ 0, 80, 0, 3515 },
+	{ 0, 80, 0, 3519 },
+	{ 0, 80, 0, 3523 },
+	{ 0, 80, 0, 3526 },
+	{ 0, 80, 0, 3529 },
+	{ 0, 80, 0, 3533 },
+	{ 0, 80, 0, 3536 },
+	{ 0, 80, 0, 3538 },
+	{ 0, 80, 0, 3541 },
+	{ 0, 80, 0, 3545 },
+	{ 0, 80, 0, 3550 },
+	{ 0, 80, 0, 3553 },
+	{ 0, 80, 0, 3555 },
+	{ 0, 80, 0, 3558 },
+	{ 0, 80, 0, 3562 },
+	{ 0, 80, 0, 3565 },
+	{ 0, 80, 0, 3569 },
+	{ 0, 80, 0, 3572 },
+	{ 0, 80, 0, 3575 },
+	{ 0, 80, 0, 3579 },
+	{ 0, 80, 0, 3584 },
+	{ 0, 80, 0, 3587 },
+	{ 0, 80, 0, 3590 },
+	{ 0, 80, 0, 3594 },
+	{ 0, 68, 3598, 3598 },
+	{ 0, 68, 3601, 3601 },
+	{ 0, 68, 3604, 3604 },
+	{ 0, 68, 3607, 3607 },
+	{ 0, 68, 3610, 3610 },
+	{ 0, 68, 3613, 3613 },
+	{ 0, 68, 3616, 3616 },
+	{ 0, 68, 3619, 3619 },
+	{ 0, 68, 3622, 3622 },
+	{ 0, 68, 3625, 3625 },
+	{ 0, 68, 3628, 3628 },
+	{ 0, 80, 0, 3631 },
+	{ 0, 80, 0, 3634 },
+	{ 0, 80, 0, 3638 },
+	{ 0, 80, 0, 3641 },
+	{ 0, 68, 3645, 3645 },
+	{ 0, 68, 3648, 3648 },
+	{ 0, 68, 3651, 3651 },
+	{ 0, 68, 3654, 3654 },
+	{ 0, 68, 3657, 3657 },
+	{ 0, 68, 3660, 3660 },
+	{ 0, 68, 3663, 3663 },
+	{ 0, 68, 3666, 3666 },
+	{ 0, 68, 3669, 3669 },
+	{ 0, 68, 3672, 3672 },
+	{ 0, 68, 3675, 3675 },
+	{ 0, 68, 3678, 3678 },
+	{ 0, 68, 3681, 3681 },
+	{ 0, 68, 3684, 3684 },
+	{ 0, 68, 3687, 3687 },
+	{ 0, 68, 3690, 3690 },
+	{ 0, 68, 3693, 3693 },
+	{ 0, 68, 3696, 3696 },
+	{ 0, 68, 3699, 3699 },
+	{ 0, 68, 3702, 3702 },
+	{ 0, 68, 3705, 3705 },
+	{ 0, 68, 3708, 3708 },
+	{ 0, 68, 3711, 3711 },
+	{ 0, 68, 3714, 3714 },
+	{ 0, 68, 3717, 3717 },
+	{ 0, 68, 3720, 3720 },
+	{ 0, 68, 3723, 3723 },
+	{ 0, 68, 3726, 3726 },
+	{ 0, 68, 3729, 3729 },
+	{ 0, 68, 3732, 3732 },
+	{ 0, 68, 3735, 3735 },
+	{ 0, 68, 3738, 3738 },
+	{ 0, 68, 3741, 3741 },
+	{ 0, 85, 3744, 3744 },
+	{ 0, 85, 3746, 3746 },
+	{ 0, 80, 0, 3748 },
+	{ 0, 80, 0, 3751 },
+	{ 0, 80, 0, 3754 },
+	{ 0, 80, 0, 3757 },
+	{ 0, 80, 0, 3760 },
+	{ 0, 80, 0, 3763 },
+	{ 0, 80, 0, 3766 },
+	{ 0, 80, 0, 3769 },
+	{ 0, 80, 0, 3772 },
+	{ 0, 80, 0, 3775 },
+	{ 0, 80, 0, 3778 },
+	{ 0, 80, 0, 3781 },
+	{ 0, 80, 0, 3785 },
+	{ 0, 80, 0, 3789 },
+	{ 0, 80, 0, 3793 },
+	{ 0, 80, 0, 3797 },
+	{ 0, 80, 0, 3801 },
+	{ 0, 80, 0, 3805 },
+	{ 0, 80, 0, 3809 },
+	{ 0, 80, 0, 3813 },
+	{ 0, 80, 0, 3817 },
+	{ 0, 80, 0, 3822 },
+	{ 0, 80, 0, 3827 },
+	{ 0, 80, 0, 3832 },
+	{ 0, 80, 0, 3837 },
+	{ 0, 80, 0, 3842 },
+	{ 0, 80, 0, 3847 },
+	{ 0, 80, 0, 3852 },
+	{ 0, 80, 0, 3857 },
+	{ 0, 80, 0, 3862 },
+	{ 0, 80, 0, 3867 },
+	{ 0, 80, 0, 3872 },
+	{ 0, 80, 0, 3875 },
+	{ 0, 80, 0, 3878 },
+	{ 0, 80, 0, 3881 },
+	{ 0, 80, 0, 3884 },
+	{ 0, 80, 0, 3887 },
+	{ 0, 80, 0, 3890 },
+	{ 0, 80, 0, 3893 },
+	{ 0, 80, 0, 3896 },
+	{ 0, 80, 0, 3899 },
+	{ 0, 80, 0, 3903 },
+	{ 0, 80, 0, 3907 },
+	{ 0, 80, 0, 3911 },
+	{ 0, 80, 0, 3915 },
+	{ 0, 80, 0, 3919 },
+	{ 0, 80, 0, 3923 },
+	{ 0, 80, 0, 3927 },
+	{ 0, 80, 0, 3931 },
+	{ 0, 80, 0, 3935 },
+	{ 0, 80, 0, 3939 },
+	{ 0, 80, 0, 3943 },
+	{ 0, 80, 0, 3947 },
+	{ 0, 80, 0, 3951 },
+	{ 0, 80, 0, 3955 },
+	{ 0, 80, 0, 3959 },
+	{ 0, 80, 0, 3963 },
+	{ 0, 80, 0, 3967 },
+	{ 0, 80, 0, 3971 },
+	{ 0, 80, 0, 3975 },
+	{ 0, 80, 0, 3979 },
+	{ 0, 80, 0, 3983 },
+	{ 0, 80, 0, 3987 },
+	{ 0, 80, 0, 3991 },
+	{ 0, 80, 0, 3995 },
+	{ 0, 80, 0, 3999 },
+	{ 0, 80, 0, 4003 },
+	{ 0, 80, 0, 4007 },
+	{ 0, 80, 0, 4011 },
+	{ 0, 80, 0, 4015 },
+	{ 0, 80, 0, 4019 },
+	{ 0, 80, 0, 4023 },
+	{ 0, 80, 0, 4027 },
+	{ 0, 80, 0, 4031 },
+	{ 0, 80, 0, 4035 },
+	{ 0, 80, 0, 4039 },
+	{ 0, 80, 0, 4043 },
+	{ 0, 80, 0, 4047 },
+	{ 0, 80, 0, 4049 },
+	{ 0, 80, 0, 4051 },
+	{ 0, 80, 0, 4053 },
+	{ 0, 80, 0, 4058 },
+	{ 0, 80, 0, 4062 },
+	{ 0, 80, 0, 4065 },
+	{ 0, 85, 4069, 4069 },
+	{ 0, 80, 0, 4072 },
+	{ 0, 80, 0, 4074 },
+	{ 0, 80, 0, 4076 },
+	{ 0, 80, 0, 4078 },
+	{ 0, 80, 0, 4080 },
+	{ 0, 80, 0, 4082 },
+	{ 0, 80, 0, 4084 },
+	{ 0, 80, 0, 4086 },
+	{ 0, 80, 0, 4088 },
+	{ 0, 80, 0, 4090 },
+	{ 0, 80, 0, 4092 },
+	{ 0, 80, 0, 4094 },
+	{ 0, 80, 0, 4096 },
+	{ 0, 80, 0, 4098 },
+	{ 0, 80, 0, 4100 },
+	{ 0, 80, 0, 4102 },
+	{ 0, 80, 0, 4104 },
+	{ 0, 80, 0, 4106 },
+	{ 0, 80, 0, 4108 },
+	{ 0, 80, 0, 4110 },
+	{ 0, 80, 0, 4112 },
+	{ 0, 80, 0, 4114 },
+	{ 0, 80, 0, 4116 },
+	{ 0, 80, 0, 4118 },
+	{ 0, 80, 0, 4120 },
+	{ 0, 80, 0, 4122 },
+	{ 0, 80, 0, 4124 },
+	{ 0, 80, 0, 4126 },
+	{ 0, 80, 0, 4128 },
+	{ 0, 80, 0, 4130 },
+	{ 0, 80, 0, 4132 },
+	{ 0, 80, 0, 4134 },
+	{ 0, 80, 0, 4136 },
+	{ 0, 80, 0, 4138 },
+	{ 0, 80, 0, 4140 },
+	{ 0, 80, 0, 4142 },
+	{ 0, 80, 0, 4144 },
+	{ 0, 80, 0, 4146 },
+	{ 0, 80, 0, 4148 },
+	{ 0, 80, 0, 4150 },
+	{ 0, 80, 0, 4152 },
+	{ 0, 80, 0, 4154 },
+	{ 0, 80, 0, 4156 },
+	{ 0, 80, 0, 4158 },
+	{ 0, 80, 0, 4160 },
+	{ 0, 80, 0, 4162 },
+	{ 0, 80, 0, 4164 },
+	{ 0, 80, 0, 4166 },
+	{ 0, 80, 0, 4168 },
+	{ 0, 80, 0, 4170 },
+	{ 0, 80, 0, 4172 },
+	{ 0, 80, 0, 4174 },
+	{ 0, 80, 0, 4176 },
+	{ 0, 80, 0, 4178 },
+	{ 0, 80, 0, 4180 },
+	{ 0, 80, 0, 4182 },
+	{ 0, 80, 0, 4184 },
+	{ 0, 80, 0, 4186 },
+	{ 0, 80, 0, 4188 },
+	{ 0, 80, 0, 4190 },
+	{ 0, 80, 0, 4192 },
+	{ 0, 80, 0, 4194 },
+	{ 0, 80, 0, 4196 },
+	{ 0, 80, 0, 4198 },
+	{ 0, 80, 0, 4200 },
+	{ 0, 80, 0, 4202 },
+	{ 0, 80, 0, 4204 },
+	{ 0, 80, 0, 4206 },
+	{ 0, 80, 0, 4208 },
+	{ 0, 80, 0, 4210 },
+	{ 0, 80, 0, 4212 },
+	{ 0, 80, 0, 4214 },
+	{ 0, 80, 0, 4216 },
+	{ 0, 80, 0, 4218 },
+	{ 0, 80, 0, 4220 },
+	{ 0, 80, 0, 4222 },
+	{ 0, 80, 0, 4224 },
+	{ 0, 80, 0, 4226 },
+	{ 0, 80, 0, 4228 },
+	{ 0, 80, 0, 4230 },
+	{ 0, 80, 0, 4232 },
+	{ 0, 80, 0, 4234 },
+	{ 0, 80, 0, 4236 },
+	{ 0, 80, 0, 4238 },
+	{ 0, 80, 0, 4240 },
+	{ 0, 80, 0, 4242 },
+	{ 0, 80, 0, 4244 },
+	{ 0, 80, 0, 4246 },
+	{ 0, 80, 0, 4248 },
+	{ 0, 80, 0, 4250 },
+	{ 0, 80, 0, 4252 },
+	{ 0, 80, 0, 4254 },
+	{ 0, 80, 0, 4256 },
+	{ 0, 80, 0, 4258 },
+	{ 0, 80, 0, 4260 },
+	{ 0, 80, 0, 4262 },
+	{ 0, 80, 0, 4264 },
+	{ 0, 80, 0, 4266 },
+	{ 0, 80, 0, 4268 },
+	{ 0, 80, 0, 4270 },
+	{ 0, 80, 0, 4272 },
+	{ 0, 80, 0, 4274 },
+	{ 0, 80, 0, 4276 },
+	{ 0, 80, 0, 4278 },
+	{ 0, 80, 0, 4280 },
+	{ 0, 80, 0, 4282 },
+	{ 0, 80, 0, 4284 },
+	{ 0, 80, 0, 4286 },
+	{ 0, 80, 0, 4288 },
+	{ 0, 80, 0, 4290 },
+	{ 0, 80, 0, 4292 },
+	{ 0, 80, 0, 4294 },
+	{ 0, 80, 0, 4296 },
+	{ 0, 80, 0, 4298 },
+	{ 0, 80, 0, 4300 },
+	{ 0, 80, 0, 4302 },
+	{ 0, 80, 0, 4304 },
+	{ 0, 80, 0, 4306 },
+	{ 0, 80, 0, 4308 },
+	{ 0, 80, 0, 4310 },
+	{ 0, 80, 0, 4312 },
+	{ 0, 80, 0, 4314 },
+	{ 0, 80, 0, 4316 },
+	{ 0, 80, 0, 4318 },
+	{ 0, 80, 0, 4320 },
+	{ 0, 80, 0, 4322 },
+	{ 0, 80, 0, 4324 },
+	{ 0, 80, 0, 4326 },
+	{ 0, 80, 0, 4328 },
+	{ 0, 80, 0, 4330 },
+	{ 0, 80, 0, 4332 },
+	{ 0, 80, 0, 4334 },
+	{ 0, 80, 0, 4336 },
+	{ 0, 80, 0, 4338 },
+	{ 0, 80, 0, 4340 },
+	{ 0, 80, 0, 4342 },
+	{ 0, 80, 0, 4344 },
+	{ 0, 80, 0, 4346 },
+	{ 0, 80, 0, 4348 },
+	{ 0, 80, 0, 4350 },
+	{ 0, 80, 0, 4352 },
+	{ 0, 80, 0, 4354 },
+	{ 0, 80, 0, 4356 },
+	{ 0, 80, 0, 4358 },
+	{ 0, 80, 0, 4360 },
+	{ 0, 80, 0, 4362 },
+	{ 0, 80, 0, 4364 },
+	{ 0, 80, 0, 4366 },
+	{ 0, 80, 0, 4368 },
+	{ 0, 80, 0, 4370 },
+	{ 0, 80, 0, 4372 },
+	{ 0, 80, 0, 4374 },
+	{ 0, 80, 0, 4376 },
+	{ 0, 80, 0, 4378 },
+	{ 0, 80, 0, 4380 },
+	{ 0, 80, 0, 4382 },
+	{ 0, 80, 0, 4384 },
+	{ 0, 80, 0, 4386 },
+	{ 0, 80, 0, 4388 },
+	{ 0, 80, 0, 4390 },
+	{ 0, 80, 0, 4392 },
+	{ 0, 80, 0, 4394 },
+	{ 0, 80, 0, 4396 },
+	{ 0, 80, 0, 4398 },
+	{ 0, 80, 0, 4400 },
+	{ 0, 80, 0, 4402 },
+	{ 0, 80, 0, 4404 },
+	{ 0, 80, 0, 4406 },
+	{ 0, 80, 0, 4408 },
+	{ 0, 80, 0, 4410 },
+	{ 0, 80, 0, 4412 },
+	{ 0, 80, 0, 4414 },
+	{ 0, 80, 0, 4416 },
+	{ 0, 80, 0, 4418 },
+	{ 0, 80, 0, 4420 },
+	{ 0, 80, 0, 4422 },
+	{ 0, 80, 0, 4424 },
+	{ 0, 80, 0, 4426 },
+	{ 0, 80, 0, 4428 },
+	{ 0, 80, 0, 4430 },
+	{ 0, 80, 0, 4432 },
+	{ 0, 80, 0, 4434 },
+	{ 0, 80, 0, 4436 },
+	{ 0, 80, 0, 4438 },
+	{ 0, 80, 0, 4440 },
+	{ 0, 80, 0, 4442 },
+	{ 0, 80, 0, 4444 },
+	{ 0, 80, 0, 4446 },
+	{ 0, 80, 0, 4448 },
+	{ 0, 80, 0, 4450 },
+	{ 0, 80, 0, 4452 },
+	{ 0, 80, 0, 4454 },
+	{ 0, 80, 0, 4456 },
+	{ 0, 80, 0, 4458 },
+	{ 0, 80, 0, 4460 },
+	{ 0, 80, 0, 4462 },
+	{ 0, 80, 0, 4464 },
+	{ 0, 80, 0, 4466 },
+	{ 0, 80, 0, 4468 },
+	{ 0, 80, 0, 4470 },
+	{ 0, 80, 0, 4472 },
+	{ 0, 80, 0, 4474 },
+	{ 0, 80, 0, 4476 },
+	{ 0, 80, 0, 4478 },
+	{ 0, 80, 0, 4480 },
+	{ 0, 80, 0, 4482 },
+	{ 0, 80, 0, 4484 },
+	{ 0, 80, 0, 4486 },
+	{ 0, 80, 0, 4488 },
+	{ 0, 80, 0, 4490 },
+	{ 0, 80, 0, 4492 },
+	{ 0, 80, 0, 4494 },
+	{ 0, 80, 0, 4496 },
+	{ 0, 80, 0, 4498 },
+	{ 0, 80, 0, 4500 },
+	{ 0, 80, 0, 4502 },
+	{ 0, 80, 0, 4504 },
+	{ 224, 0, 0, 0 },
+	{ 0, 80, 0, 4506 },
+	{ 0, 80, 0, 4508 },
+	{ 0, 80, 0, 4510 },
+	{ 0, 68, 4512, 4512 },
+	{ 0, 68, 4515, 4515 },
+	{ 0, 68, 4518, 4518 },
+	{ 0, 68, 4521, 4521 },
+	{ 0, 68, 4524, 4524 },
+	{ 0, 68, 4527, 4527 },
+	{ 0, 68, 4530, 4530 },
+	{ 0, 68, 4533, 4533 },
+	{ 0, 68, 4536, 4536 },
+	{ 0, 68, 4539, 4539 },
+	{ 0, 68, 4542, 4542 },
+	{ 0, 68, 4545, 4545 },
+	{ 0, 68, 4548, 4548 },
+	{ 0, 68, 4551, 4551 },
+	{ 0, 68, 4554, 4554 },
+	{ 0, 68, 4557, 4557 },
+	{ 0, 68, 4560, 4560 },
+	{ 0, 68, 4563, 4563 },
+	{ 0, 68, 4566, 4566 },
+	{ 0, 68, 4569, 4569 },
+	{ 0, 68, 4572, 4572 },
+	{ 0, 68, 4575, 4575 },
+	{ 0, 68, 4578, 4578 },
+	{ 0, 68, 4581, 4581 },
+	{ 0, 68, 4584, 4584 },
+	{ 0, 68, 4587, 4587 },
+	{ 8, 34, 0, 0 },
+	{ 0, 80, 0, 4590 },
+	{ 0, 80, 0, 4593 },
+	{ 0, 68, 4596, 4596 },
+	{ 0, 80, 0, 4599 },
+	{ 0, 68, 4602, 4602 },
+	{ 0, 68, 4605, 4605 },
+	{ 0, 68, 4608, 4608 },
+	{ 0, 68, 4611, 4611 },
+	{ 0, 68, 4614, 4614 },
+	{ 0, 68, 4617, 4617 },
+	{ 0, 68, 4620, 4620 },
+	{ 0, 68, 4623, 4623 },
+	{ 0, 68, 4626, 4626 },
+	{ 0, 68, 4629, 4629 },
+	{ 0, 68, 4632, 4632 },
+	{ 0, 68, 4635, 4635 },
+	{ 0, 68, 4638, 4638 },
+	{ 0, 68, 4641, 4641 },
+	{ 0, 68, 4644, 4644 },
+	{ 0, 68, 4647, 4647 },
+	{ 0, 68, 4650, 4650 },
+	{ 0, 68, 4653, 4653 },
+	{ 0, 68, 4656, 4656 },
+	{ 0, 68, 4659, 4659 },
+	{ 0, 68, 4662, 4662 },
+	{ 0, 68, 4665, 4665 },
+	{ 0, 68, 4668, 4668 },
+	{ 0, 68, 4671, 4671 },
+	{ 0, 68, 4674, 4674 },
+	{ 0, 68, 4677, 4677 },
+	{ 0, 68, 4680, 4680 },
+	{ 0, 68, 4683, 4683 },
+	{ 0, 68, 4686, 4686 },
+	{ 0, 68, 4689, 4689 },
+	{ 0, 68, 4692, 4692 },
+	{ 0, 80, 0, 4695 },
+	{ 0, 80, 0, 4698 },
+	{ 0, 80, 0, 4700 },
+	{ 0, 80, 0, 4702 },
+	{ 0, 80, 0, 4704 },
+	{ 0, 80, 0, 4706 },
+	{ 0, 80, 0, 4708 },
+	{ 0, 80, 0, 4710 },
+	{ 0, 80, 0, 4712 },
+	{ 0, 80, 0, 4714 },
+	{ 0, 80, 0, 4716 },
+	{ 0, 80, 0, 4718 },
+	{ 0, 80, 0, 4720 },
+	{ 0, 80, 0, 4722 },
+	{ 0, 80, 0, 4724 },
+	{ 0, 80, 0, 4726 },
+	{ 0, 80, 0, 4728 },
+	{ 0, 80, 0, 4730 },
+	{ 0, 80, 0, 4732 },
+	{ 0, 80, 0, 4734 },
+	{ 0, 80, 0, 4736 },
+	{ 0, 80, 0, 4738 },
+	{ 0, 80, 0, 4740 },
+	{ 0, 80, 0, 4742 },
+	{ 0, 80, 0, 4744 },
+	{ 0, 80, 0, 4746 },
+	{ 0, 80, 0, 4748 },
+	{ 0, 80, 0, 4750 },
+	{ 0, 80, 0, 4752 },
+	{ 0, 80, 0, 4754 },
+	{ 0, 80, 0, 4756 },
+	{ 0, 80, 0, 4758 },
+	{ 0, 80, 0, 4760 },
+	{ 0, 80, 0, 4762 },
+	{ 0, 80, 0, 4764 },
+	{ 0, 80, 0, 4766 },
+	{ 0, 80, 0, 4768 },
+	{ 0, 80, 0, 4770 },
+	{ 0, 80, 0, 4772 },
+	{ 0, 80, 0, 4774 },
+	{ 0, 80, 0, 4776 },
+	{ 0, 80, 0, 4778 },
+	{ 0, 80, 0, 4780 },
+	{ 0, 80, 0, 4782 },
+	{ 0, 80, 0, 4784 },
+	{ 0, 80, 0, 4786 },
+	{ 0, 80, 0, 4788 },
+	{ 0, 80, 0, 4790 },
+	{ 0, 80, 0, 4792 },
+	{ 0, 80, 0, 4794 },
+	{ 0, 80, 0, 4796 },
+	{ 0, 80, 0, 4798 },
+	{ 0, 80, 0, 4800 },
+	{ 0, 80, 0, 4802 },
+	{ 0, 80, 0, 4804 },
+	{ 0, 80, 0, 4806 },
+	{ 0, 80, 0, 4808 },
+	{ 0, 80, 0, 4810 },
+	{ 0, 80, 0, 4812 },
+	{ 0, 80, 0, 4814 },
+	{ 0, 80, 0, 4816 },
+	{ 0, 80, 0, 4818 },
+	{ 0, 80, 0, 4820 },
+	{ 0, 80, 0, 4822 },
+	{ 0, 80, 0, 4824 },
+	{ 0, 80, 0, 4826 },
+	{ 0, 80, 0, 4828 },
+	{ 0, 80, 0, 4830 },
+	{ 0, 80, 0, 4832 },
+	{ 0, 80, 0, 4834 },
+	{ 0, 80, 0, 4836 },
+	{ 0, 80, 0, 4838 },
+	{ 0, 80, 0, 4840 },
+	{ 0, 80, 0, 4842 },
+	{ 0, 80, 0, 4844 },
+	{ 0, 80, 0, 4846 },
+	{ 0, 80, 0, 4848 },
+	{ 0, 80, 0, 4850 },
+	{ 0, 80, 0, 4852 },
+	{ 0, 80, 0, 4854 },
+	{ 0, 80, 0, 4856 },
+	{ 0, 80, 0, 4858 },
+	{ 0, 80, 0, 4860 },
+	{ 0, 80, 0, 4862 },
+	{ 0, 80, 0, 4864 },
+	{ 0, 80, 0, 4866 },
+	{ 0, 80, 0, 4868 },
+	{ 0, 80, 0, 4870 },
+	{ 0, 80, 0, 4872 },
+	{ 0, 80, 0, 4874 },
+	{ 0, 80, 0, 4876 },
+	{ 0, 80, 0, 4878 },
+	{ 0, 80, 0, 4880 },
+	{ 0, 80, 0, 4882 },
+	{ 0, 80, 0, 4884 },
+	{ 0, 80, 0, 4886 },
+	{ 0, 80, 0, 4888 },
+	{ 0, 80, 0, 4890 },
+	{ 0, 80, 0, 4892 },
+	{ 0, 80, 0, 4894 },
+	{ 0, 80, 0, 4896 },
+	{ 0, 80, 0, 4898 },
+	{ 0, 80, 0, 4900 },
+	{ 0, 80, 0, 4902 },
+	{ 0, 80, 0, 4904 },
+	{ 0, 80, 0, 4906 },
+	{ 0, 80, 0, 4910 },
+	{ 0, 80, 0, 4914 },
+	{ 0, 80, 0, 4918 },
+	{ 0, 80, 0, 4922 },
+	{ 0, 80, 0, 4926 },
+	{ 0, 80, 0, 4930 },
+	{ 0, 80, 0, 4934 },
+	{ 0, 80, 0, 4938 },
+	{ 0, 80, 0, 4942 },
+	{ 0, 80, 0, 4946 },
+	{ 0, 80, 0, 4950 },
+	{ 0, 80, 0, 4954 },
+	{ 0, 80, 0, 4958 },
+	{ 0, 80, 0, 4962 },
+	{ 0, 80, 0, 4967 },
+	{ 0, 80, 0, 4972 },
+	{ 0, 80, 0, 4977 },
+	{ 0, 80, 0, 4982 },
+	{ 0, 80, 0, 4987 },
+	{ 0, 80, 0, 4992 },
+	{ 0, 80, 0, 4997 },
+	{ 0, 80, 0, 5002 },
+	{ 0, 80, 0, 5007 },
+	{ 0, 80, 0, 5012 },
+	{ 0, 80, 0, 5017 },
+	{ 0, 80, 0, 5022 },
+	{ 0, 80, 0, 5027 },
+	{ 0, 80, 0, 5032 },
+	{ 0, 80, 0, 5037 },
+	{ 0, 80, 0, 5045 },
+	{ 0, 80, 0, 5052 },
+	{ 0, 80, 0, 5056 },
+	{ 0, 80, 0, 5060 },
+	{ 0, 80, 0, 5064 },
+	{ 0, 80, 0, 5068 },
+	{ 0, 80, 0, 5072 },
+	{ 0, 80, 0, 5076 },
+	{ 0, 80, 0, 5080 },
+	{ 0, 80, 0, 5084 },
+	{ 0, 80, 0, 5088 },
+	{ 0, 80, 0, 5092 },
+	{ 0, 80, 0, 5096 },
+	{ 0, 80, 0, 5100 },
+	{ 0, 80, 0, 5104 },
+	{ 0, 80, 0, 5108 },
+	{ 0, 80, 0, 5112 },
+	{ 0, 80, 0, 5116 },
+	{ 0, 80, 0, 5120 },
+	{ 0, 80, 0, 5124 },
+	{ 0, 80, 0, 5128 },
+	{ 0, 80, 0, 5132 },
+	{ 0, 80, 0, 5136 },
+	{ 0, 80, 0, 5140 },
+	{ 0, 80, 0, 5144 },
+	{ 0, 80, 0, 5148 },
+	{ 0, 80, 0, 5152 },
+	{ 0, 80, 0, 5156 },
+	{ 0, 80, 0, 5160 },
+	{ 0, 80, 0, 5164 },
+	{ 0, 80, 0, 5168 },
+	{ 0, 80, 0, 5172 },
+	{ 0, 80, 0, 5176 },
+	{ 0, 80, 0, 5180 },
+	{ 0, 80, 0, 5184 },
+	{ 0, 80, 0, 5188 },
+	{ 0, 80, 0, 5192 },
+	{ 0, 80, 0, 5196 },
+	{ 0, 80, 0, 5198 },
+	{ 0, 80, 0, 5200 },
+	{ 0, 80, 0, 5202 },
+	{ 0, 80, 0, 5206 },
+	{ 0, 80, 0, 5209 },
+	{ 0, 80, 0, 5212 },
+	{ 0, 80, 0, 5215 },
+	{ 0, 80, 0, 5218 },
+	{ 0, 80, 0, 5221 },
+	{ 0, 80, 0, 5224 },
+	{ 0, 80, 0, 5227 },
+	{ 0, 80, 0, 5230 },
+	{ 0, 80, 0, 5233 },
+	{ 0, 80, 0, 5236 },
+	{ 0, 80, 0, 5239 },
+	{ 0, 80, 0, 5242 },
+	{ 0, 80, 0, 5245 },
+	{ 0, 80, 0, 5248 },
+	{ 0, 80, 0, 5251 },
+	{ 0, 80, 0, 5254 },
+	{ 0, 80, 0, 5257 },
+	{ 0, 80, 0, 5260 },
+	{ 0, 80, 0, 5263 },
+	{ 0, 80, 0, 5266 },
+	{ 0, 80, 0, 5269 },
+	{ 0, 80, 0, 5272 },
+	{ 0, 80, 0, 5275 },
+	{ 0, 80, 0, 5278 },
+	{ 0, 80, 0, 5281 },
+	{ 0, 80, 0, 5284 },
+	{ 0, 80, 0, 5287 },
+	{ 0, 80, 0, 5290 },
+	{ 0, 80, 0, 5293 },
+	{ 0, 80, 0, 5299 },
+	{ 0, 80, 0, 5304 },
+	{ 0, 80, 0, 5307 },
+	{ 0, 80, 0, 5309 },
+	{ 0, 80, 0, 5311 },
+	{ 0, 80, 0, 5313 },
+	{ 0, 80, 0, 5315 },
+	{ 0, 80, 0, 5317 },
+	{ 0, 80, 0, 5319 },
+	{ 0, 80, 0, 5321 },
+	{ 0, 80, 0, 5323 },
+	{ 0, 80, 0, 5325 },
+	{ 0, 80, 0, 5327 },
+	{ 0, 80, 0, 5329 },
+	{ 0, 80, 0, 5331 },
+	{ 0, 80, 0, 5333 },
+	{ 0, 80, 0, 5335 },
+	{ 0, 80, 0, 5337 },
+	{ 0, 80, 0, 5339 },
+	{ 0, 80, 0, 5341 },
+	{ 0, 80, 0, 5343 },
+	{ 0, 80, 0, 5345 },
+	{ 0, 80, 0, 5347 },
+	{ 0, 80, 0, 5349 },
+	{ 0, 80, 0, 5351 },
+	{ 0, 80, 0, 5353 },
+	{ 0, 80, 0, 5355 },
+	{ 0, 80, 0, 5357 },
+	{ 0, 80, 0, 5359 },
+	{ 0, 80, 0, 5361 },
+	{ 0, 80, 0, 5363 },
+	{ 0, 80, 0, 5365 },
+	{ 0, 80, 0, 5367 },
+	{ 0, 80, 0, 5369 },
+	{ 0, 80, 0, 5371 },
+	{ 0, 80, 0, 5374 },
+	{ 0, 80, 0, 5377 },
+	{ 0, 80, 0, 5380 },
+	{ 0, 80, 0, 5383 },
+	{ 0, 80, 0, 5386 },
+	{ 0, 80, 0, 5389 },
+	{ 0, 80, 0, 5392 },
+	{ 0, 80, 0, 5395 },
+	{ 0, 80, 0, 5398 },
+	{ 0, 80, 0, 5401 },
+	{ 0, 80, 0, 5404 },
+	{ 0, 80, 0, 5407 },
+	{ 0, 80, 0, 5410 },
+	{ 0, 80, 0, 5413 },
+	{ 0, 80, 0, 5416 },
+	{ 0, 80, 0, 5419 },
+	{ 0, 80, 0, 5422 },
+	{ 0, 80, 0, 5425 },
+	{ 0, 80, 0, 5428 },
+	{ 0, 80, 0, 5431 },
+	{ 0, 80, 0, 5434 },
+	{ 0, 80, 0, 5437 },
+	{ 0, 80, 0, 5440 },
+	{ 0, 80, 0, 5443 },
+	{ 0, 80, 0, 5447 },
+	{ 0, 80, 0, 5451 },
+	{ 0, 80, 0, 5455 },
+	{ 0, 80, 0, 5458 },
+	{ 0, 80, 0, 5462 },
+	{ 0, 80, 0, 5465 },
+	{ 0, 80, 0, 5469 },
+	{ 0, 80, 0, 5471 },
+	{ 0, 80, 0, 5473 },
+	{ 0, 80, 0, 5475 },
+	{ 0, 80, 0, 5477 },
+	{ 0, 80, 0, 5479 },
+	{ 0, 80, 0, 5481 },
+	{ 0, 80, 0, 5483 },
+	{ 0, 80, 0, 5485 },
+	{ 0, 80, 0, 5487 },
+	{ 0, 80, 0, 5489 },
+	{ 0, 80, 0, 5491 },
+	{ 0, 80, 0, 5493 },
+	{ 0, 80, 0, 5495 },
+	{ 0, 80, 0, 5497 },
+	{ 0, 80, 0, 5499 },
+	{ 0, 80, 0, 5501 },
+	{ 0, 80, 0, 5503 },
+	{ 0, 80, 0, 5505 },
+	{ 0, 80, 0, 5507 },
+	{ 0, 80, 0, 5509 },
+	{ 0, 80, 0, 5511 },
+	{ 0, 80, 0, 5513 },
+	{ 0, 80, 0, 5515 },
+	{ 0, 80, 0, 5517 },
+	{ 0, 80, 0, 5519 },
+	{ 0, 80, 0, 5521 },
+	{ 0, 80, 0, 5523 },
+	{ 0, 80, 0, 5525 },
+	{ 0, 80, 0, 5527 },
+	{ 0, 80, 0, 5529 },
+	{ 0, 80, 0, 5531 },
+	{ 0, 80, 0, 5533 },
+	{ 0, 80, 0, 5535 },
+	{ 0, 80, 0, 5537 },
+	{ 0, 80, 0, 5539 },
+	{ 0, 80, 0, 5541 },
+	{ 0, 80, 0, 5543 },
+	{ 0, 80, 0, 5545 },
+	{ 0, 80, 0, 5547 },
+	{ 0, 80, 0, 5549 },
+	{ 0, 80, 0, 5551 },
+	{ 0, 80, 0, 5553 },
+	{ 0, 80, 0, 5555 },
+	{ 0, 80, 0, 5557 },
+	{ 0, 80, 0, 5559 },
+	{ 0, 80, 0, 5561 },
+	{ 0, 80, 0, 5563 },
+	{ 0, 80, 0, 5566 },
+	{ 0, 80, 0, 5572 },
+	{ 0, 80, 0, 5577 },
+	{ 0, 80, 0, 5583 },
+	{ 0, 80, 0, 5587 },
+	{ 0, 80, 0, 5593 },
+	{ 0, 80, 0, 5597 },
+	{ 0, 80, 0, 5601 },
+	{ 0, 80, 0, 5608 },
+	{ 0, 80, 0, 5613 },
+	{ 0, 80, 0, 5617 },
+	{ 0, 80, 0, 5621 },
+	{ 0, 80, 0, 5625 },
+	{ 0, 80, 0, 5630 },
+	{ 0, 80, 0, 5635 },
+	{ 0, 80, 0, 5640 },
+	{ 0, 80, 0, 5645 },
+	{ 0, 80, 0, 5650 },
+	{ 0, 80, 0, 5655 },
+	{ 0, 80, 0, 5660 },
+	{ 0, 80, 0, 5667 },
+	{ 0, 80, 0, 5670 },
+	{ 0, 80, 0, 5677 },
+	{ 0, 80, 0, 5684 },
+	{ 0, 80, 0, 5690 },
+	{ 0, 80, 0, 5695 },
+	{ 0, 80, 0, 5702 },
+	{ 0, 80, 0, 5709 },
+	{ 0, 80, 0, 5714 },
+	{ 0, 80, 0, 5718 },
+	{ 0, 80, 0, 5722 },
+	{ 0, 80, 0, 5727 },
+	{ 0, 80, 0, 5732 },
+	{ 0, 80, 0, 5738 },
+	{ 0, 80, 0, 5744 },
+	{ 0, 80, 0, 5748 },
+	{ 0, 80, 0, 5752 },
+	{ 0, 80, 0, 5757 },
+	{ 0, 80, 0, 5761 },
+	{ 0, 80, 0, 5765 },
+	{ 0, 80, 0, 5768 },
+	{ 0, 80, 0, 5771 },
+	{ 0, 80, 0, 5775 },
+	{ 0, 80, 0, 5779 },
+	{ 0, 80, 0, 5786 },
+	{ 0, 80, 0, 5791 },
+	{ 0, 80, 0, 5797 },
+	{ 0, 80, 0, 5804 },
+	{ 0, 80, 0, 5809 },
+	{ 0, 80, 0, 5813 },
+	{ 0, 80, 0, 5817 },
+	{ 0, 80, 0, 5824 },
+	{ 0, 80, 0, 5829 },
+	{ 0, 80, 0, 5836 },
+	{ 0, 80, 0, 5840 },
+	{ 0, 80, 0, 5846 },
+	{ 0, 80, 0, 5850 },
+	{ 0, 80, 0, 5855 },
+	{ 0, 80, 0, 5859 },
+	{ 0, 80, 0, 5864 },
+	{ 0, 80, 0, 5870 },
+	{ 0, 80, 0, 5875 },
+	{ 0, 80, 0, 5881 },
+	{ 0, 80, 0, 5886 },
+	{ 0, 80, 0, 5889 },
+	{ 0, 80, 0, 5895 },
+	{ 0, 80, 0, 5899 },
+	{ 0, 80, 0, 5903 },
+	{ 0, 80, 0, 5908 },
+	{ 0, 80, 0, 5912 },
+	{ 0, 80, 0, 5916 },
+	{ 0, 80, 0, 5920 },
+	{ 0, 80, 0, 5926 },
+	{ 0, 80, 0, 5931 },
+	{ 0, 80, 0, 5934 },
+	{ 0, 80, 0, 5941 },
+	{ 0, 80, 0, 5945 },
+	{ 0, 80, 0, 5951 },
+	{ 0, 80, 0, 5956 },
+	{ 0, 80, 0, 5961 },
+	{ 0, 80, 0, 5965 },
+	{ 0, 80, 0, 5969 },
+	{ 0, 80, 0, 5974 },
+	{ 0, 80, 0, 5977 },
+	{ 0, 80, 0, 5982 },
+	{ 0, 80, 0, 5988 },
+	{ 0, 80, 0, 5991 },
+	{ 0, 80, 0, 5998 },
+	{ 0, 80, 0, 6002 },
+	{ 0, 80, 0, 6005 },
+	{ 0, 80, 0, 6008 },
+	{ 0, 80, 0, 6011 },
+	{ 0, 80, 0, 6014 },
+	{ 0, 80, 0, 6017 },
+	{ 0, 80, 0, 6020 },
+	{ 0, 80, 0, 6023 },
+	{ 0, 80, 0, 6026 },
+	{ 0, 80, 0, 6029 },
+	{ 0, 80, 0, 6032 },
+	{ 0, 80, 0, 6036 },
+	{ 0, 80, 0, 6040 },
+	{ 0, 80, 0, 6044 },
+	{ 0, 80, 0, 6048 },
+	{ 0, 80, 0, 6052 },
+	{ 0, 80, 0, 6056 },
+	{ 0, 80, 0, 6060 },
+	{ 0, 80, 0, 6064 },
+	{ 0, 80, 0, 6068 },
+	{ 0, 80, 0, 6072 },
+	{ 0, 80, 0, 6076 },
+	{ 0, 80, 0, 6080 },
+	{ 0, 80, 0, 6084 },
+	{ 0, 80, 0, 6088 },
+	{ 0, 80, 0, 6092 },
+	{ 0, 80, 0, 6096 },
+	{ 0, 80, 0, 6099 },
+	{ 0, 80, 0, 6102 },
+	{ 0, 80, 0, 6106 },
+	{ 0, 80, 0, 6109 },
+	{ 0, 80, 0, 6112 },
+	{ 0, 80, 0, 6115 },
+	{ 0, 80, 0, 6119 },
+	{ 0, 80, 0, 6123 },
+	{ 0, 80, 0, 6126 },
+	{ 0, 80, 0, 6129 },
+	{ 0, 80, 0, 6132 },
+	{ 0, 80, 0, 6135 },
+	{ 0, 80, 0, 6138 },
+	{ 0, 80, 0, 6143 },
+	{ 0, 80, 0, 6146 },
+	{ 0, 80, 0, 6149 },
+	{ 0, 80, 0, 6152 },
+	{ 0, 80, 0, 6155 },
+	{ 0, 80, 0, 6158 },
+	{ 0, 80, 0, 6161 },
+	{ 0, 80, 0, 6164 },
+	{ 0, 80, 0, 6167 },
+	{ 0, 80, 0, 6171 },
+	{ 0, 80, 0, 6176 },
+	{ 0, 80, 0, 6179 },
+	{ 0, 80, 0, 6182 },
+	{ 0, 80, 0, 6185 },
+	{ 0, 80, 0, 6188 },
+	{ 0, 80, 0, 6191 },
+	{ 0, 80, 0, 6194 },
+	{ 0, 80, 0, 6197 },
+	{ 0, 80, 0, 6201 },
+	{ 0, 80, 0, 6205 },
+	{ 0, 80, 0, 6209 },
+	{ 0, 80, 0, 6213 },
+	{ 0, 80, 0, 6216 },
+	{ 0, 80, 0, 6219 },
+	{ 0, 80, 0, 6222 },
+	{ 0, 80, 0, 6225 },
+	{ 0, 80, 0, 6228 },
+	{ 0, 80, 0, 6231 },
+	{ 0, 80, 0, 6234 },
+	{ 0, 80, 0, 6237 },
+	{ 0, 80, 0, 6240 },
+	{ 0, 80, 0, 6243 },
+	{ 0, 80, 0, 6247 },
+	{ 0, 80, 0, 6251 },
+	{ 0, 80, 0, 6254 },
+	{ 0, 80, 0, 6258 },
+	{ 0, 80, 0, 6262 },
+	{ 0, 80, 0, 6266 },
+	{ 0, 80, 0, 6269 },
+	{ 0, 80, 0, 6273 },
+	{ 0, 80, 0, 6277 },
+	{ 0, 80, 0, 6282 },
+	{ 0, 80, 0, 6285 },
+	{ 0, 80, 0, 6289 },
+	{ 0, 80, 0, 6293 },
+	{ 0, 80, 0, 6297 },
+	{ 0, 80, 0, 6301 },
+	{ 0, 80, 0, 6307 },
+	{ 0, 80, 0, 6314 },
+	{ 0, 80, 0, 6317 },
+	{ 0, 80, 0, 6320 },
+	{ 0, 80, 0, 6323 },
+	{ 0, 80, 0, 6326 },
+	{ 0, 80, 0, 6329 },
+	{ 0, 80, 0, 6332 },
+	{ 0, 80, 0, 6335 },
+	{ 0, 80, 0, 6338 },
+	{ 0, 80, 0, 6341 },
+	{ 0, 80, 0, 6344 },
+	{ 0, 80, 0, 6347 },
+	{ 0, 80, 0, 6350 },
+	{ 0, 80, 0, 6353 },
+	{ 0, 80, 0, 6356 },
+	{ 0, 80, 0, 6359 },
+	{ 0, 80, 0, 6362 },
+	{ 0, 80, 0, 6365 },
+	{ 0, 80, 0, 6368 },
+	{ 0, 80, 0, 6373 },
+	{ 0, 80, 0, 6376 },
+	{ 0, 80, 0, 6379 },
+	{ 0, 80, 0, 6382 },
+	{ 0, 80, 0, 6387 },
+	{ 0, 80, 0, 6391 },
+	{ 0, 80, 0, 6394 },
+	{ 0, 80, 0, 6397 },
+	{ 0, 80, 0, 6400 },
+	{ 0, 80, 0, 6403 },
+	{ 0, 80, 0, 6406 },
+	{ 0, 80, 0, 6409 },
+	{ 0, 80, 0, 6412 },
+	{ 0, 80, 0, 6415 },
+	{ 0, 80, 0, 6418 },
+	{ 0, 80, 0, 6421 },
+	{ 0, 80, 0, 6425 },
+	{ 0, 80, 0, 6428 },
+	{ 0, 80, 0, 6431 },
+	{ 0, 80, 0, 6435 },
+	{ 0, 80, 0, 6439 },
+	{ 0, 80, 0, 6442 },
+	{ 0, 80, 0, 6447 },
+	{ 0, 80, 0, 6451 },
+	{ 0, 80, 0, 6454 },
+	{ 0, 80, 0, 6457 },
+	{ 0, 80, 0, 6460 },
+	{ 0, 80, 0, 6463 },
+	{ 0, 80, 0, 6467 },
+	{ 0, 80, 0, 6471 },
+	{ 0, 80, 0, 6474 },
+	{ 0, 80, 0, 6477 },
+	{ 0, 80, 0, 6480 },
+	{ 0, 80, 0, 6483 },
+	{ 0, 80, 0, 6486 },
+	{ 0, 80, 0, 6489 },
+	{ 0, 80, 0, 6492 },
+	{ 0, 80, 0, 6495 },
+	{ 0, 80, 0, 6498 },
+	{ 0, 80, 0, 6502 },
+	{ 0, 80, 0, 6506 },
+	{ 0, 80, 0, 6510 },
+	{ 0, 80, 0, 6514 },
+	{ 0, 80, 0, 6518 },
+	{ 0, 80, 0, 6522 },
+	{ 0, 80, 0, 6526 },
+	{ 0, 80, 0, 6530 },
+	{ 0, 80, 0, 6534 },
+	{ 0, 80, 0, 6538 },
+	{ 0, 80, 0, 6542 },
+	{ 0, 80, 0, 6546 },
+	{ 0, 80, 0, 6550 },
+	{ 0, 80, 0, 6554 },
+	{ 0, 80, 0, 6558 },
+	{ 0, 80, 0, 6562 },
+	{ 0, 80, 0, 6566 },
+	{ 0, 80, 0, 6570 },
+	{ 0, 80, 0, 6574 },
+	{ 0, 80, 0, 6578 },
+	{ 0, 80, 0, 6582 },
+	{ 0, 80, 0, 6586 },
+	{ 0, 80, 0, 6590 },
+	{ 0, 80, 0, 6592 },
+	{ 0, 80, 0, 6594 },
+	{ 0, 80, 0, 6596 },
+	{ 0, 80, 0, 6598 },
+	{ 0, 80, 0, 6600 },
+	{ 0, 80, 0, 6602 },
+	{ 0, 80, 0, 6604 },
+	{ 0, 80, 0, 6606 },
+	{ 0, 80, 0, 6608 },
+	{ 0, 68, 0, 0 },
+	{ 0, 85, 6610, 6610 },
+	{ 0, 85, 6612, 6612 },
+	{ 0, 85, 4394, 4394 },
+	{ 0, 85, 6614, 6614 },
+	{ 0, 85, 6616, 6616 },
+	{ 0, 85, 6618, 6618 },
+	{ 0, 85, 6620, 6620 },
+	{ 0, 85, 4502, 4502 },
+	{ 0, 85, 6622, 6622 },
+	{ 0, 85, 4410, 4410 },
+	{ 0, 85, 6624, 6624 },
+	{ 0, 85, 6626, 6626 },
+	{ 0, 85, 6628, 6628 },
+	{ 0, 85, 6630, 6630 },
+	{ 0, 85, 6632, 6632 },
+	{ 0, 85, 6634, 6634 },
+	{ 0, 85, 6636, 6636 },
+	{ 0, 85, 6638, 6638 },
+	{ 0, 85, 6640, 6640 },
+	{ 0, 85, 6642, 6642 },
+	{ 0, 85, 6644, 6644 },
+	{ 0, 85, 6646, 6646 },
+	{ 0, 85, 6648, 6648 },
+	{ 0, 85, 6650, 6650 },
+	{ 0, 85, 6652, 6652 },
+	{ 0, 85, 6654, 6654 },
+	{ 0, 85, 6656, 6656 },
+	{ 0, 85, 6658, 6658 },
+	{ 0, 85, 6660, 6660 },
+	{ 0, 85, 6662, 6662 },
+	{ 0, 85, 6664, 6664 },
+	{ 0, 85, 6666, 6666 },
+	{ 0, 85, 6668, 6668 },
+	{ 0, 85, 6670, 6670 },
+	{ 0, 85, 6672, 6672 },
+	{ 0, 85, 6674, 6674 },
+	{ 0, 85, 6676, 6676 },
+	{ 0, 85, 6678, 6678 },
+	{ 0, 85, 6680, 6680 },
+	{ 0, 85, 6682, 6682 },
+	{ 0, 85, 6684, 6684 },
+	{ 0, 85, 6686, 6686 },
+	{ 0, 85, 6688, 6688 },
+	{ 0, 85, 6690, 6690 },
+	{ 0, 85, 6692, 6692 },
+	{ 0, 85, 6694, 6694 },
+	{ 0, 85, 6696, 6696 },
+	{ 0, 85, 6698, 6698 },
+	{ 0, 85, 6700, 6700 },
+	{ 0, 85, 6702, 6702 },
+	{ 0, 85, 6704, 6704 },
+	{ 0, 85, 4326, 4326 },
+	{ 0, 85, 6706, 6706 },
+	{ 0, 85, 6708, 6708 },
+	{ 0, 85, 6710, 6710 },
+	{ 0, 85, 6712, 6712 },
+	{ 0, 85, 6714, 6714 },
+	{ 0, 85, 6716, 6716 },
+	{ 0, 85, 6718, 6718 },
+	{ 0, 85, 6720, 6720 },
+	{ 0, 85, 6722, 6722 },
+	{ 0, 85, 6724, 6724 },
+	{ 0, 85, 6726, 6726 },
+	{ 0, 85, 4472, 4472 },
+	{ 0, 85, 6728, 6728 },
+	{ 0, 85, 6730, 6730 },
+	{ 0, 85, 6732, 6732 },
+	{ 0, 85, 6734, 6734 },
+	{ 0, 85, 6736, 6736 },
+	{ 0, 85, 6738, 6738 },
+	{ 0, 85, 6740, 6740 },
+	{ 0, 85, 6742, 6742 },
+	{ 0, 85, 6744, 6744 },
+	{ 0, 85, 6746, 6746 },
+	{ 0, 85, 6748, 6748 },
+	{ 0, 85, 6750, 6750 },
+	{ 0, 85, 6752, 6752 },
+	{ 0, 85, 6754, 6754 },
+	{ 0, 85, 6756, 6756 },
+	{ 0, 85, 6758, 6758 },
+	{ 0, 85, 6760, 6760 },
+	{ 0, 85, 6762, 6762 },
+	{ 0, 85, 6764, 6764 },
+	{ 0, 85, 6766, 6766 },
+	{ 0, 85, 6768, 6768 },
+	{ 0, 85, 6770, 6770 },
+	{ 0, 85, 6772, 6772 },
+	{ 0, 85, 6774, 6774 },
+	{ 0, 85, 6776, 6776 },
+	{ 0, 85, 6778, 6778 },
+	{ 0, 85, 6780, 6780 },
+	{ 0, 85, 6782, 6782 },
+	{ 0, 85, 6784, 6784 },
+	{ 0, 85, 6786, 6786 },
+	{ 0, 85, 6788, 6788 },
+	{ 0, 85, 6790, 6790 },
+	{ 0, 85, 6792, 6792 },
+	{ 0, 85, 6794, 6794 },
+	{ 0, 85, 6796, 6796 },
+	{ 0, 85, 6798, 6798 },
+	{ 0, 85, 6800, 6800 },
+	{ 0, 85, 6802, 6802 },
+	{ 0, 85, 6804, 6804 },
+	{ 0, 85, 6806, 6806 },
+	{ 0, 85, 6808, 6808 },
+	{ 0, 85, 6810, 6810 },
+	{ 0, 85, 6812, 6812 },
+	{ 0, 85, 6814, 6814 },
+	{ 0, 85, 6816, 6816 },
+	{ 0, 85, 6818, 6818 },
+	{ 0, 85, 6820, 6820 },
+	{ 0, 85, 4398, 4398 },
+	{ 0, 85, 6822, 6822 },
+	{ 0, 85, 6824, 6824 },
+	{ 0, 85, 6826, 6826 },
+	{ 0, 85, 6828, 6828 },
+	{ 0, 85, 6830, 6830 },
+	{ 0, 85, 6832, 6832 },
+	{ 0, 85, 6834, 6834 },
+	{ 0, 85, 6836, 6836 },
+	{ 0, 85, 6838, 6838 },
+	{ 0, 85, 6840, 6840 },
+	{ 0, 85, 6842, 6842 },
+	{ 0, 85, 6844, 6844 },
+	{ 0, 85, 6846, 6846 },
+	{ 0, 85, 6848, 6848 },
+	{ 0, 85, 6850, 6850 },
+	{ 0, 85, 4152, 4152 },
+	{ 0, 85, 6852, 6852 },
+	{ 0, 85, 6854, 6854 },
+	{ 0, 85, 6856, 6856 },
+	{ 0, 85, 6858, 6858 },
+	{ 0, 85, 6860, 6860 },
+	{ 0, 85, 6862, 6862 },
+	{ 0, 85, 6864, 6864 },
+	{ 0, 85, 6866, 6866 },
+	{ 0, 85, 4114, 4114 },
+	{ 0, 85, 6868, 6868 },
+	{ 0, 85, 6870, 6870 },
+	{ 0, 85, 6872, 6872 },
+	{ 0, 85, 6874, 6874 },
+	{ 0, 85, 6876, 6876 },
+	{ 0, 85, 6878, 6878 },
+	{ 0, 85, 6880, 6880 },
+	{ 0, 85, 6882, 6882 },
+	{ 0, 85, 6884, 6884 },
+	{ 0, 85, 6886, 6886 },
+	{ 0, 85, 6888, 6888 },
+	{ 0, 85, 6890, 6890 },
+	{ 0, 85, 6892, 6892 },
+	{ 0, 85, 6894, 6894 },
+	{ 0, 85, 6896, 6896 },
+	{ 0, 85, 6898, 6898 },
+	{ 0, 85, 6900, 6900 },
+	{ 0, 85, 6902, 6902 },
+	{ 0, 85, 6904, 6904 },
+	{ 0, 85, 6906, 6906 },
+	{ 0, 85, 6908, 6908 },
+	{ 0, 85, 6910, 6910 },
+	{ 0, 85, 6912, 6912 },
+	{ 0, 85, 6914, 6914 },
+	{ 0, 85, 6916, 6916 },
+	{ 0, 85, 6918, 6918 },
+	{ 0, 85, 6920, 6920 },
+	{ 0, 85, 6922, 6922 },
+	{ 0, 85, 6924, 6924 },
+	{ 0, 85, 6926, 6926 },
+	{ 0, 85, 6928, 6928 },
+	{ 0, 85, 6930, 6930 },
+	{ 0, 85, 6932, 6932 },
+	{ 0, 85, 6934, 6934 },
+	{ 0, 85, 6936, 6936 },
+	{ 0, 85, 6938, 6938 },
+	{ 0, 85, 6940, 6940 },
+	{ 0, 85, 6942, 6942 },
+	{ 0, 85, 6944, 6944 },
+	{ 0, 85, 6946, 6946 },
+	{ 0, 85, 6948, 6948 },
+	{ 0, 85, 6950, 6950 },
+	{ 0, 85, 6952, 6952 },
+	{ 0, 85, 6954, 6954 },
+	{ 0, 85, 6956, 6956 },
+	{ 0, 85, 6958, 6958 },
+	{ 0, 85, 6960, 6960 },
+	{ 0, 85, 6962, 6962 },
+	{ 0, 85, 6964, 6964 },
+	{ 0, 85, 6966, 6966 },
+	{ 0, 85, 6968, 6968 },
+	{ 0, 85, 6970, 6970 },
+	{ 0, 85, 6972, 6972 },
+	{ 0, 85, 6974, 6974 },
+	{ 0, 85, 4500, 4500 },
+	{ 0, 85, 6976, 6976 },
+	{ 0, 85, 6978, 6978 },
+	{ 0, 85, 6980, 6980 },
+	{ 0, 85, 6982, 6982 },
+	{ 0, 85, 6984, 6984 },
+	{ 0, 85, 6986, 6986 },
+	{ 0, 85, 6988, 6988 },
+	{ 0, 85, 6990, 6990 },
+	{ 0, 85, 6992, 6992 },
+	{ 0, 85, 6994, 6994 },
+	{ 0, 85, 6996, 6996 },
+	{ 0, 85, 6998, 6998 },
+	{ 0, 85, 5309, 5309 },
+	{ 0, 85, 7000, 7000 },
+	{ 0, 85, 7002, 7002 },
+	{ 0, 85, 7004, 7004 },
+	{ 0, 85, 7006, 7006 },
+	{ 0, 85, 7008, 7008 },
+	{ 0, 85, 7010, 7010 },
+	{ 0, 85, 7012, 7012 },
+	{ 0, 85, 7014, 7014 },
+	{ 0, 85, 7016, 7016 },
+	{ 0, 85, 7018, 7018 },
+	{ 0, 85, 7020, 7020 },
+	{ 0, 85, 7022, 7022 },
+	{ 0, 85, 7024, 7024 },
+	{ 0, 85, 7026, 7026 },
+	{ 0, 85, 7028, 7028 },
+	{ 0, 85, 7030, 7030 },
+	{ 0, 85, 7032, 7032 },
+	{ 0, 85, 7034, 7034 },
+	{ 0, 85, 7036, 7036 },
+	{ 0, 85, 7038, 7038 },
+	{ 0, 85, 7040, 7040 },
+	{ 0, 85, 7042, 7042 },
+	{ 0, 85, 4408, 4408 },
+	{ 0, 85, 7044, 7044 },
+	{ 0, 85, 7046, 7046 },
+	{ 0, 85, 7048, 7048 },
+	{ 0, 85, 7050, 7050 },
+	{ 0, 85, 7052, 7052 },
+	{ 0, 85, 7054, 7054 },
+	{ 0, 85, 7056, 7056 },
+	{ 0, 85, 7058, 7058 },
+	{ 0, 85, 7060, 7060 },
+	{ 0, 85, 7062, 7062 },
+	{ 0, 85, 7064, 7064 },
+	{ 0, 85, 7066, 7066 },
+	{ 0, 85, 7068, 7068 },
+	{ 0, 85, 4310, 4310 },
+	{ 0, 85, 7070, 7070 },
+	{ 0, 85, 7072, 7072 },
+	{ 0, 85, 7074, 7074 },
+	{ 0, 85, 7076, 7076 },
+	{ 0, 85, 7078, 7078 },
+	{ 0, 85, 7080, 7080 },
+	{ 0, 85, 7082, 7082 },
+	{ 0, 85, 7084, 7084 },
+	{ 0, 85, 7086, 7086 },
+	{ 0, 85, 7088, 7088 },
+	{ 0, 85, 7090, 7090 },
+	{ 0, 85, 7092, 7092 },
+	{ 0, 85, 7094, 7094 },
+	{ 0, 85, 7096, 7096 },
+	{ 0, 85, 7098, 7098 },
+	{ 0, 85, 7100, 7100 },
+	{ 0, 85, 4364, 4364 },
+	{ 0, 85, 7102, 7102 },
+	{ 0, 85, 4370, 4370 },
+	{ 0, 85, 7104, 7104 },
+	{ 0, 85, 7106, 7106 },
+	{ 0, 85, 7108, 7108 },
+	{ 0, 85, 7110, 7110 },
+	{ 0, 85, 7112, 7112 },
+	{ 0, 85, 7114, 7114 },
+	{ 0, 85, 7116, 7116 },
+	{ 0, 85, 7118, 7118 },
+	{ 0, 85, 7120, 7120 },
+	{ 0, 85, 7122, 7122 },
+	{ 0, 85, 7124, 7124 },
+	{ 0, 85, 7126, 7126 },
+	{ 0, 85, 7128, 7128 },
+	{ 0, 85, 7130, 7130 },
+	{ 0, 85, 4324, 4324 },
+	{ 0, 85, 7132, 7132 },
+	{ 0, 85, 7134, 7134 },
+	{ 0, 85, 7136, 7136 },
+	{ 0, 85, 7138, 7138 },
+	{ 0, 85, 7140, 7140 },
+	{ 0, 85, 7142, 7142 },
+	{ 0, 85, 7144, 7144 },
+	{ 0, 85, 7146, 7146 },
+	{ 0, 85, 7148, 7148 },
+	{ 0, 85, 7150, 7150 },
+	{ 0, 85, 7152, 7152 },
+	{ 0, 85, 7154, 7154 },
+	{ 0, 85, 7156, 7156 },
+	{ 0, 85, 7158, 7158 },
+	{ 0, 85, 7160, 7160 },
+	{ 0, 85, 7162, 7162 },
+	{ 0, 85, 7164, 7164 },
+	{ 0, 85, 7166, 7166 },
+	{ 0, 85, 7168, 7168 },
+	{ 0, 85, 7170, 7170 },
+	{ 0, 85, 7172, 7172 },
+	{ 0, 85, 7174, 7174 },
+	{ 0, 85, 4166, 4166 },
+	{ 0, 85, 7176, 7176 },
+	{ 0, 85, 7178, 7178 },
+	{ 0, 85, 7180, 7180 },
+	{ 0, 85, 7182, 7182 },
+	{ 0, 85, 7184, 7184 },
+	{ 0, 85, 7186, 7186 },
+	{ 0, 85, 7188, 7188 },
+	{ 0, 85, 7190, 7190 },
+	{ 0, 85, 7192, 7192 },
+	{ 0, 85, 7194, 7194 },
+	{ 0, 85, 7196, 7196 },
+	{ 0, 85, 7198, 7198 },
+	{ 0, 85, 7200, 7200 },
+	{ 0, 85, 7202, 7202 },
+	{ 0, 85, 7204, 7204 },
+	{ 0, 85, 5319, 5319 },
+	{ 0, 85, 7206, 7206 },
+	{ 0, 85, 7208, 7208 },
+	{ 0, 85, 7210, 7210 },
+	{ 0, 85, 7212, 7212 },
+	{ 0, 85, 5327, 5327 },
+	{ 0, 85, 7214, 7214 },
+	{ 0, 85, 7216, 7216 },
+	{ 0, 85, 7218, 7218 },
+	{ 0, 85, 7220, 7220 },
+	{ 0, 85, 7222, 7222 },
+	{ 0, 85, 7224, 7224 },
+	{ 0, 85, 7226, 7226 },
+	{ 0, 85, 7228, 7228 },
+	{ 0, 85, 7230, 7230 },
+	{ 0, 85, 7232, 7232 },
+	{ 0, 85, 7234, 7234 },
+	{ 0, 85, 7236, 7236 },
+	{ 0, 85, 7238, 7238 },
+	{ 0, 85, 7240, 7240 },
+	{ 0, 85, 7242, 7242 },
+	{ 0, 85, 7244, 7244 },
+	{ 0, 85, 7246, 7246 },
+	{ 0, 85, 7248, 7248 },
+	{ 0, 85, 7250, 7250 },
+	{ 0, 85, 7252, 7252 },
+	{ 0, 85, 7254, 7254 },
+	{ 0, 85, 7256, 7256 },
+	{ 0, 85, 7258, 7258 },
+	{ 0, 85, 7260, 7260 },
+	{ 0, 85, 7262, 7262 },
+	{ 0, 85, 7264, 7264 },
+	{ 0, 85, 7266, 7266 },
+	{ 0, 85, 7268, 7268 },
+	{ 0, 85, 7270, 7270 },
+	{ 0, 85, 7272, 7272 },
+	{ 0, 85, 7274, 7274 },
+	{ 0, 85, 7276, 7276 },
+	{ 0, 85, 7278, 7278 },
+	{ 0, 85, 7280, 7280 },
+	{ 0, 85, 7282, 7282 },
+	{ 0, 85, 7284, 7284 },
+	{ 0, 85, 7286, 7286 },
+	{ 0, 85, 7288, 7288 },
+	{ 0, 85, 7290, 7290 },
+	{ 0, 85, 7292, 7292 },
+	{ 0, 85, 7294, 7294 },
+	{ 0, 85, 7296, 7296 },
+	{ 0, 85, 7298, 7298 },
+	{ 0, 85, 7300, 7300 },
+	{ 0, 85, 7302, 7302 },
+	{ 0, 85, 7304, 7304 },
+	{ 0, 85, 7306, 7306 },
+	{ 0, 85, 7308, 7308 },
+	{ 0, 85, 7310, 7310 },
+	{ 0, 85, 7312, 7312 },
+	{ 0, 85, 7314, 7314 },
+	{ 0, 85, 7316, 7316 },
+	{ 0, 85, 7318, 7318 },
+	{ 0, 85, 7320, 7320 },
+	{ 0, 85, 7322, 7322 },
+	{ 0, 85, 7324, 7324 },
+	{ 0, 85, 4232, 4232 },
+	{ 0, 85, 7326, 7326 },
+	{ 0, 85, 7328, 7328 },
+	{ 0, 85, 7330, 7330 },
+	{ 0, 85, 7332, 7332 },
+	{ 0, 85, 7334, 7334 },
+	{ 0, 85, 7336, 7336 },
+	{ 0, 85, 7338, 7338 },
+	{ 0, 85, 7340, 7340 },
+	{ 0, 85, 7342, 7342 },
+	{ 0, 85, 7344, 7344 },
+	{ 0, 85, 7346, 7346 },
+	{ 0, 85, 7348, 7348 },
+	{ 0, 85, 7350, 7350 },
+	{ 0, 85, 7352, 7352 },
+	{ 0, 85, 7354, 7354 },
+	{ 0, 85, 7356, 7356 },
+	{ 0, 85, 7358, 7358 },
+	{ 0, 85, 7360, 7360 },
+	{ 0, 85, 7362, 7362 },
+	{ 0, 85, 7364, 7364 },
+	{ 0, 85, 7366, 7366 },
+	{ 0, 85, 7368, 7368 },
+	{ 0, 85, 7370, 7370 },
+	{ 0, 85, 7372, 7372 },
+	{ 0, 85, 7374, 7374 },
+	{ 0, 85, 7376, 7376 },
+	{ 0, 85, 7378, 7378 },
+	{ 0, 85, 7380, 7380 },
+	{ 0, 85, 7382, 7382 },
+	{ 0, 85, 7384, 7384 },
+	{ 0, 85, 7386, 7386 },
+	{ 0, 85, 7388, 7388 },
+	{ 0, 85, 7390, 7390 },
+	{ 0, 85, 7392, 7392 },
+	{ 0, 85, 7394, 7394 },
+	{ 0, 85, 7396, 7396 },
+	{ 0, 85, 7398, 7398 },
+	{ 0, 85, 7400, 7400 },
+	{ 0, 85, 7402, 7402 },
+	{ 0, 85, 7404, 7404 },
+	{ 0, 85, 7406, 7406 },
+	{ 0, 85, 7408, 7408 },
+	{ 0, 85, 7410, 7410 },
+	{ 0, 85, 7412, 7412 },
+	{ 0, 85, 7414, 7414 },
+	{ 0, 85, 7416, 7416 },
+	{ 0, 85, 7418, 7418 },
+	{ 0, 85, 7420, 7420 },
+	{ 0, 80, 0, 7422 },
+	{ 0, 80, 0, 7425 },
+	{ 0, 80, 0, 7428 },
+	{ 0, 80, 0, 7431 },
+	{ 0, 80, 0, 7435 },
+	{ 0, 80, 0, 7439 },
+	{ 0, 80, 0, 7442 },
+	{ 0, 80, 0, 7445 },
+	{ 0, 80, 0, 7448 },
+	{ 0, 80, 0, 7451 },
+	{ 0, 80, 0, 7454 },
+	{ 0, 85, 7457, 7457 },
+	{ 26, 0, 0, 0 },
+	{ 0, 85, 7460, 7460 },
+	{ 0, 80, 0, 7463 },
+	{ 0, 80, 0, 7465 },
+	{ 0, 80, 0, 7467 },
+	{ 0, 80, 0, 7469 },
+	{ 0, 80, 0, 7471 },
+	{ 0, 80, 0, 7473 },
+	{ 0, 80, 0, 7475 },
+	{ 0, 85, 7477, 7477 },
+	{ 0, 85, 7480, 7480 },
+	{ 0, 85, 7483, 7483 },
+	{ 0, 85, 7487, 7487 },
+	{ 0, 85, 7491, 7491 },
+	{ 0, 85, 7494, 7494 },
+	{ 0, 85, 7497, 7497 },
+	{ 0, 85, 7500, 7500 },
+	{ 0, 85, 7503, 7503 },
+	{ 0, 85, 7506, 7506 },
+	{ 0, 85, 7509, 7509 },
+	{ 0, 85, 7512, 7512 },
+	{ 0, 85, 7515, 7515 },
+	{ 0, 85, 7518, 7518 },
+	{ 0, 85, 7521, 7521 },
+	{ 0, 85, 7524, 7524 },
+	{ 0, 85, 7527, 7527 },
+	{ 0, 85, 7530, 7530 },
+	{ 0, 85, 7533, 7533 },
+	{ 0, 85, 7536, 7536 },
+	{ 0, 85, 7539, 7539 },
+	{ 0, 85, 7542, 7542 },
+	{ 0, 85, 7545, 7545 },
+	{ 0, 85, 7548, 7548 },
+	{ 0, 85, 7551, 7551 },
+	{ 0, 85, 7554, 7554 },
+	{ 0, 85, 7557, 7557 },
+	{ 0, 85, 7560, 7560 },
+	{ 0, 85, 7563, 7563 },
+	{ 0, 85, 7566, 7566 },
+	{ 0, 85, 7569, 7569 },
+	{ 0, 85, 7572, 7572 },
+	{ 0, 80, 0, 7575 },
+	{ 0, 80, 0, 7578 },
+	{ 0, 80, 0, 7580 },
+	{ 0, 80, 0, 7582 },
+	{ 0, 80, 0, 7584 },
+	{ 0, 80, 0, 7586 },
+	{ 0, 80, 0, 7588 },
+	{ 0, 80, 0, 7590 },
+	{ 0, 80, 0, 7592 },
+	{ 0, 80, 0, 7594 },
+	{ 0, 80, 0, 7596 },
+	{ 0, 80, 0, 7598 },
+	{ 0, 80, 0, 7600 },
+	{ 0, 80, 0, 7602 },
+	{ 0, 80, 0, 7604 },
+	{ 0, 80, 0, 7606 },
+	{ 0, 80, 0, 7608 },
+	{ 0, 80, 0, 7610 },
+	{ 0, 80, 0, 7612 },
+	{ 0, 80, 0, 7614 },
+	{ 0, 80, 0, 7616 },
+	{ 0, 80, 0, 7618 },
+	{ 0, 80, 0, 7620 },
+	{ 0, 80, 0, 7622 },
+	{ 0, 80, 0, 7624 },
+	{ 0, 80, 0, 7626 },
+	{ 0, 80, 0, 1218 },
+	{ 0, 80, 0, 7628 },
+	{ 0, 80, 0, 7630 },
+	{ 0, 80, 0, 7632 },
+	{ 0, 80, 0, 1224 },
+	{ 0, 80, 0, 7634 },
+	{ 0, 80, 0, 7636 },
+	{ 0, 80, 0, 7638 },
+	{ 0, 80, 0, 7640 },
+	{ 0, 80, 0, 7642 },
+	{ 0, 80, 0, 7644 },
+	{ 0, 80, 0, 7646 },
+	{ 0, 80, 0, 7648 },
+	{ 0, 80, 0, 7650 },
+	{ 0, 80, 0, 7652 },
+	{ 0, 80, 0, 7656 },
+	{ 0, 80, 0, 7660 },
+	{ 0, 80, 0, 7664 },
+	{ 0, 80, 0, 7668 },
+	{ 0, 80, 0, 7672 },
+	{ 0, 80, 0, 7676 },
+	{ 0, 80, 0, 7680 },
+	{ 0, 80, 0, 7684 },
+	{ 0, 80, 0, 7686 },
+	{ 0, 80, 0, 7690 },
+	{ 0, 80, 0, 7694 },
+	{ 0, 80, 0, 7698 },
+	{ 0, 80, 0, 7702 },
+	{ 0, 80, 0, 7705 },
+	{ 0, 80, 0, 7708 },
+	{ 0, 80, 0, 7711 },
+	{ 0, 80, 0, 7714 },
+	{ 0, 80, 0, 7717 },
+	{ 0, 80, 0, 7720 },
+	{ 0, 80, 0, 7723 },
+	{ 0, 80, 0, 7726 },
+	{ 0, 80, 0, 7729 },
+	{ 0, 80, 0, 7732 },
+	{ 0, 80, 0, 7735 },
+	{ 0, 80, 0, 7738 },
+	{ 0, 80, 0, 7741 },
+	{ 0, 80, 0, 7744 },
+	{ 0, 80, 0, 7747 },
+	{ 0, 80, 0, 7750 },
+	{ 0, 80, 0, 7753 },
+	{ 0, 80, 0, 7756 },
+	{ 0, 80, 0, 7759 },
+	{ 0, 80, 0, 7762 },
+	{ 0, 80, 0, 7765 },
+	{ 0, 80, 0, 7768 },
+	{ 0, 80, 0, 7771 },
+	{ 0, 80, 0, 7774 },
+	{ 0, 80, 0, 7777 },
+	{ 0, 80, 0, 7780 },
+	{ 0, 80, 0, 7783 },
+	{ 0, 80, 0, 7786 },
+	{ 0, 80, 0, 7789 },
+	{ 0, 80, 0, 7792 },
+	{ 0, 80, 0, 7795 },
+	{ 0, 80, 0, 7798 },
+	{ 0, 80, 0, 7801 },
+	{ 0, 80, 0, 7804 },
+	{ 0, 80, 0, 7807 },
+	{ 0, 80, 0, 7810 },
+	{ 0, 80, 0, 7813 },
+	{ 0, 80, 0, 7816 },
+	{ 0, 80, 0, 7819 },
+	{ 0, 80, 0, 7822 },
+	{ 0, 80, 0, 7825 },
+	{ 0, 80, 0, 7828 },
+	{ 0, 80, 0, 7831 },
+	{ 0, 80, 0, 7834 },
+	{ 0, 80, 0, 7837 },
+	{ 0, 80, 0, 7840 },
+	{ 0, 80, 0, 7843 },
+	{ 0, 80, 0, 7846 },
+	{ 0, 80, 0, 7849 },
+	{ 0, 80, 0, 7852 },
+	{ 0, 80, 0, 7855 },
+	{ 0, 80, 0, 7858 },
+	{ 0, 80, 0, 7861 },
+	{ 0, 80, 0, 7864 },
+	{ 0, 80, 0, 7867 },
+	{ 0, 80, 0, 7870 },
+	{ 0, 80, 0, 7873 },
+	{ 0, 80, 0, 7876 },
+	{ 0, 80, 0, 7879 },
+	{ 0, 80, 0, 7882 },
+	{ 0, 80, 0, 7885 },
+	{ 0, 80, 0, 7888 },
+	{ 0, 80, 0, 7891 },
+	{ 0, 80, 0, 7894 },
+	{ 0, 80, 0, 7897 },
+	{ 0, 80, 0, 7900 },
+	{ 0, 80, 0, 7903 },
+	{ 0, 80, 0, 7906 },
+	{ 0, 80, 0, 7909 },
+	{ 0, 80, 0, 7912 },
+	{ 0, 80, 0, 7915 },
+	{ 0, 80, 0, 7918 },
+	{ 0, 80, 0, 7921 },
+	{ 0, 80, 0, 7924 },
+	{ 0, 80, 0, 7927 },
+	{ 0, 80, 0, 7930 },
+	{ 0, 80, 0, 7933 },
+	{ 0, 80, 0, 7936 },
+	{ 0, 80, 0, 7939 },
+	{ 0, 80, 0, 7942 },
+	{ 0, 80, 0, 7945 },
+	{ 0, 80, 0, 7948 },
+	{ 0, 80, 0, 7951 },
+	{ 0, 80, 0, 7954 },
+	{ 0, 80, 0, 7957 },
+	{ 0, 80, 0, 7960 },
+	{ 0, 80, 0, 7963 },
+	{ 0, 80, 0, 7966 },
+	{ 0, 80, 0, 7969 },
+	{ 0, 80, 0, 7973 },
+	{ 0, 80, 0, 7977 },
+	{ 0, 80, 0, 7981 },
+	{ 0, 80, 0, 7985 },
+	{ 0, 80, 0, 7989 },
+	{ 0, 80, 0, 7993 },
+	{ 0, 80, 0, 7997 },
+	{ 0, 80, 0, 8001 },
+	{ 0, 80, 0, 8005 },
+	{ 0, 80, 0, 8008 },
+	{ 0, 80, 0, 8011 },
+	{ 0, 80, 0, 8014 },
+	{ 0, 80, 0, 8017 },
+	{ 0, 80, 0, 8020 },
+	{ 0, 80, 0, 8023 },
+	{ 0, 80, 0, 8026 },
+	{ 0, 80, 0, 8029 },
+	{ 0, 80, 0, 8032 },
+	{ 0, 80, 0, 8035 },
+	{ 0, 80, 0, 8038 },
+	{ 0, 80, 0, 8041 },
+	{ 0, 80, 0, 8044 },
+	{ 0, 80, 0, 8047 },
+	{ 0, 80, 0, 8050 },
+	{ 0, 80, 0, 8053 },
+	{ 0, 80, 0, 8057 },
+	{ 0, 80, 0, 8061 },
+	{ 0, 80, 0, 8064 },
+	{ 0, 80, 0, 8067 },
+	{ 0, 80, 0, 8070 },
+	{ 0, 80, 0, 8073 },
+	{ 0, 80, 0, 8076 },
+	{ 0, 80, 0, 8079 },
+	{ 0, 80, 0, 8082 },
+	{ 0, 80, 0, 8085 },
+	{ 0, 80, 0, 8088 },
+	{ 0, 80, 0, 8091 },
+	{ 0, 80, 0, 8094 },
+	{ 0, 80, 0, 8098 },
+	{ 0, 80, 0, 8102 },
+	{ 0, 80, 0, 8106 },
+	{ 0, 80, 0, 8109 },
+	{ 0, 80, 0, 8112 },
+	{ 0, 80, 0, 8115 },
+	{ 0, 80, 0, 8118 },
+	{ 0, 80, 0, 8121 },
+	{ 0, 80, 0, 8124 },
+	{ 0, 80, 0, 8127 },
+	{ 0, 80, 0, 8130 },
+	{ 0, 80, 0, 8133 },
+	{ 0, 80, 0, 8136 },
+	{ 0, 80, 0, 8139 },
+	{ 0, 80, 0, 8142 },
+	{ 0, 80, 0, 8145 },
+	{ 0, 80, 0, 8148 },
+	{ 0, 80, 0, 8151 },
+	{ 0, 80, 0, 8154 },
+	{ 0, 80, 0, 8157 },
+	{ 0, 80, 0, 8160 },
+	{ 0, 80, 0, 8163 },
+	{ 0, 80, 0, 8166 },
+	{ 0, 80, 0, 8169 },
+	{ 0, 80, 0, 8172 },
+	{ 0, 80, 0, 8175 },
+	{ 0, 80, 0, 8178 },
+	{ 0, 80, 0, 8181 },
+	{ 0, 80, 0, 8184 },
+	{ 0, 80, 0, 8187 },
+	{ 0, 80, 0, 8190 },
+	{ 0, 80, 0, 8194 },
+	{ 0, 80, 0, 8198 },
+	{ 0, 80, 0, 8202 },
+	{ 0, 80, 0, 8206 },
+	{ 0, 80, 0, 8210 },
+	{ 0, 80, 0, 8214 },
+	{ 0, 80, 0, 8218 },
+	{ 0, 80, 0, 8222 },
+	{ 0, 80, 0, 8226 },
+	{ 0, 80, 0, 8230 },
+	{ 0, 80, 0, 8234 },
+	{ 0, 80, 0, 8238 },
+	{ 0, 80, 0, 8242 },
+	{ 0, 80, 0, 8246 },
+	{ 0, 80, 0, 8250 },
+	{ 0, 80, 0, 8254 },
+	{ 0, 80, 0, 8258 },
+	{ 0, 80, 0, 8262 },
+	{ 0, 80, 0, 8266 },
+	{ 0, 80, 0, 8270 },
+	{ 0, 80, 0, 8274 },
+	{ 0, 80, 0, 8278 },
+	{ 0, 80, 0, 8282 },
+	{ 0, 80, 0, 8286 },
+	{ 0, 80, 0, 8290 },
+	{ 0, 80, 0, 8294 },
+	{ 0, 80, 0, 8298 },
+	{ 0, 80, 0, 8302 },
+	{ 0, 80, 0, 8306 },
+	{ 0, 80, 0, 8310 },
+	{ 0, 80, 0, 8314 },
+	{ 0, 80, 0, 8318 },
+	{ 0, 80, 0, 8322 },
+	{ 0, 80, 0, 8326 },
+	{ 0, 80, 0, 8330 },
+	{ 0, 80, 0, 8334 },
+	{ 0, 80, 0, 8338 },
+	{ 0, 80, 0, 8342 },
+	{ 0, 80, 0, 8346 },
+	{ 0, 80, 0, 8350 },
+	{ 0, 80, 0, 8354 },
+	{ 0, 80, 0, 8358 },
+	{ 0, 80, 0, 8362 },
+	{ 0, 80, 0, 8366 },
+	{ 0, 80, 0, 8370 },
+	{ 0, 80, 0, 8374 },
+	{ 0, 80, 0, 8378 },
+	{ 0, 80, 0, 8382 },
+	{ 0, 80, 0, 8386 },
+	{ 0, 80, 0, 8390 },
+	{ 0, 80, 0, 8394 },
+	{ 0, 80, 0, 8398 },
+	{ 0, 80, 0, 8402 },
+	{ 0, 80, 0, 8406 },
+	{ 0, 80, 0, 8410 },
+	{ 0, 80, 0, 8414 },
+	{ 0, 80, 0, 8418 },
+	{ 0, 80, 0, 8422 },
+	{ 0, 80, 0, 8426 },
+	{ 0, 80, 0, 8430 },
+	{ 0, 80, 0, 8434 },
+	{ 0, 80, 0, 8438 },
+	{ 0, 80, 0, 8442 },
+	{ 0, 80, 0, 8446 },
+	{ 0, 80, 0, 8450 },
+	{ 0, 80, 0, 8454 },
+	{ 0, 80, 0, 8458 },
+	{ 0, 80, 0, 8462 },
+	{ 0, 80, 0, 8466 },
+	{ 0, 80, 0, 8470 },
+	{ 0, 80, 0, 8474 },
+	{ 0, 80, 0, 8478 },
+	{ 0, 80, 0, 8482 },
+	{ 0, 80, 0, 8486 },
+	{ 0, 80, 0, 8490 },
+	{ 0, 80, 0, 8494 },
+	{ 0, 80, 0, 8498 },
+	{ 0, 80, 0, 8502 },
+	{ 0, 80, 0, 8506 },
+	{ 0, 80, 0, 8510 },
+	{ 0, 80, 0, 8514 },
+	{ 0, 80, 0, 8518 },
+	{ 0, 80, 0, 8522 },
+	{ 0, 80, 0, 8526 },
+	{ 0, 80, 0, 8530 },
+	{ 0, 80, 0, 8534 },
+	{ 0, 80, 0, 8538 },
+	{ 0, 80, 0, 8542 },
+	{ 0, 80, 0, 8546 },
+	{ 0, 80, 0, 8550 },
+	{ 0, 80, 0, 8554 },
+	{ 0, 80, 0, 8558 },
+	{ 0, 80, 0, 8562 },
+	{ 0, 80, 0, 8566 },
+	{ 0, 80, 0, 8570 },
+	{ 0, 80, 0, 8574 },
+	{ 0, 80, 0, 8579 },
+	{ 0, 80, 0, 8584 },
+	{ 0, 80, 0, 8589 },
+	{ 0, 80, 0, 8594 },
+	{ 0, 80, 0, 8599 },
+	{ 0, 80, 0, 8604 },
+	{ 0, 80, 0, 8609 },
+	{ 0, 80, 0, 8613 },
+	{ 0, 80, 0, 8632 },
+	{ 0, 80, 0, 8641 },
+	{ 0, 80, 0, 8646 },
+	{ 0, 80, 0, 8648 },
+	{ 0, 80, 0, 8650 },
+	{ 0, 80, 0, 8652 },
+	{ 0, 80, 0, 931 },
+	{ 0, 80, 0, 8654 },
+	{ 0, 80, 0, 8656 },
+	{ 0, 80, 0, 8658 },
+	{ 0, 80, 0, 8660 },
+	{ 0, 80, 0, 8662 },
+	{ 0, 80, 0, 8664 },
+	{ 0, 80, 0, 8666 },
+	{ 0, 80, 0, 8668 },
+	{ 0, 80, 0, 8670 },
+	{ 0, 80, 0, 8672 },
+	{ 0, 80, 0, 8674 },
+	{ 0, 80, 0, 8676 },
+	{ 0, 80, 0, 8678 },
+	{ 0, 80, 0, 8680 },
+	{ 0, 80, 0, 8682 },
+	{ 0, 80, 0, 3744 },
+	{ 0, 80, 0, 3746 },
+	{ 0, 80, 0, 8684 },
+	{ 0, 80, 0, 8686 },
+	{ 0, 80, 0, 8688 },
+	{ 0, 80, 0, 8690 },
+	{ 0, 80, 0, 8692 },
+	{ 0, 80, 0, 8694 },
+	{ 0, 80, 0, 8696 },
+	{ 0, 80, 0, 8698 },
+	{ 0, 80, 0, 8700 },
+	{ 0, 80, 0, 8702 },
+	{ 0, 80, 0, 8704 },
+	{ 0, 80, 0, 8706 },
+	{ 0, 80, 0, 8708 },
+	{ 0, 80, 0, 8710 },
+	{ 0, 80, 0, 8712 },
+	{ 0, 80, 0, 8714 },
+	{ 0, 80, 0, 8716 },
+	{ 0, 80, 0, 8719 },
+	{ 0, 80, 0, 8722 },
+	{ 0, 80, 0, 8725 },
+	{ 0, 80, 0, 8728 },
+	{ 0, 80, 0, 8731 },
+	{ 0, 80, 0, 8734 },
+	{ 0, 80, 0, 8737 },
+	{ 0, 80, 0, 8740 },
+	{ 0, 80, 0, 8743 },
+	{ 0, 80, 0, 8746 },
+	{ 0, 80, 0, 8749 },
+	{ 0, 80, 0, 8752 },
+	{ 0, 80, 0, 8755 },
+	{ 0, 80, 0, 8758 },
+	{ 0, 80, 0, 1191 },
+	{ 0, 80, 0, 1194 },
+	{ 0, 80, 0, 1197 },
+	{ 0, 80, 0, 1200 },
+	{ 0, 80, 0, 1203 },
+	{ 0, 80, 0, 8760 },
+	{ 0, 80, 0, 8762 },
+	{ 0, 80, 0, 8764 },
+	{ 0, 80, 0, 8766 },
+	{ 0, 80, 0, 8768 },
+	{ 0, 80, 0, 8770 },
+	{ 0, 80, 0, 8772 },
+	{ 0, 80, 0, 8774 },
+	{ 0, 80, 0, 8776 },
+	{ 0, 80, 0, 8778 },
+	{ 0, 80, 0, 8780 },
+	{ 0, 80, 0, 8782 },
+	{ 0, 80, 0, 8784 },
+	{ 0, 80, 0, 8786 },
+	{ 0, 80, 0, 8788 },
+	{ 0, 80, 0, 8790 },
+	{ 0, 80, 0, 8792 },
+	{ 0, 80, 0, 8794 },
+	{ 0, 80, 0, 8796 },
+	{ 0, 80, 0, 8798 },
+	{ 0, 80, 0, 8800 },
+	{ 0, 80, 0, 8802 },
+	{ 0, 80, 0, 8804 },
+	{ 0, 80, 0, 8806 },
+	{ 0, 80, 0, 8808 },
+	{ 0, 80, 0, 8810 },
+	{ 0, 80, 0, 8812 },
+	{ 0, 80, 0, 8814 },
+	{ 0, 80, 0, 8816 },
+	{ 0, 80, 0, 8818 },
+	{ 0, 80, 0, 8822 },
+	{ 0, 80, 0, 8826 },
+	{ 0, 80, 0, 8830 },
+	{ 0, 80, 0, 8833 },
+	{ 0, 80, 0, 8835 },
+	{ 0, 80, 0, 8837 },
+	{ 0, 80, 0, 8839 },
+	{ 0, 80, 0, 3280 },
+	{ 0, 80, 0, 8841 },
+	{ 0, 80, 0, 8843 },
+	{ 0, 80, 0, 8845 },
+	{ 0, 80, 0, 8847 },
+	{ 0, 80, 0, 8849 },
+	{ 0, 80, 0, 8851 },
+	{ 0, 80, 0, 8853 },
+	{ 0, 80, 0, 8855 },
+	{ 0, 80, 0, 8857 },
+	{ 0, 80, 0, 8859 },
+	{ 0, 80, 0, 8861 },
+	{ 0, 80, 0, 8863 },
+	{ 0, 80, 0, 8865 },
+	{ 0, 80, 0, 8867 },
+	{ 0, 80, 0, 8869 },
+	{ 0, 80, 0, 8871 },
+	{ 0, 80, 0, 8873 },
+	{ 0, 80, 0, 8875 },
+	{ 0, 80, 0, 8877 },
+	{ 0, 80, 0, 8879 },
+	{ 0, 80, 0, 8881 },
+	{ 0, 80, 0, 8883 },
+	{ 0, 80, 0, 8885 },
+	{ 0, 80, 0, 8887 },
+	{ 0, 80, 0, 8889 },
+	{ 0, 80, 0, 8891 },
+	{ 0, 80, 0, 8893 },
+	{ 0, 80, 0, 8895 },
+	{ 0, 80, 0, 8897 },
+	{ 0, 80, 0, 8899 },
+	{ 0, 80, 0, 8901 },
+	{ 0, 80, 0, 8903 },
+	{ 0, 80, 0, 8905 },
+	{ 0, 80, 0, 8907 },
+	{ 0, 80, 0, 8909 },
+	{ 0, 80, 0, 8911 },
+	{ 0, 80, 0, 8913 },
+	{ 0, 80, 0, 8915 },
+	{ 0, 80, 0, 8917 },
+	{ 0, 80, 0, 8919 },
+	{ 0, 80, 0, 8921 },
+	{ 0, 80, 0, 8923 },
+	{ 0, 80, 0, 8925 },
+	{ 0, 80, 0, 8927 },
+	{ 0, 80, 0, 8929 },
+	{ 0, 80, 0, 8931 },
+	{ 0, 80, 0, 8933 },
+	{ 0, 80, 0, 8935 },
+	{ 0, 80, 0, 8937 },
+	{ 0, 80, 0, 8939 },
+	{ 0, 80, 0, 8941 },
+	{ 0, 80, 0, 8943 },
+	{ 0, 80, 0, 8945 },
+	{ 0, 80, 0, 8947 },
+	{ 0, 80, 0, 8949 },
+	{ 0, 80, 0, 8951 },
+	{ 0, 80, 0, 8953 },
+	{ 0, 80, 0, 8955 },
+	{ 0, 80, 0, 8957 },
+	{ 0, 80, 0, 8959 },
+	{ 0, 80, 0, 8961 },
+	{ 0, 80, 0, 8963 },
+	{ 0, 80, 0, 8965 },
+	{ 0, 80, 0, 8967 },
+	{ 0, 80, 0, 8969 },
+	{ 0, 80, 0, 8971 },
+	{ 0, 80, 0, 8973 },
+	{ 0, 80, 0, 8975 },
+	{ 0, 80, 0, 8977 },
+	{ 0, 80, 0, 8979 },
+	{ 0, 80, 0, 8981 },
+	{ 0, 80, 0, 8983 },
+	{ 0, 80, 0, 8985 },
+	{ 0, 80, 0, 8987 },
+	{ 0, 80, 0, 8989 },
+	{ 0, 80, 0, 8991 },
+	{ 0, 80, 0, 8993 },
+	{ 0, 80, 0, 8995 },
+	{ 0, 80, 0, 8997 },
+	{ 0, 80, 0, 8999 },
+	{ 0, 80, 0, 9001 },
+	{ 0, 80, 0, 9003 },
+	{ 0, 80, 0, 9005 },
+	{ 0, 80, 0, 9007 },
+	{ 0, 80, 0, 9009 },
+	{ 0, 68, 9011, 9011 },
+	{ 0, 68, 9014, 9014 },
+	{ 0, 68, 9017, 9017 },
+	{ 0, 68, 9020, 9020 },
+	{ 0, 68, 9023, 9023 },
+	{ 0, 68, 9026, 9026 },
+	{ 0, 68, 9029, 9029 },
+	{ 0, 68, 9032, 9032 },
+	{ 0, 68, 9035, 9035 },
+	{ 0, 68, 9038, 9038 },
+	{ 0, 68, 9041, 9041 },
+	{ 0, 68, 9044, 9044 },
+	{ 0, 68, 9047, 9047 },
+	{ 6, 0, 0, 0 },
+	{ 0, 85, 9050, 9050 },
+	{ 0, 85, 9053, 9053 },
+	{ 0, 85, 9056, 9056 },
+	{ 0, 85, 9060, 9060 },
+	{ 0, 85, 9064, 9064 },
+	{ 0, 85, 9068, 9068 },
+	{ 0, 85, 9072, 9072 },
+	{ 226, 0, 0, 0 },
+	{ 0, 85, 9076, 9076 },
+	{ 0, 85, 9079, 9079 },
+	{ 0, 85, 9082, 9082 },
+	{ 0, 85, 9086, 9086 },
+	{ 0, 85, 9090, 9090 },
+	{ 0, 85, 9094, 9094 },
+	{ 0, 80, 0, 9098 },
+	{ 0, 80, 0, 9100 },
+	{ 0, 80, 0, 9102 },
+	{ 0, 80, 0, 9104 },
+	{ 0, 80, 0, 9106 },
+	{ 0, 80, 0, 9108 },
+	{ 0, 80, 0, 9110 },
+	{ 0, 80, 0, 9112 },
+	{ 0, 80, 0, 9114 },
+	{ 0, 80, 0, 9116 },
+	{ 0, 80, 0, 9118 },
+	{ 0, 80, 0, 9120 },
+	{ 0, 80, 0, 9122 },
+	{ 0, 80, 0, 9124 },
+	{ 0, 80, 0, 9126 },
+	{ 0, 80, 0, 9128 },
+	{ 0, 80, 0, 9130 },
+	{ 0, 80, 0, 9132 },
+	{ 0, 80, 0, 9134 },
+	{ 0, 80, 0, 9136 },
+	{ 0, 80, 0, 3440 },
+	{ 0, 80, 0, 9138 },
+	{ 0, 80, 0, 9140 },
+	{ 0, 80, 0, 9142 },
+	{ 0, 80, 0, 9144 },
+	{ 0, 80, 0, 3131 },
+	{ 0, 80, 0, 9146 },
+	{ 0, 80, 0, 9148 },
+	{ 0, 80, 0, 9150 },
+	{ 0, 80, 0, 9152 },
+	{ 0, 80, 0, 9154 },
+	{ 0, 80, 0, 9156 },
+	{ 0, 80, 0, 9158 },
+	{ 0, 80, 0, 9160 },
+	{ 0, 80, 0, 9162 },
+	{ 0, 80, 0, 9164 },
+	{ 0, 80, 0, 9166 },
+	{ 0, 80, 0, 9168 },
+	{ 0, 80, 0, 9170 },
+	{ 0, 80, 0, 9172 },
+	{ 0, 80, 0, 9174 },
+	{ 0, 80, 0, 9176 },
+	{ 0, 80, 0, 9179 },
+	{ 0, 80, 0, 9182 },
+	{ 0, 80, 0, 9185 },
+	{ 0, 80, 0, 9188 },
+	{ 0, 80, 0, 9191 },
+	{ 0, 80, 0, 9194 },
+	{ 0, 80, 0, 9197 },
+	{ 0, 80, 0, 9200 },
+	{ 0, 80, 0, 9203 },
+	{ 0, 80, 0, 9206 },
+	{ 0, 80, 0, 9209 },
+	{ 0, 80, 0, 9213 },
+	{ 0, 80, 0, 9217 },
+	{ 0, 80, 0, 9221 },
+	{ 0, 80, 0, 9225 },
+	{ 0, 80, 0, 9229 },
+	{ 0, 80, 0, 9233 },
+	{ 0, 80, 0, 9237 },
+	{ 0, 80, 0, 9241 },
+	{ 0, 80, 0, 9245 },
+	{ 0, 80, 0, 9249 },
+	{ 0, 80, 0, 9253 },
+	{ 0, 80, 0, 9257 },
+	{ 0, 80, 0, 9261 },
+	{ 0, 80, 0, 9265 },
+	{ 0, 80, 0, 9269 },
+	{ 0, 80, 0, 9273 },
+	{ 0, 80, 0, 9277 },
+	{ 0, 80, 0, 9281 },
+	{ 0, 80, 0, 9285 },
+	{ 0, 80, 0, 9289 },
+	{ 0, 80, 0, 9293 },
+	{ 0, 80, 0, 9297 },
+	{ 0, 80, 0, 9301 },
+	{ 0, 80, 0, 9305 },
+	{ 0, 80, 0, 9309 },
+	{ 0, 80, 0, 9313 },
+	{ 0, 80, 0, 9317 },
+	{ 0, 80, 0, 9320 },
+	{ 0, 80, 0, 9323 },
+	{ 0, 80, 0, 9326 },
+	{ 0, 80, 0, 9329 },
+	{ 0, 80, 0, 9332 },
+	{ 0, 80, 0, 9336 },
+	{ 0, 80, 0, 9339 },
+	{ 0, 80, 0, 9342 },
+	{ 0, 80, 0, 9345 },
+	{ 0, 80, 0, 9348 },
+	{ 0, 80, 0, 9351 },
+	{ 0, 80, 0, 9354 },
+	{ 0, 80, 0, 9357 },
+	{ 0, 80, 0, 9359 },
+	{ 0, 80, 0, 4641 },
+	{ 0, 80, 0, 9361 },
+	{ 0, 80, 0, 9363 },
+	{ 0, 80, 0, 9365 },
+	{ 0, 80, 0, 9367 },
+	{ 0, 80, 0, 9369 },
+	{ 0, 80, 0, 6966 },
+	{ 0, 80, 0, 9371 },
+	{ 0, 80, 0, 9373 },
+	{ 0, 80, 0, 9375 },
+	{ 0, 80, 0, 9377 },
+	{ 0, 80, 0, 9379 },
+	{ 0, 80, 0, 9381 },
+	{ 0, 80, 0, 9383 },
+	{ 0, 80, 0, 9385 },
+	{ 0, 80, 0, 9387 },
+	{ 0, 80, 0, 9389 },
+	{ 0, 80, 0, 9391 },
+	{ 0, 80, 0, 9393 },
+	{ 0, 80, 0, 9395 },
+	{ 0, 80, 0, 9397 },
+	{ 0, 80, 0, 9399 },
+	{ 0, 80, 0, 9401 },
+	{ 0, 80, 0, 9403 },
+	{ 0, 80, 0, 9405 },
+	{ 0, 80, 0, 9407 },
+	{ 0, 80, 0, 9409 },
+	{ 0, 80, 0, 9411 },
+	{ 0, 80, 0, 9413 },
+	{ 0, 80, 0, 9415 },
+	{ 0, 80, 0, 9417 },
+	{ 0, 80, 0, 9421 },
+	{ 0, 80, 0, 9425 },
+	{ 0, 80, 0, 9429 },
+	{ 0, 80, 0, 9433 },
+	{ 0, 80, 0, 9437 },
+	{ 0, 80, 0, 9441 },
+	{ 0, 80, 0, 9445 },
+	{ 0, 80, 0, 9449 },
+	{ 0, 80, 0, 9453 },
+	{ 0, 80, 0, 9455 },
+	{ 0, 85, 9457, 9457 },
+	{ 0, 85, 9459, 9459 },
+	{ 0, 85, 9461, 9461 },
+	{ 0, 85, 9463, 9463 },
+	{ 0, 85, 9465, 9465 },
+	{ 0, 85, 9467, 9467 },
+	{ 0, 85, 9469, 9469 },
+	{ 0, 85, 9471, 9471 },
+	{ 0, 85, 9473, 9473 },
+	{ 0, 85, 9475, 9475 },
+	{ 0, 85, 9477, 9477 },
+	{ 0, 85, 9479, 9479 },
+	{ 0, 85, 9481, 9481 },
+	{ 0, 85, 9483, 9483 },
+	{ 0, 85, 9485, 9485 },
+	{ 0, 85, 9487, 9487 },
+	{ 0, 85, 9489, 9489 },
+	{ 0, 85, 9491, 9491 },
+	{ 0, 85, 9375, 9375 },
+	{ 0, 85, 9493, 9493 },
+	{ 0, 85, 9495, 9495 },
+	{ 0, 85, 9497, 9497 },
+	{ 0, 85, 9499, 9499 },
+	{ 0, 85, 9501, 9501 },
+	{ 0, 85, 9503, 9503 },
+	{ 0, 85, 4110, 4110 },
+	{ 0, 85, 9505, 9505 },
+	{ 0, 85, 9507, 9507 },
+	{ 0, 85, 9509, 9509 },
+	{ 0, 85, 9511, 9511 },
+	{ 0, 85, 9411, 9411 },
+	{ 0, 85, 9513, 9513 },
+	{ 0, 85, 9515, 9515 },
+	{ 0, 85, 9517, 9517 },
+	{ 0, 85, 9519, 9519 },
+	{ 0, 85, 9521, 9521 },
+	{ 0, 85, 9523, 9523 },
+	{ 0, 85, 9525, 9525 },
+	{ 0, 85, 9527, 9527 },
+	{ 0, 85, 9529, 9529 },
+	{ 0, 85, 9531, 9531 },
+	{ 0, 85, 9533, 9533 },
+	{ 0, 85, 9535, 9535 },
+	{ 0, 85, 9537, 9537 },
+	{ 0, 85, 9539, 9539 },
+	{ 0, 85, 9541, 9541 },
+	{ 0, 85, 9543, 9543 },
+	{ 0, 85, 9545, 9545 },
+	{ 0, 85, 9547, 9547 },
+	{ 0, 85, 9549, 9549 },
+	{ 0, 85, 9551, 9551 },
+	{ 0, 85, 9553, 9553 },
+	{ 0, 85, 9555, 9555 },
+	{ 0, 85, 9557, 9557 },
+	{ 0, 85, 9559, 9559 },
+	{ 0, 85, 9561, 9561 },
+	{ 0, 85, 9563, 9563 },
+	{ 0, 85, 9565, 9565 },
+	{ 0, 85, 9567, 9567 },
+	{ 0, 85, 9569, 9569 },
+	{ 0, 85, 9571, 9571 },
+	{ 0, 85, 9573, 9573 },
+	{ 0, 85, 9575, 9575 },
+	{ 0, 85, 9577, 9577 },
+	{ 0, 85, 9579, 9579 },
+	{ 0, 85, 9581, 9581 },
+	{ 0, 85, 9583, 9583 },
+	{ 0, 85, 9585, 9585 },
+	{ 0, 85, 9587, 9587 },
+	{ 0, 85, 9589, 9589 },
+	{ 0, 85, 9591, 9591 },
+	{ 0, 85, 9593, 9593 },
+	{ 0, 85, 9595, 9595 },
+	{ 0, 85, 9597, 9597 },
+	{ 0, 85, 9599, 9599 },
+	{ 0, 85, 9601, 9601 },
+	{ 0, 85, 9603, 9603 },
+	{ 0, 85, 9361, 9361 },
+	{ 0, 85, 9605, 9605 },
+	{ 0, 85, 9607, 9607 },
+	{ 0, 85, 9609, 9609 },
+	{ 0, 85, 9611, 9611 },
+	{ 0, 85, 9613, 9613 },
+	{ 0, 85, 9615, 9615 },
+	{ 0, 85, 9617, 9617 },
+	{ 0, 85, 9619, 9619 },
+	{ 0, 85, 9621, 9621 },
+	{ 0, 85, 9623, 9623 },
+	{ 0, 85, 9625, 9625 },
+	{ 0, 85, 9627, 9627 },
+	{ 0, 85, 9629, 9629 },
+	{ 0, 85, 9631, 9631 },
+	{ 0, 85, 9633, 9633 },
+	{ 0, 85, 9635, 9635 },
+	{ 0, 85, 9637, 9637 },
+	{ 0, 85, 9639, 9639 },
+	{ 0, 85, 9641, 9641 },
+	{ 0, 85, 9643, 9643 },
+	{ 0, 85, 9645, 9645 },
+	{ 0, 85, 4162, 4162 },
+	{ 0, 85, 9647, 9647 },
+	{ 0, 85, 9649, 9649 },
+	{ 0, 85, 9651, 9651 },
+	{ 0, 85, 9653, 9653 },
+	{ 0, 85, 9655, 9655 },
+	{ 0, 85, 9657, 9657 },
+	{ 0, 85, 9659, 9659 },
+	{ 0, 85, 9661, 9661 },
+	{ 0, 85, 9663, 9663 },
+	{ 0, 85, 9665, 9665 },
+	{ 0, 85, 9667, 9667 },
+	{ 0, 85, 9669, 9669 },
+	{ 0, 85, 9671, 9671 },
+	{ 0, 85, 9673, 9673 },
+	{ 0, 85, 9675, 9675 },
+	{ 0, 85, 9677, 9677 },
+	{ 0, 85, 9679, 9679 },
+	{ 0, 85, 9681, 9681 },
+	{ 0, 85, 9683, 9683 },
+	{ 0, 85, 9685, 9685 },
+	{ 0, 85, 9687, 9687 },
+	{ 0, 85, 9689, 9689 },
+	{ 0, 85, 9691, 9691 },
+	{ 0, 85, 9693, 9693 },
+	{ 0, 85, 4186, 4186 },
+	{ 0, 85, 9695, 9695 },
+	{ 0, 85, 9697, 9697 },
+	{ 0, 85, 9699, 9699 },
+	{ 0, 85, 9701, 9701 },
+	{ 0, 85, 9703, 9703 },
+	{ 0, 85, 9705, 9705 },
+	{ 0, 85, 9707, 9707 },
+	{ 0, 85, 9709, 9709 },
+	{ 0, 85, 9711, 9711 },
+	{ 0, 85, 9713, 9713 },
+	{ 0, 85, 9715, 9715 },
+	{ 0, 85, 9717, 9717 },
+	{ 0, 85, 9719, 9719 },
+	{ 0, 85, 9721, 9721 },
+	{ 0, 85, 9723, 9723 },
+	{ 0, 85, 9725, 9725 },
+	{ 0, 85, 9727, 9727 },
+	{ 0, 85, 9729, 9729 },
+	{ 0, 85, 9731, 9731 },
+	{ 0, 85, 9733, 9733 },
+	{ 0, 85, 9735, 9735 },
+	{ 0, 85, 9737, 9737 },
+	{ 0, 85, 9739, 9739 },
+	{ 0, 85, 9741, 9741 },
+	{ 0, 85, 9743, 9743 },
+	{ 0, 85, 9745, 9745 },
+	{ 0, 85, 9747, 9747 },
+	{ 0, 85, 9749, 9749 },
+	{ 0, 85, 9751, 9751 },
+	{ 0, 85, 9753, 9753 },
+	{ 0, 85, 9755, 9755 },
+	{ 0, 85, 9757, 9757 },
+	{ 0, 85, 9759, 9759 },
+	{ 0, 85, 9761, 9761 },
+	{ 0, 85, 9763, 9763 },
+	{ 0, 85, 9765, 9765 },
+	{ 0, 85, 9767, 9767 },
+	{ 0, 85, 9769, 9769 },
+	{ 0, 85, 9771, 9771 },
+	{ 0, 85, 9773, 9773 },
+	{ 0, 85, 9775, 9775 },
+	{ 0, 85, 9777, 9777 },
+	{ 0, 85, 9779, 9779 },
+	{ 0, 85, 9781, 9781 },
+	{ 0, 85, 9783, 9783 },
+	{ 0, 85, 9785, 9785 },
+	{ 0, 85, 9787, 9787 },
+	{ 0, 85, 9789, 9789 },
+	{ 0, 85, 9791, 9791 },
+	{ 0, 85, 9793, 9793 },
+	{ 0, 85, 9795, 9795 },
+	{ 0, 85, 9797, 9797 },
+	{ 0, 85, 9799, 9799 },
+	{ 0, 85, 9801, 9801 },
+	{ 0, 85, 9803, 9803 },
+	{ 0, 85, 9805, 9805 },
+	{ 0, 85, 9807, 9807 },
+	{ 0, 85, 9809, 9809 },
+	{ 0, 85, 9811, 9811 },
+	{ 0, 85, 9813, 9813 },
+	{ 0, 85, 9815, 9815 },
+	{ 0, 85, 9817, 9817 },
+	{ 0, 85, 9819, 9819 },
+	{ 0, 85, 9821, 9821 },
+	{ 0, 85, 9823, 9823 },
+	{ 0, 85, 9825, 9825 },
+	{ 0, 85, 9827, 9827 },
+	{ 0, 85, 9829, 9829 },
+	{ 0, 85, 9831, 9831 },
+	{ 0, 85, 9833, 9833 },
+	{ 0, 85, 9835, 9835 },
+	{ 0, 85, 9837, 9837 },
+	{ 0, 85, 9839, 9839 },
+	{ 0, 85, 9841, 9841 },
+	{ 0, 85, 9843, 9843 },
+	{ 0, 85, 9845, 9845 },
+	{ 0, 85, 9847, 9847 },
+	{ 0, 85, 9849, 9849 },
+	{ 0, 85, 9851, 9851 },
+	{ 0, 85, 9853, 9853 },
+	{ 0, 85, 9855, 9855 },
+	{ 0, 85, 9857, 9857 },
+	{ 0, 85, 9859, 9859 },
+	{ 0, 85, 9861, 9861 },
+	{ 0, 85, 9863, 9863 },
+	{ 0, 85, 9865, 9865 },
+	{ 0, 85, 9867, 9867 },
+	{ 0, 85, 9869, 9869 },
+	{ 0, 85, 9871, 9871 },
+	{ 0, 85, 9873, 9873 },
+	{ 0, 85, 9875, 9875 },
+	{ 0, 85, 9877, 9877 },
+	{ 0, 85, 9879, 9879 },
+	{ 0, 85, 9881, 9881 },
+	{ 0, 85, 9883, 9883 },
+	{ 0, 85, 9885, 9885 },
+	{ 0, 85, 9887, 9887 },
+	{ 0, 85, 9889, 9889 },
+	{ 0, 85, 9891, 9891 },
+	{ 0, 85, 9893, 9893 },
+	{ 0, 85, 9895, 9895 },
+	{ 0, 85, 9897, 9897 },
+	{ 0, 85, 9899, 9899 },
+	{ 0, 85, 9901, 9901 },
+	{ 0, 85, 9903, 9903 },
+	{ 0, 85, 9905, 9905 },
+	{ 0, 85, 9907, 9907 },
+	{ 0, 85, 9909, 9909 },
+	{ 0, 85, 9911, 9911 },
+	{ 0, 85, 9913, 9913 },
+	{ 0, 85, 9915, 9915 },
+	{ 0, 85, 9917, 9917 },
+	{ 0, 85, 9919, 9919 },
+	{ 0, 85, 9921, 9921 },
+	{ 0, 85, 9923, 9923 },
+	{ 0, 85, 9925, 9925 },
+	{ 0, 85, 9927, 9927 },
+	{ 0, 85, 9929, 9929 },
+	{ 0, 85, 9931, 9931 },
+	{ 0, 85, 9933, 9933 },
+	{ 0, 85, 9935, 9935 },
+	{ 0, 85, 9937, 9937 },
+	{ 0, 85, 9939, 9939 },
+	{ 0, 85, 9941, 9941 },
+	{ 0, 85, 9943, 9943 },
+	{ 0, 85, 9945, 9945 },
+	{ 0, 85, 9947, 9947 },
+	{ 0, 85, 9949, 9949 },
+	{ 0, 85, 9951, 9951 },
+	{ 0, 85, 9953, 9953 },
+	{ 0, 85, 9955, 9955 },
+	{ 0, 85, 9957, 9957 },
+	{ 0, 85, 9959, 9959 },
+	{ 0, 85, 9961, 9961 },
+	{ 0, 85, 9963, 9963 },
+	{ 0, 85, 9965, 9965 },
+	{ 0, 85, 9967, 9967 },
+	{ 0, 85, 9969, 9969 },
+	{ 0, 85, 9971, 9971 },
+	{ 0, 85, 9973, 9973 },
+	{ 0, 85, 9975, 9975 },
+	{ 0, 85, 9977, 9977 },
+	{ 0, 85, 9979, 9979 },
+	{ 0, 85, 9981, 9981 },
+	{ 0, 85, 9983, 9983 },
+	{ 0, 85, 9985, 9985 },
+	{ 0, 85, 9987, 9987 },
+	{ 0, 85, 9989, 9989 },
+	{ 0, 85, 9991, 9991 },
+	{ 0, 85, 9993, 9993 },
+	{ 0, 85, 9995, 9995 },
+	{ 0, 85, 9997, 9997 },
+	{ 0, 85, 9999, 9999 },
+	{ 0, 85, 10001, 10001 },
+	{ 0, 85, 10003, 10003 },
+	{ 0, 85, 10005, 10005 },
+	{ 0, 85, 10007, 10007 },
+	{ 0, 85, 10009, 10009 },
+	{ 0, 85, 10011, 10011 },
+	{ 0, 85, 10013, 10013 },
+	{ 0, 85, 10015, 10015 },
+	{ 0, 85, 10017, 10017 },
+	{ 0, 85, 10019, 10019 },
+	{ 0, 85, 10021, 10021 },
+	{ 0, 85, 10023, 10023 },
+	{ 0, 85, 10025, 10025 },
+	{ 0, 85, 10027, 10027 },
+	{ 0, 85, 10029, 10029 },
+	{ 0, 85, 10031, 10031 },
+	{ 0, 85, 10033, 10033 },
+	{ 0, 85, 10035, 10035 },
+	{ 0, 85, 10037, 10037 },
+	{ 0, 85, 10039, 10039 },
+	{ 0, 85, 10041, 10041 },
+	{ 0, 85, 10043, 10043 },
+	{ 0, 85, 10045, 10045 },
+	{ 0, 85, 10047, 10047 },
+	{ 0, 85, 10049, 10049 },
+	{ 0, 85, 10051, 10051 },
+	{ 0, 85, 10053, 10053 },
+	{ 0, 85, 10055, 10055 },
+	{ 0, 85, 10057, 10057 },
+	{ 0, 85, 10059, 10059 },
+	{ 0, 85, 10061, 10061 },
+	{ 0, 85, 10063, 10063 },
+	{ 0, 85, 10065, 10065 },
+	{ 0, 85, 10067, 10067 },
+	{ 0, 85, 10069, 10069 },
+	{ 0, 85, 10071, 10071 },
+	{ 0, 85, 10073, 10073 },
+	{ 0, 85, 10075, 10075 },
+	{ 0, 85, 10077, 10077 },
+	{ 0, 85, 10079, 10079 },
+	{ 0, 85, 10081, 10081 },
+	{ 0, 85, 10083, 10083 },
+	{ 0, 85, 10085, 10085 },
+	{ 0, 85, 10087, 10087 },
+	{ 0, 85, 10089, 10089 },
+	{ 0, 85, 10091, 10091 },
+	{ 0, 85, 10093, 10093 },
+	{ 0, 85, 10095, 10095 },
+	{ 0, 85, 10097, 10097 },
+	{ 0, 85, 10099, 10099 },
+	{ 0, 85, 10101, 10101 },
+	{ 0, 85, 10103, 10103 },
+	{ 0, 85, 10105, 10105 },
+	{ 0, 85, 10107, 10107 },
+	{ 0, 85, 10109, 10109 },
+	{ 0, 85, 10111, 10111 },
+	{ 0, 85, 10113, 10113 },
+	{ 0, 85, 10115, 10115 },
+	{ 0, 85, 10117, 10117 },
+	{ 0, 85, 10119, 10119 },
+	{ 0, 85, 10121, 10121 },
+	{ 0, 85, 10123, 10123 },
+	{ 0, 85, 10125, 10125 },
+	{ 0, 85, 10127, 10127 },
+	{ 0, 85, 10129, 10129 },
+	{ 0, 85, 10131, 10131 },
+	{ 0, 85, 10133, 10133 },
+	{ 0, 85, 10135, 10135 },
+	{ 0, 85, 10137, 10137 },
+	{ 0, 85, 10139, 10139 },
+	{ 0, 85, 10141, 10141 },
+	{ 0, 85, 10143, 10143 },
+	{ 0, 85, 10145, 10145 },
+	{ 0, 85, 10147, 10147 },
+	{ 0, 85, 10149, 10149 },
+	{ 0, 85, 10151, 10151 },
+	{ 0, 85, 10153, 10153 },
+	{ 0, 85, 10155, 10155 },
+	{ 0, 85, 10157, 10157 },
+	{ 0, 85, 10159, 10159 },
+	{ 0, 85, 10161, 10161 },
+	{ 0, 85, 10163, 10163 },
+	{ 0, 85, 10165, 10165 },
+	{ 0, 85, 10167, 10167 },
+	{ 0, 85, 10169, 10169 },
+	{ 0, 85, 10171, 10171 },
+	{ 0, 85, 10173, 10173 },
+	{ 0, 85, 10175, 10175 },
+	{ 0, 85, 10177, 10177 },
+	{ 0, 85, 10179, 10179 },
+	{ 0, 85, 10181, 10181 },
+	{ 0, 85, 10183, 10183 },
+	{ 0, 85, 10185, 10185 },
+	{ 0, 85, 10187, 10187 },
+	{ 0, 85, 10189, 10189 },
+	{ 0, 85, 10191, 10191 },
+	{ 0, 85, 10193, 10193 },
+	{ 0, 85, 10195, 10195 },
+	{ 0, 85, 10197, 10197 },
+	{ 0, 85, 10199, 10199 },
+	{ 0, 85, 10201, 10201 },
+	{ 0, 85, 10203, 10203 },
+	{ 0, 85, 10205, 10205 },
+	{ 0, 85, 10207, 10207 },
+	{ 0, 85, 10209, 10209 },
+	{ 0, 85, 10211, 10211 },
+	{ 0, 85, 10213, 10213 },
+	{ 0, 85, 10215, 10215 },
+	{ 0, 85, 10217, 10217 },
+	{ 0, 85, 10219, 10219 },
+	{ 0, 85, 10221, 10221 },
+	{ 0, 85, 10223, 10223 },
+	{ 0, 85, 10225, 10225 },
+	{ 0, 85, 10227, 10227 },
+	{ 0, 85, 10229, 10229 },
+	{ 0, 85, 4366, 4366 },
+	{ 0, 85, 10231, 10231 },
+	{ 0, 85, 10233, 10233 },
+	{ 0, 85, 10235, 10235 },
+	{ 0, 85, 10237, 10237 },
+	{ 0, 85, 10239, 10239 },
+	{ 0, 85, 10241, 10241 },
+	{ 0, 85, 10243, 10243 },
+	{ 0, 85, 10245, 10245 },
+	{ 0, 85, 10247, 10247 },
+	{ 0, 85, 10249, 10249 },
+	{ 0, 85, 10251, 10251 },
+	{ 0, 85, 4380, 4380 },
+	{ 0, 85, 10253, 10253 },
+	{ 0, 85, 10255, 10255 },
+	{ 0, 85, 10257, 10257 },
+	{ 0, 85, 10259, 10259 },
+	{ 0, 85, 10261, 10261 },
+	{ 0, 85, 10263, 10263 },
+	{ 0, 85, 10265, 10265 },
+	{ 0, 85, 10267, 10267 },
+	{ 0, 85, 10269, 10269 },
+	{ 0, 85, 10271, 10271 },
+	{ 0, 85, 10273, 10273 },
+	{ 0, 85, 10275, 10275 },
+	{ 0, 85, 10277, 10277 },
+	{ 0, 85, 10279, 10279 },
+	{ 0, 85, 10281, 10281 },
+	{ 0, 85, 10283, 10283 },
+	{ 0, 85, 10285, 10285 },
+	{ 0, 85, 10287, 10287 },
+	{ 0, 85, 10289, 10289 },
+	{ 0, 85, 10291, 10291 },
+	{ 0, 85, 10293, 10293 },
+	{ 0, 85, 10295, 10295 },
+	{ 0, 85, 10297, 10297 },
+	{ 0, 85, 10299, 10299 },
+	{ 0, 85, 10301, 10301 },
+	{ 0, 85, 10303, 10303 },
+	{ 0, 85, 10305, 10305 },
+	{ 0, 85, 10307, 10307 },
+	{ 0, 85, 10309, 10309 },
+	{ 0, 85, 10311, 10311 },
+	{ 0, 85, 10313, 10313 },
+	{ 0, 85, 10315, 10315 },
+	{ 0, 85, 10317, 10317 },
+	{ 0, 85, 10319, 10319 },
+	{ 0, 85, 10321, 10321 },
+	{ 0, 85, 10323, 10323 },
+	{ 0, 85, 10325, 10325 },
+	{ 0, 85, 10327, 10327 },
+	{ 0, 85, 10329, 10329 },
+	{ 0, 85, 10331, 10331 },
+	{ 0, 85, 10333, 10333 },
+	{ 0, 85, 10335, 10335 },
+	{ 0, 85, 10337, 10337 },
+	{ 0, 85, 10339, 10339 },
+	{ 0, 85, 10341, 10341 },
+	{ 0, 85, 10343, 10343 },
+	{ 0, 85, 10345, 10345 },
+	{ 0, 85, 10347, 10347 },
+	{ 0, 85, 10349, 10349 },
+	{ 0, 85, 10351, 10351 },
+	{ 0, 85, 10353, 10353 },
+	{ 0, 85, 10355, 10355 },
+	{ 0, 85, 10357, 10357 },
+	{ 0, 85, 10359, 10359 },
+	{ 0, 85, 10361, 10361 },
+	{ 0, 85, 10363, 10363 },
+	{ 0, 85, 10365, 10365 },
+	{ 0, 85, 10367, 10367 },
+	{ 0, 85, 10369, 10369 },
+	{ 0, 85, 10371, 10371 },
+	{ 0, 85, 10373, 10373 },
+	{ 0, 85, 10375, 10375 },
+	{ 0, 85, 4476, 4476 },
+	{ 0, 85, 10377, 10377 },
+	{ 0, 85, 4484, 4484 },
+	{ 0, 85, 10379, 10379 },
+	{ 0, 85, 10381, 10381 },
+	{ 0, 85, 10383, 10383 },
+	{ 0, 85, 10385, 10385 },
+	{ 0, 85, 4494, 4494 },
+	{ 0, 85, 10387, 10387 },
+};
+
+static const uint32_t normDecomp[10389] = {
+	0, 1, 32, 2, 32, 776, 1, 97, 2, 32, 772, 1,
+	50, 1, 51, 2, 32, 769, 1, 956, 2, 32, 807, 1,
+	49, 1, 111, 3, 49, 8260, 52, 3, 49, 8260, 50, 3,
+	51, 8260, 52, 2, 65, 768, 2, 65, 769, 2, 65, 770,
+	2, 65, 771, 2, 65, 776, 2, 65, 778, 2, 67, 807,
+	2, 69, 768, 2, 69, 769, 2, 69, 770, 2, 69, 776,
+	2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776,
+	2, 78, 771, 2, 79, 768, 2, 79, 769, 2, 79, 770,
+	2, 79, 771, 2, 79, 776, 2, 85, 768, 2, 85, 769,
+	2, 85, 770, 2, 85, 776, 2, 89, 769, 2, 97, 768,
+	2, 97, 769, 2, 97, 770, 2, 97, 771, 2, 97, 776,
+	2, 97, 778, 2, 99, 807, 2, 101, 768, 2, 101, 769,
+	2, 101, 770, 2, 101, 776, 2, 105, 768, 2, 105, 769,
+	2, 105, 770, 2, 105, 776, 2, 110, 771, 2, 111, 768,
+	2, 111, 769, 2, 111, 770, 2, 111, 771, 2, 111, 776,
+	2, 117, 768, 2, 117, 769, 2, 117, 770, 2, 117, 776,
+	2, 121, 769, 2, 121, 776, 2, 65, 772, 2, 97, 772,
+	2, 65, 774, 2, 97, 774, 2, 65, 808, 2, 97, 808,
+	2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99, 770,
+	2, 67, 775, 2, 99, 775, 2, 67, 780, 2, 99, 780,
+	2, 68, 780, 2, 100, 780, 2, 69, 772, 2, 101, 772,
+	2, 69, 774, 2, 101, 774, 2, 69, 775, 2, 101, 775,
+	2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780,
+	2, 71, 770, 2, 103, 770, 2, 71, 774, 2, 103, 774,
+	2, 71, 775, 2, 103, 775, 2, 71, 807, 2, 103, 807,
+	2, 72, 770, 2, 104, 770, 2, 73, 771, 2, 105, 771,
+	2, 73, 772, 2, 105, 772, 2, 73, 774, 2, 105, 774,
+	2, 73, 808, 2, 105, 808, 2, 73, 775, 2, 73, 74,
+	2, 105, 106, 2, 74, 770, 2, 106, 770, 2, 75, 807,
+	2, 107, 807, 2, 76, 769, 2, 108, 769, 2, 76, 807,
+	2, 108, 807, 2, 76, 780, 2, 108, 780, 2, 76, 183,
+	2, 108, 183, 2, 78, 769, 2, 110, 769, 2, 78, 807,
+	2, 110, 807, 2, 78, 780, 2, 110, 780, 2, 700, 110,
+	2, 79, 772, 2, 111, 772, 2, 79, 774, 2, 111, 774,
+	2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769,
+	2, 82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780,
+	2, 83, 769, 2, 115, 769, 2, 83, 770, 2, 115, 770,
+	2, 83, 807, 2, 115, 807, 2, 83, 780, 2, 115, 780,
+	2, 84, 807, 2, 116, 807, 2, 84, 780, 2, 116, 780,
+	2, 85, 771, 2, 117, 771, 2, 85, 772, 2, 117, 772,
+	2, 85, 774, 2, 117, 774, 2, 85, 778, 2, 117, 778,
+	2, 85, 779, 2, 117, 779, 2, 85, 808, 2, 117, 808,
+	2, 87, 770, 2, 119, 770, 2, 89, 770, 2, 121, 770,
+	2, 89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775,
+	2, 122, 775, 2, 90, 780, 2, 122, 780, 1, 115, 2,
+	79, 795, 2, 111, 795, 2, 85, 795, 2, 117, 795, 3,
+	68, 90, 780, 3, 68, 122, 780, 3, 100, 122, 780, 2,
+	76, 74, 2, 76, 106, 2, 108, 106, 2, 78, 74, 2,
+	78, 106, 2, 110, 106, 2, 65, 780, 2, 97, 780, 2,
+	73, 780, 2, 105, 780, 2, 79, 780, 2, 111, 780, 2,
+	85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776,
+	772, 3, 85, 776, 769, 3, 117, 776, 769, 3, 85, 776,
+	780, 3, 117, 776, 780, 3, 85, 776, 768, 3, 117, 776,
+	768, 3, 65, 776, 772, 3, 97, 776, 772, 3, 65, 775,
+	772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2,
+	71, 780, 2, 103, 780, 2, 75, 780, 2, 107, 780, 2,
+	79, 808, 2, 111, 808, 3, 79, 808, 772, 3, 111, 808,
+	772, 2, 439, 780, 2, 658, 780, 2, 106, 780, 2, 68,
+	90, 2, 68, 122, 2, 100, 122, 2, 71, 769, 2, 103,
+	769, 2, 78, 768, 2, 110, 768, 3, 65, 778, 769, 3,
+	97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216, 769,
+	2, 248, 769, 2, 65, 783, 2, 97, 783, 2, 65, 785,
+	2, 97, 785, 2, 69, 783, 2, 101, 783, 2, 69, 785,
+	2, 101, 785, 2, 73, 783, 2, 105, 783, 2, 73, 785,
+	2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79, 785,
+	2, 111, 785, 2, 82, 783, 2, 114, 783, 2, 82, 785,
+	2, 114, 785, 2, 85, 783, 2, 117, 783, 2, 85, 785,
+	2, 117, 785, 2, 83, 806, 2, 115, 806, 2, 84, 806,
+	2, 116, 806, 2, 72, 780, 2, 104, 780, 2, 65, 775,
+	2, 97, 775, 2, 69, 807, 2, 101, 807, 3, 79, 776,
+	772, 3, 111, 776, 772, 3, 79, 771, 772, 3, 111, 771,
+	772, 2, 79, 775, 2, 111, 775, 3, 79, 775, 772, 3,
+	111, 775, 772, 2, 89, 772, 2, 121, 772, 1, 104, 1,
+	614, 1, 106, 1, 114, 1, 633, 1, 635, 1, 641, 1,
+	119, 1, 121, 2, 32, 774, 2, 32, 775, 2, 32, 778,
+	2, 32, 808, 2, 32, 771, 2, 32, 779, 1, 611, 1,
+	108, 1, 120, 1, 661, 1, 768, 1, 769, 1, 787, 2,
+	776, 769, 1, 697, 2, 32, 837, 1, 59, 2, 168, 769,
+	3, 32, 776, 769, 2, 913, 769, 1, 183, 2, 917, 769,
+	2, 919, 769, 2, 921, 769, 2, 927, 769, 2, 933, 769,
+	2, 937, 769, 3, 953, 776, 769, 2, 921, 776, 2, 933,
+	776, 2, 945, 769, 2, 949, 769, 2, 951, 769, 2, 953,
+	769, 3, 965, 776, 769, 2, 953, 776, 2, 965, 776, 2,
+	959, 769, 2, 965, 769, 2, 969, 769, 1, 946, 1, 952,
+	1, 933, 2, 978, 769, 2, 978, 776, 1, 966, 1, 960,
+	1, 954, 1, 961, 1, 962, 1, 920, 1, 949, 1, 931,
+	2, 1045, 768, 2, 1045, 776, 2, 1043, 769, 2, 1030, 776,
+	2, 1050, 769, 2, 1048, 768, 2, 1059, 774, 2, 1048, 774,
+	2, 1080, 774, 2, 1077, 768, 2, 1077, 776, 2, 1075, 769,
+	2, 1110, 776, 2, 1082, 769, 2, 1080, 768, 2, 1091, 774,
+	2, 1140, 783, 2, 1141, 783, 2, 1046, 774, 2, 1078, 774,
+	2, 1040, 774, 2, 1072, 774, 2, 1040, 776, 2, 1072, 776,
+	2, 1045, 774, 2, 1077, 774, 2, 1240, 776, 2, 1241, 776,
+	2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2, 1079, 776,
+	2, 1048, 772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776,
+	2, 1054, 776, 2, 1086, 776, 2, 1256, 776, 2, 1257, 776,
+	2, 1069, 776, 2, 1101, 776, 2, 1059, 772, 2, 1091, 772,
+	2, 1059, 776, 2, 1091, 776, 2, 1059, 779, 2, 1091, 779,
+	2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776,
+	2, 1381, 1410, 2, 1575, 1619, 2, 1575, 1620, 2, 1608, 1620,
+	2, 1575, 1621, 2, 1610, 1620, 2, 1575, 1652, 2, 1608, 1652,
+	2, 1735, 1652, 2, 1610, 1652, 2, 1749, 1620, 2, 1729, 1620,
+	2, 1746, 1620, 2, 2344, 2364, 2, 2352, 2364, 2, 2355, 2364,
+	2, 2325, 2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332, 2364,
+	2, 2337, 2364, 2, 2338, 2364, 2, 2347, 2364, 2, 2351, 2364,
+	2, 2503, 2494, 2, 2503, 2519, 2, 2465, 2492, 2, 2466, 2492,
+	2, 2479, 2492, 2, 2610, 2620, 2, 2616, 2620, 2, 2582, 2620,
+	2, 2583, 2620, 2, 2588, 2620, 2, 2603, 2620, 2, 2887, 2902,
+	2, 2887, 2878, 2, 2887, 2903, 2, 2849, 2876, 2, 2850, 2876,
+	2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2, 3014, 3031,
+	2, 3142, 3158, 2, 3263, 3285, 2, 3270, 3285, 2, 3270, 3286,
+	2, 3270, 3266, 3, 3270, 3266, 3285, 2, 3398, 3390, 2, 3399,
+	3390, 2, 3398, 3415, 2, 3545, 3530, 2, 3545, 3535, 3, 3545,
+	3535, 3530, 2, 3545, 3551, 2, 3661, 3634, 2, 3789, 3762, 2,
+	3755, 3737, 2, 3755, 3745, 1, 3851, 2, 3906, 4023, 2, 3916,
+	4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931, 4023, 2, 3904,
+	4021, 2, 3953, 3954, 2, 3953, 3956, 2, 4018, 3968, 3, 4018,
+	3953, 3968, 2, 4019, 3968, 3, 4019, 3953, 3968, 2, 3953, 3968,
+	2, 3986, 4023, 2, 3996, 4023, 2, 4001, 4023, 2, 4006, 4023,
+	2, 4011, 4023, 2, 3984, 4021, 2, 4133, 4142, 1, 4316, 2,
+	6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2, 6923, 6965, 2,
+	6925, 6965, 2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2,
+	6974, 6965, 2, 6975, 6965, 2, 6978, 6965, 1, 65, 1, 198,
+	1, 66, 1, 68, 1, 69, 1, 398, 1, 71, 1, 72,
+	1, 73, 1, 74, 1, 75, 1, 76, 1, 77, 1, 78,
+	1, 79, 1, 546, 1, 80, 1, 82, 1, 84, 1, 85,
+	1, 87, 1, 592, 1, 593, 1, 7426, 1, 98, 1, 100,
+	1, 101, 1, 601, 1, 603, 1, 604, 1, 103, 1, 107,
+	1, 109, 1, 331, 1, 596, 1, 7446, 1, 7447, 1, 112,
+	1, 116, 1, 117, 1, 7453, 1, 623, 1, 118, 1, 7461,
+	1, 947, 1, 948, 1, 967, 1, 105, 1, 1085, 1, 594,
+	1, 99, 1, 597, 1, 240, 1, 102, 1, 607, 1, 609,
+	1, 613, 1, 616, 1, 617, 1, 618, 1, 7547, 1, 669,
+	1, 621, 1, 7557, 1, 671, 1, 625, 1, 624, 1, 626,
+	1, 627, 1, 628, 1, 629, 1, 632, 1, 642, 1, 643,
+	1, 427, 1, 649, 1, 650, 1, 7452, 1, 651, 1, 652,
+	1, 122, 1, 656, 1, 657, 1, 658, 2, 65, 805, 2,
+	97, 805, 2, 66, 775, 2, 98, 775, 2, 66, 803, 2,
+	98, 803, 2, 66, 817, 2, 98, 817, 3, 67, 807, 769,
+	3, 99, 807, 769, 2, 68, 775, 2, 100, 775, 2, 68,
+	803, 2, 100, 803, 2, 68, 817, 2, 100, 817, 2, 68,
+	807, 2, 100, 807, 2, 68, 813, 2, 100, 813, 3, 69,
+	772, 768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101,
+	772, 769, 2, 69, 813, 2, 101, 813, 2, 69, 816, 2,
+	101, 816, 3, 69, 807, 774, 3, 101, 807, 774, 2, 70,
+	775, 2, 102, 775, 2, 71, 772, 2, 103, 772, 2, 72,
+	775, 2, 104, 775, 2, 72, 803, 2, 104, 803, 2, 72,
+	776, 2, 104, 776, 2, 72, 807, 2, 104, 807, 2, 72,
+	814, 2, 104, 814, 2, 73, 816, 2, 105, 816, 3, 73,
+	776, 769, 3, 105, 776, 769, 2, 75, 769, 2, 107, 769,
+	2, 75, 803, 2, 107, 803, 2, 75, 817, 2, 107, 817,
+	2, 76, 803, 2, 108, 803, 3, 76, 803, 772, 3, 108,
+	803, 772, 2, 76, 817, 2, 108, 817, 2, 76, 813, 2,
+	108, 813, 2, 77, 769, 2, 109, 769, 2, 77, 775, 2,
+	109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2,
+	110, 775, 2, 78, 803, 2, 110, 803, 2, 78, 817, 2,
+	110, 817, 2, 78, 813, 2, 110, 813, 3, 79, 771, 769,
+	3, 111, 771, 769, 3, 79, 771, 776, 3, 111, 771, 776,
+	3, 79, 772, 768, 3, 111, 772, 768, 3, 79, 772, 769,
+	3, 111, 772, 769, 2, 80, 769, 2, 112, 769, 2, 80,
+	775, 2, 112, 775, 2, 82, 775, 2, 114, 775, 2, 82,
+	803, 2, 114, 803, 3, 82, 803, 772, 3, 114, 803, 772,
+	2, 82, 817, 2, 114, 817, 2, 83, 775, 2, 115, 775,
+	2, 83, 803, 2, 115, 803, 3, 83, 769, 775, 3, 115,
+	769, 775, 3, 83, 780, 775, 3, 115, 780, 775, 3, 83,
+	803, 775, 3, 115, 803, 775, 2, 84, 775, 2, 116, 775,
+	2, 84, 803, 2, 116, 803, 2, 84, 817, 2, 116, 817,
+	2, 84, 813, 2, 116, 813, 2, 85, 804, 2, 117, 804,
+	2, 85, 816, 2, 117, 816, 2, 85, 813, 2, 117, 813,
+	3, 85, 771, 769, 3, 117, 771, 769, 3, 85, 772, 776,
+	3, 117, 772, 776, 2, 86, 771, 2, 118, 771, 2, 86,
+	803, 2, 118, 803, 2, 87, 768, 2, 119, 768, 2, 87,
+	769, 2, 119, 769, 2, 87, 776, 2, 119, 776, 2, 87,
+	775, 2, 119, 775, 2, 87, 803, 2, 119, 803, 2, 88,
+	775, 2, 120, 775, 2, 88, 776, 2, 120, 776, 2, 89,
+	775, 2, 121, 775, 2, 90, 770, 2, 122, 770, 2, 90,
+	803, 2, 122, 803, 2, 90, 817, 2, 122, 817, 2, 104,
+	817, 2, 116, 776, 2, 119, 778, 2, 121, 778, 2, 97,
+	702, 2, 383, 775, 2, 65, 803, 2, 97, 803, 2, 65,
+	777, 2, 97, 777, 3, 65, 770, 769, 3, 97, 770, 769,
+	3, 65, 770, 768, 3, 97, 770, 768, 3, 65, 770, 777,
+	3, 97, 770, 777, 3, 65, 770, 771, 3, 97, 770, 771,
+	3, 65, 803, 770, 3, 97, 803, 770, 3, 65, 774, 769,
+	3, 97, 774, 769, 3, 65, 774, 768, 3, 97, 774, 768,
+	3, 65, 774, 777, 3, 97, 774, 777, 3, 65, 774, 771,
+	3, 97, 774, 771, 3, 65, 803, 774, 3, 97, 803, 774,
+	2, 69, 803, 2, 101, 803, 2, 69, 777, 2, 101, 777,
+	2, 69, 771, 2, 101, 771, 3, 69, 770, 769, 3, 101,
+	770, 769, 3, 69, 770, 768, 3, 101, 770, 768, 3, 69,
+	770, 777, 3, 101, 770, 777, 3, 69, 770, 771, 3, 101,
+	770, 771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73,
+	777, 2, 105, 777, 2, 73, 803, 2, 105, 803, 2, 79,
+	803, 2, 111, 803, 2, 79, 777, 2, 111, 777, 3, 79,
+	770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111,
+	770, 768, 3, 79, 770, 777, 3, 111, 770, 777, 3, 79,
+	770, 771, 3, 111, 770, 771, 3, 79, 803, 770, 3, 111,
+	803, 770, 3, 79, 795, 769, 3, 111, 795, 769, 3, 79,
+	795, 768, 3, 111, 795, 768, 3, 79, 795, 777, 3, 111,
+	795, 777, 3, 79, 795, 771, 3, 111, 795, 771, 3, 79,
+	795, 803, 3, 111, 795, 803, 2, 85, 803, 2, 117, 803,
+	2, 85, 777, 2, 117, 777, 3, 85, 795, 769, 3, 117,
+	795, 769, 3, 85, 795, 768, 3, 117, 795, 768, 3, 85,
+	795, 777, 3, 117, 795, 777, 3, 85, 795, 771, 3, 117,
+	795, 771, 3, 85, 795, 803, 3, 117, 795, 803, 2, 89,
+	768, 2, 121, 768, 2, 89, 803, 2, 121, 803, 2, 89,
+	777, 2, 121, 777, 2, 89, 771, 2, 121, 771, 2, 945,
+	787, 2, 945, 788, 3, 945, 787, 768, 3, 945, 788, 768,
+	3, 945, 787, 769, 3, 945, 788, 769, 3, 945, 787, 834,
+	3, 945, 788, 834, 2, 913, 787, 2, 913, 788, 3, 913,
+	787, 768, 3, 913, 788, 768, 3, 913, 787, 769, 3, 913,
+	788, 769, 3, 913, 787, 834, 3, 913, 788, 834, 2, 949,
+	787, 2, 949, 788, 3, 949, 787, 768, 3, 949, 788, 768,
+	3, 949, 787, 769, 3, 949, 788, 769, 2, 917, 787, 2,
+	917, 788, 3, 917, 787, 768, 3, 917, 788, 768, 3, 917,
+	787, 769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788,
+	3, 951, 787, 768, 3, 951, 788, 768, 3, 951, 787, 769,
+	3, 951, 788, 769, 3, 951, 787, 834, 3, 951, 788, 834,
+	2, 919, 787, 2, 919, 788, 3, 919, 787, 768, 3, 919,
+	788, 768, 3, 919, 787, 769, 3, 919, 788, 769, 3, 919,
+	787, 834, 3, 919, 788, 834, 2, 953, 787, 2, 953, 788,
+	3, 953, 787, 768, 3, 953, 788, 768, 3, 953, 787, 769,
+	3, 953, 788, 769, 3, 953, 787, 834, 3, 953, 788, 834,
+	2, 921, 787, 2, 921, 788, 3, 921, 787, 768, 3, 921,
+	788, 768, 3, 921, 787, 769, 3, 921, 788, 769, 3, 921,
+	787, 834, 3, 921, 788, 834, 2, 959, 787, 2, 959, 788,
+	3, 959, 787, 768, 3, 959, 788, 768, 3, 959, 787, 769,
+	3, 959, 788, 769, 2, 927, 787, 2, 927, 788, 3, 927,
+	787, 768, 3, 927, 788, 768, 3, 927, 787, 769, 3, 927,
+	788, 769, 2, 965, 787, 2, 965, 788, 3, 965, 787, 768,
+	3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769,
+	3, 965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 3,
+	933, 788, 768, 3, 933, 788, 769, 3, 933, 788, 834, 2,
+	969, 787, 2, 969, 788, 3, 969, 787, 768, 3, 969, 788,
+	768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787,
+	834, 3, 969, 788, 834, 2, 937, 787, 2, 937, 788, 3,
+	937, 787, 768, 3, 937, 788, 768, 3, 937, 787, 769, 3,
+	937, 788, 769, 3, 937, 787, 834, 3, 937, 788, 834, 2,
+	945, 768, 2, 949, 768, 2, 951, 768, 2, 953, 768, 2,
+	959, 768, 2, 965, 768, 2, 969, 768, 3, 945, 787, 837,
+	3, 945, 788, 837, 4, 945, 787, 768, 837, 4, 945, 788,
+	768, 837, 4, 945, 787, 769, 837, 4, 945, 788, 769, 837,
+	4, 945, 787, 834, 837, 4, 945, 788, 834, 837, 3, 913,
+	787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4,
+	913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788,
+	769, 837, 4, 913, 787, 834, 837, 4, 913, 788, 834, 837,
+	3, 951, 787, 837, 3, 951, 788, 837, 4, 951, 787, 768,
+	837, 4, 951, 788, 768, 837, 4, 951, 787, 769, 837, 4,
+	951, 788, 769, 837, 4, 951, 787, 834, 837, 4, 951, 788,
+	834, 837, 3, 919, 787, 837, 3, 919, 788, 837, 4, 919,
+	787, 768, 837, 4, 919, 788, 768, 837, 4, 919, 787, 769,
+	837, 4, 919, 788, 769, 837, 4, 919, 787, 834, 837, 4,
+	919, 788, 834, 837, 3, 969, 787, 837, 3, 969, 788, 837,
+	4, 969, 787, 768, 837, 4, 969, 788, 768, 837, 4, 969,
+	787, 769, 837, 4, 969, 788, 769, 837, 4, 969, 787, 834,
+	837, 4, 969, 788, 834, 837, 3, 937, 787, 837, 3, 937,
+	788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837,
+	4, 937, 787, 769, 837, 4, 937, 788, 769, 837, 4, 937,
+	787, 834, 837, 4, 937, 788, 834, 837, 2, 945, 774, 2,
+	945, 772, 3, 945, 768, 837, 2, 945, 837, 3, 945, 769,
+	837, 2, 945, 834, 3, 945, 834, 837, 2, 913, 774, 2,
+	913, 772, 2, 913, 768, 2, 913, 837, 2, 32, 787, 1,
+	953, 2, 32, 834, 2, 168, 834, 3, 32, 776, 834, 3,
+	951, 768, 837, 2, 951, 837, 3, 951, 769, 837, 2, 951,
+	834, 3, 951, 834, 837, 2, 917, 768, 2, 919, 768, 2,
+	919, 837, 2, 8127, 768, 3, 32, 787, 768, 2, 8127, 769,
+	3, 32, 787, 769, 2, 8127, 834, 3, 32, 787, 834, 2,
+	953, 774, 2, 953, 772, 3, 953, 776, 768, 2, 953, 834,
+	3, 953, 776, 834, 2, 921, 774, 2, 921, 772, 2, 921,
+	768, 2, 8190, 768, 3, 32, 788, 768, 2, 8190, 769, 3,
+	32, 788, 769, 2, 8190, 834, 3, 32, 788, 834, 2, 965,
+	774, 2, 965, 772, 3, 965, 776, 768, 2, 961, 787, 2,
+	961, 788, 2, 965, 834, 3, 965, 776, 834, 2, 933, 774,
+	2, 933, 772, 2, 933, 768, 2, 929, 788, 2, 168, 768,
+	3, 32, 776, 768, 1, 96, 3, 969, 768, 837, 2, 969,
+	837, 3, 969, 769, 837, 2, 969, 834, 3, 969, 834, 837,
+	2, 927, 768, 2, 937, 768, 2, 937, 837, 1, 180, 2,
+	32, 788, 1, 8194, 1, 8195, 1, 8208, 2, 32, 819, 1,
+	46, 2, 46, 46, 3, 46, 46, 46, 2, 8242, 8242, 3,
+	8242, 8242, 8242, 2, 8245, 8245, 3, 8245, 8245, 8245, 2, 33,
+	33, 2, 32, 773, 2, 63, 63, 2, 63, 33, 2, 33,
+	63, 4, 8242, 8242, 8242, 8242, 1, 48, 1, 52, 1, 53,
+	1, 54, 1, 55, 1, 56, 1, 57, 1, 43, 1, 8722,
+	1, 61, 1, 40, 1, 41, 1, 110, 2, 82, 115, 3,
+	97, 47, 99, 3, 97, 47, 115, 1, 67, 2, 176, 67,
+	3, 99, 47, 111, 3, 99, 47, 117, 1, 400, 2, 176,
+	70, 1, 295, 2, 78, 111, 1, 81, 2, 83, 77, 3,
+	84, 69, 76, 2, 84, 77, 1, 90, 1, 937, 1, 70,
+	1, 1488, 1, 1489, 1, 1490, 1, 1491, 3, 70, 65, 88,
+	1, 915, 1, 928, 1, 8721, 3, 49, 8260, 55, 3, 49,
+	8260, 57, 4, 49, 8260, 49, 48, 3, 49, 8260, 51, 3,
+	50, 8260, 51, 3, 49, 8260, 53, 3, 50, 8260, 53, 3,
+	51, 8260, 53, 3, 52, 8260, 53, 3, 49, 8260, 54, 3,
+	53, 8260, 54, 3, 49, 8260, 56, 3, 51, 8260, 56, 3,
+	53, 8260, 56, 3, 55, 8260, 56, 2, 49, 8260, 2, 73,
+	73, 3, 73, 73, 73, 2, 73, 86, 1, 86, 2, 86,
+	73, 3, 86, 73, 73, 4, 86, 73, 73, 73, 2, 73,
+	88, 1, 88, 2, 88, 73, 3, 88, 73, 73, 2, 105,
+	105, 3, 105, 105, 105, 2, 105, 118, 2, 118, 105, 3,
+	118, 105, 105, 4, 118, 105, 105, 105, 2, 105, 120, 2,
+	120, 105, 3, 120, 105, 105, 3, 48, 8260, 51, 2, 8592,
+	824, 2, 8594, 824, 2, 8596, 824, 2, 8656, 824, 2, 8660,
+	824, 2, 8658, 824, 2, 8707, 824, 2, 8712, 824, 2, 8715,
+	824, 2, 8739, 824, 2, 8741, 824, 2, 8747, 8747, 3, 8747,
+	8747, 8747, 2, 8750, 8750, 3, 8750, 8750, 8750, 2, 8764, 824,
+	2, 8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824,
+	2, 8801, 824, 2, 8781, 824, 2, 60, 824, 2, 62, 824,
+	2, 8804, 824, 2, 8805, 824, 2, 8818, 824, 2, 8819, 824,
+	2, 8822, 824, 2, 8823, 824, 2, 8826, 824, 2, 8827, 824,
+	2, 8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824,
+	2, 8866, 824, 2, 8872, 824, 2, 8873, 824, 2, 8875, 824,
+	2, 8828, 824, 2, 8829, 824, 2, 8849, 824, 2, 8850, 824,
+	2, 8882, 824, 2, 8883, 824, 2, 8884, 824, 2, 8885, 824,
+	1, 12296, 1, 12297, 2, 49, 48, 2, 49, 49, 2, 49,
+	50, 2, 49, 51, 2, 49, 52, 2, 49, 53, 2, 49,
+	54, 2, 49, 55, 2, 49, 56, 2, 49, 57, 2, 50,
+	48, 3, 40, 49, 41, 3, 40, 50, 41, 3, 40, 51,
+	41, 3, 40, 52, 41, 3, 40, 53, 41, 3, 40, 54,
+	41, 3, 40, 55, 41, 3, 40, 56, 41, 3, 40, 57,
+	41, 4, 40, 49, 48, 41, 4, 40, 49, 49, 41, 4,
+	40, 49, 50, 41, 4, 40, 49, 51, 41, 4, 40, 49,
+	52, 41, 4, 40, 49, 53, 41, 4, 40, 49, 54, 41,
+	4, 40, 49, 55, 41, 4, 40, 49, 56, 41, 4, 40,
+	49, 57, 41, 4, 40, 50, 48, 41, 2, 49, 46, 2,
+	50, 46, 2, 51, 46, 2, 52, 46, 2, 53, 46, 2,
+	54, 46, 2, 55, 46, 2, 56, 46, 2, 57, 46, 3,
+	49, 48, 46, 3, 49, 49, 46, 3, 49, 50, 46, 3,
+	49, 51, 46, 3, 49, 52, 46, 3, 49, 53, 46, 3,
+	49, 54, 46, 3, 49, 55, 46, 3, 49, 56, 46, 3,
+	49, 57, 46, 3, 50, 48, 46, 3, 40, 97, 41, 3,
+	40, 98, 41, 3, 40, 99, 41, 3, 40, 100, 41, 3,
+	40, 101, 41, 3, 40, 102, 41, 3, 40, 103, 41, 3,
+	40, 104, 41, 3, 40, 105, 41, 3, 40, 106, 41, 3,
+	40, 107, 41, 3, 40, 108, 41, 3, 40, 109, 41, 3,
+	40, 110, 41, 3, 40, 111, 41, 3, 40, 112, 41, 3,
+	40, 113, 41, 3, 40, 114, 41, 3, 40, 115, 41, 3,
+	40, 116, 41, 3, 40, 117, 41, 3, 40, 118, 41, 3,
+	40, 119, 41, 3, 40, 120, 41, 3, 40, 121, 41, 3,
+	40, 122, 41, 1, 83, 1, 89, 1, 113, 4, 8747, 8747,
+	8747, 8747, 3, 58, 58, 61, 2, 61, 61, 3, 61, 61,
+	61, 2, 10973, 824, 1, 11617, 1, 27597, 1, 40863, 1, 19968,
+	1, 20008, 1, 20022, 1, 20031, 1, 20057, 1, 20101, 1, 20108,
+	1, 20128, 1, 20154, 1, 20799, 1, 20837, 1, 20843, 1, 20866,
+	1, 20886, 1, 20907, 1, 20960, 1, 20981, 1, 20992, 1, 21147,
+	1, 21241, 1, 21269, 1, 21274, 1, 21304, 1, 21313, 1, 21340,
+	1, 21353, 1, 21378, 1, 21430, 1, 21448, 1, 21475, 1, 22231,
+	1, 22303, 1, 22763, 1, 22786, 1, 22794, 1, 22805, 1, 22823,
+	1, 22899, 1, 23376, 1, 23424, 1, 23544, 1, 23567, 1, 23586,
+	1, 23608, 1, 23662, 1, 23665, 1, 24027, 1, 24037, 1, 24049,
+	1, 24062, 1, 24178, 1, 24186, 1, 24191, 1, 24308, 1, 24318,
+	1, 24331, 1, 24339, 1, 24400, 1, 24417, 1, 24435, 1, 24515,
+	1, 25096, 1, 25142, 1, 25163, 1, 25903, 1, 25908, 1, 25991,
+	1, 26007, 1, 26020, 1, 26041, 1, 26080, 1, 26085, 1, 26352,
+	1, 26376, 1, 26408, 1, 27424, 1, 27490, 1, 27513, 1, 27571,
+	1, 27595, 1, 27604, 1, 27611, 1, 27663, 1, 27668, 1, 27700,
+	1, 28779, 1, 29226, 1, 29238, 1, 29243, 1, 29247, 1, 29255,
+	1, 29273, 1, 29275, 1, 29356, 1, 29572, 1, 29577, 1, 29916,
+	1, 29926, 1, 29976, 1, 29983, 1, 29992, 1, 30000, 1, 30091,
+	1, 30098, 1, 30326, 1, 30333, 1, 30382, 1, 30399, 1, 30446,
+	1, 30683, 1, 30690, 1, 30707, 1, 31034, 1, 31160, 1, 31166,
+	1, 31348, 1, 31435, 1, 31481, 1, 31859, 1, 31992, 1, 32566,
+	1, 32593, 1, 32650, 1, 32701, 1, 32769, 1, 32780, 1, 32786,
+	1, 32819, 1, 32895, 1, 32905, 1, 33251, 1, 33258, 1, 33267,
+	1, 33276, 1, 33292, 1, 33307, 1, 33311, 1, 33390, 1, 33394,
+	1, 33400, 1, 34381, 1, 34411, 1, 34880, 1, 34892, 1, 34915,
+	1, 35198, 1, 35211, 1, 35282, 1, 35328, 1, 35895, 1, 35910,
+	1, 35925, 1, 35960, 1, 35997, 1, 36196, 1, 36208, 1, 36275,
+	1, 36523, 1, 36554, 1, 36763, 1, 36784, 1, 36789, 1, 37009,
+	1, 37193, 1, 37318, 1, 37324, 1, 37329, 1, 38263, 1, 38272,
+	1, 38428, 1, 38582, 1, 38585, 1, 38632, 1, 38737, 1, 38750,
+	1, 38754, 1, 38761, 1, 38859, 1, 38893, 1, 38899, 1, 38913,
+	1, 39080, 1, 39131, 1, 39135, 1, 39318, 1, 39321, 1, 39340,
+	1, 39592, 1, 39640, 1, 39647, 1, 39717, 1, 39727, 1, 39730,
+	1, 39740, 1, 39770, 1, 40165, 1, 40565, 1, 40575, 1, 40613,
+	1, 40635, 1, 40643, 1, 40653, 1, 40657, 1, 40697, 1, 40701,
+	1, 40718, 1, 40723, 1, 40736, 1, 40763, 1, 40778, 1, 40786,
+	1, 40845, 1, 40860, 1, 40864, 1, 12306, 1, 21316, 1, 21317,
+	2, 12363, 12441, 2, 12365, 12441, 2, 12367, 12441, 2, 12369, 12441,
+	2, 12371, 12441, 2, 12373, 12441, 2, 12375, 12441, 2, 12377, 12441,
+	2, 12379, 12441, 2, 12381, 12441, 2, 12383, 12441, 2, 12385, 12441,
+	2, 12388, 12441, 2, 12390, 12441, 2, 12392, 12441, 2, 12399, 12441,
+	2, 12399, 12442, 2, 12402, 12441, 2, 12402, 12442, 2, 12405, 12441,
+	2, 12405, 12442, 2, 12408, 12441, 2, 12408, 12442, 2, 12411, 12441,
+	2, 12411, 12442, 2, 12358, 12441, 2, 32, 12441, 2, 32, 12442,
+	2, 12445, 12441, 2, 12424, 12426, 2, 12459, 12441, 2, 12461, 12441,
+	2, 12463, 12441, 2, 12465, 12441, 2, 12467, 12441, 2, 12469, 12441,
+	2, 12471, 12441, 2, 12473, 12441, 2, 12475, 12441, 2, 12477, 12441,
+	2, 12479, 12441, 2, 12481, 12441, 2, 12484, 12441, 2, 12486, 12441,
+	2, 12488, 12441, 2, 12495, 12441, 2, 12495, 12442, 2, 12498, 12441,
+	2, 12498, 12442, 2, 12501, 12441, 2, 12501, 12442, 2, 12504, 12441,
+	2, 12504, 12442, 2, 12507, 12441, 2, 12507, 12442, 2, 12454, 12441,
+	2, 12527, 12441, 2, 12528, 12441, 2, 12529, 12441, 2, 12530, 12441,
+	2, 12541, 12441, 2, 12467, 12488, 1, 4352, 1, 4353, 1, 4522,
+	1, 4354, 1, 4524, 1, 4525, 1, 4355, 1, 4356, 1, 4357,
+	1, 4528, 1, 4529, 1, 4530, 1, 4531, 1, 4532, 1, 4533,
+	1, 4378, 1, 4358, 1, 4359, 1, 4360, 1, 4385, 1, 4361,
+	1, 4362, 1, 4363, 1, 4364, 1, 4365, 1, 4366, 1, 4367,
+	1, 4368, 1, 4369, 1, 4370, 1, 4449, 1, 4450, 1, 4451,
+	1, 4452, 1, 4453, 1, 4454, 1, 4455, 1, 4456, 1, 4457,
+	1, 4458, 1, 4459, 1, 4460, 1, 4461, 1, 4462, 1, 4463,
+	1, 4464, 1, 4465, 1, 4466, 1, 4467, 1, 4468, 1, 4469,
+	1, 4448, 1, 4372, 1, 4373, 1, 4551, 1, 4552, 1, 4556,
+	1, 4558, 1, 4563, 1, 4567, 1, 4569, 1, 4380, 1, 4573,
+	1, 4575, 1, 4381, 1, 4382, 1, 4384, 1, 4386, 1, 4387,
+	1, 4391, 1, 4393, 1, 4395, 1, 4396, 1, 4397, 1, 4398,
+	1, 4399, 1, 4402, 1, 4406, 1, 4416, 1, 4423, 1, 4428,
+	1, 4593, 1, 4594, 1, 4439, 1, 4440, 1, 4441, 1, 4484,
+	1, 4485, 1, 4488, 1, 4497, 1, 4498, 1, 4500, 1, 4510,
+	1, 4513, 1, 19977, 1, 22235, 1, 19978, 1, 20013, 1, 19979,
+	1, 30002, 1, 19993, 1, 19969, 1, 22825, 1, 22320, 3, 40,
+	4352, 41, 3, 40, 4354, 41, 3, 40, 4355, 41, 3, 40,
+	4357, 41, 3, 40, 4358, 41, 3, 40, 4359, 41, 3, 40,
+	4361, 41, 3, 40, 4363, 41, 3, 40, 4364, 41, 3, 40,
+	4366, 41, 3, 40, 4367, 41, 3, 40, 4368, 41, 3, 40,
+	4369, 41, 3, 40, 4370, 41, 4, 40, 4352, 4449, 41, 4,
+	40, 4354, 4449, 41, 4, 40, 4355, 4449, 41, 4, 40, 4357,
+	4449, 41, 4, 40, 4358, 4449, 41, 4, 40, 4359, 4449, 41,
+	4, 40, 4361, 4449, 41, 4, 40, 4363, 4449, 41, 4, 40,
+	4364, 4449, 41, 4, 40, 4366, 4449, 41, 4, 40, 4367, 4449,
+	41, 4, 40, 4368, 4449, 41, 4, 40, 4369, 4449, 41, 4,
+	40, 4370, 4449, 41, 4, 40, 4364, 4462, 41, 7, 40, 4363,
+	4457, 4364, 4453, 4523, 41, 6, 40, 4363, 4457, 4370, 4462, 41,
+	3, 40, 19968, 41, 3, 40, 20108, 41, 3, 40, 19977, 41,
+	3, 40, 22235, 41, 3, 40, 20116, 41, 3, 40, 20845, 41,
+	3, 40, 19971, 41, 3, 40, 20843, 41, 3, 40, 20061, 41,
+	3, 40, 21313, 41, 3, 40, 26376, 41, 3, 40, 28779, 41,
+	3, 40, 27700, 41, 3, 40, 26408, 41, 3, 40, 37329, 41,
+	3, 40, 22303, 41, 3, 40, 26085, 41, 3, 40, 26666, 41,
+	3, 40, 26377, 41, 3, 40, 31038, 41, 3, 40, 21517, 41,
+	3, 40, 29305, 41, 3, 40, 36001, 41, 3, 40, 31069, 41,
+	3, 40, 21172, 41, 3, 40, 20195, 41, 3, 40, 21628, 41,
+	3, 40, 23398, 41, 3, 40, 30435, 41, 3, 40, 20225, 41,
+	3, 40, 36039, 41, 3, 40, 21332, 41, 3, 40, 31085, 41,
+	3, 40, 20241, 41, 3, 40, 33258, 41, 3, 40, 33267, 41,
+	1, 21839, 1, 24188, 1, 31631, 3, 80, 84, 69, 2, 50,
+	49, 2, 50, 50, 2, 50, 51, 2, 50, 52, 2, 50,
+	53, 2, 50, 54, 2, 50, 55, 2, 50, 56, 2, 50,
+	57, 2, 51, 48, 2, 51, 49, 2, 51, 50, 2, 51,
+	51, 2, 51, 52, 2, 51, 53, 2, 4352, 4449, 2, 4354,
+	4449, 2, 4355, 4449, 2, 4357, 4449, 2, 4358, 4449, 2, 4359,
+	4449, 2, 4361, 4449, 2, 4363, 4449, 2, 4364, 4449, 2, 4366,
+	4449, 2, 4367, 4449, 2, 4368, 4449, 2, 4369, 4449, 2, 4370,
+	4449, 5, 4366, 4449, 4535, 4352, 4457, 4, 4364, 4462, 4363, 4468,
+	2, 4363, 4462, 1, 20116, 1, 20845, 1, 19971, 1, 20061, 1,
+	26666, 1, 26377, 1, 31038, 1, 21517, 1, 29305, 1, 36001, 1,
+	31069, 1, 21172, 1, 31192, 1, 30007, 1, 36969, 1, 20778, 1,
+	21360, 1, 27880, 1, 38917, 1, 20241, 1, 20889, 1, 27491, 1,
+	24038, 1, 21491, 1, 21307, 1, 23447, 1, 23398, 1, 30435, 1,
+	20225, 1, 36039, 1, 21332, 1, 22812, 2, 51, 54, 2, 51,
+	55, 2, 51, 56, 2, 51, 57, 2, 52, 48, 2, 52,
+	49, 2, 52, 50, 2, 52, 51, 2, 52, 52, 2, 52,
+	53, 2, 52, 54, 2, 52, 55, 2, 52, 56, 2, 52,
+	57, 2, 53, 48, 2, 49, 26376, 2, 50, 26376, 2, 51,
+	26376, 2, 52, 26376, 2, 53, 26376, 2, 54, 26376, 2, 55,
+	26376, 2, 56, 26376, 2, 57, 26376, 3, 49, 48, 26376, 3,
+	49, 49, 26376, 3, 49, 50, 26376, 2, 72, 103, 3, 101,
+	114, 103, 2, 101, 86, 3, 76, 84, 68, 1, 12450, 1,
+	12452, 1, 12454, 1, 12456, 1, 12458, 1, 12459, 1, 12461, 1,
+	12463, 1, 12465, 1, 12467, 1, 12469, 1, 12471, 1, 12473, 1,
+	12475, 1, 12477, 1, 12479, 1, 12481, 1, 12484, 1, 12486, 1,
+	12488, 1, 12490, 1, 12491, 1, 12492, 1, 12493, 1, 12494, 1,
+	12495, 1, 12498, 1, 12501, 1, 12504, 1, 12507, 1, 12510, 1,
+	12511, 1, 12512, 1, 12513, 1, 12514, 1, 12516, 1, 12518, 1,
+	12520, 1, 12521, 1, 12522, 1, 12523, 1, 12524, 1, 12525, 1,
+	12527, 1, 12528, 1, 12529, 1, 12530, 2, 20196, 21644, 5, 12450,
+	12495, 12442, 12540, 12488, 4, 12450, 12523, 12501, 12449, 5, 12450, 12531,
+	12504, 12442, 12450, 3, 12450, 12540, 12523, 5, 12452, 12491, 12531, 12463,
+	12441, 3, 12452, 12531, 12481, 3, 12454, 12457, 12531, 6, 12456, 12473,
+	12463, 12540, 12488, 12441, 4, 12456, 12540, 12459, 12540, 3, 12458, 12531,
+	12473, 3, 12458, 12540, 12512, 3, 12459, 12452, 12522, 4, 12459, 12521,
+	12483, 12488, 4, 12459, 12525, 12522, 12540, 4, 12459, 12441, 12525, 12531,
+	4, 12459, 12441, 12531, 12510, 4, 12461, 12441, 12459, 12441, 4, 12461,
+	12441, 12491, 12540, 4, 12461, 12517, 12522, 12540, 6, 12461, 12441, 12523,
+	12479, 12441, 12540, 2, 12461, 12525, 6, 12461, 12525, 12463, 12441, 12521,
+	12512, 6, 12461, 12525, 12513, 12540, 12488, 12523, 5, 12461, 12525, 12527,
+	12483, 12488, 4, 12463, 12441, 12521, 12512, 6, 12463, 12441, 12521, 12512,
+	12488, 12531, 6, 12463, 12523, 12475, 12441, 12452, 12525, 4, 12463, 12525,
+	12540, 12493, 3, 12465, 12540, 12473, 3, 12467, 12523, 12490, 4, 12467,
+	12540, 12507, 12442, 4, 12469, 12452, 12463, 12523, 5, 12469, 12531, 12481,
+	12540, 12512, 5, 12471, 12522, 12531, 12463, 12441, 3, 12475, 12531, 12481,
+	3, 12475, 12531, 12488, 4, 12479, 12441, 12540, 12473, 3, 12486, 12441,
+	12471, 3, 12488, 12441, 12523, 2, 12488, 12531, 2, 12490, 12494, 3,
+	12494, 12483, 12488, 3, 12495, 12452, 12484, 6, 12495, 12442, 12540, 12475,
+	12531, 12488, 4, 12495, 12442, 12540, 12484, 5, 12495, 12441, 12540, 12524,
+	12523, 6, 12498, 12442, 12450, 12473, 12488, 12523, 4, 12498, 12442, 12463,
+	12523, 3, 12498, 12442, 12467, 3, 12498, 12441, 12523, 6, 12501, 12449,
+	12521, 12483, 12488, 12441, 4, 12501, 12451, 12540, 12488, 6, 12501, 12441,
+	12483, 12471, 12455, 12523, 3, 12501, 12521, 12531, 5, 12504, 12463, 12479,
+	12540, 12523, 3, 12504, 12442, 12477, 4, 12504, 12442, 12491, 12498, 3,
+	12504, 12523, 12484, 4, 12504, 12442, 12531, 12473, 5, 12504, 12442, 12540,
+	12471, 12441, 4, 12504, 12441, 12540, 12479, 5, 12507, 12442, 12452, 12531,
+	12488, 4, 12507, 12441, 12523, 12488, 2, 12507, 12531, 5, 12507, 12442,
+	12531, 12488, 12441, 3, 12507, 12540, 12523, 3, 12507, 12540, 12531, 4,
+	12510, 12452, 12463, 12525, 3, 12510, 12452, 12523, 3, 12510, 12483, 12495,
+	3, 12510, 12523, 12463, 5, 12510, 12531, 12471, 12519, 12531, 4, 12511,
+	12463, 12525, 12531, 2, 12511, 12522, 6, 12511, 12522, 12495, 12441, 12540,
+	12523, 3, 12513, 12459, 12441, 5, 12513, 12459, 12441, 12488, 12531, 4,
+	12513, 12540, 12488, 12523, 4, 12516, 12540, 12488, 12441, 3, 12516, 12540,
+	12523, 3, 12518, 12450, 12531, 4, 12522, 12483, 12488, 12523, 2, 12522,
+	12521, 4, 12523, 12498, 12442, 12540, 5, 12523, 12540, 12501, 12441, 12523,
+	2, 12524, 12512, 6, 12524, 12531, 12488, 12465, 12441, 12531, 3, 12527,
+	12483, 12488, 2, 48, 28857, 2, 49, 28857, 2, 50, 28857, 2,
+	51, 28857, 2, 52, 28857, 2, 53, 28857, 2, 54, 28857, 2,
+	55, 28857, 2, 56, 28857, 2, 57, 28857, 3, 49, 48, 28857,
+	3, 49, 49, 28857, 3, 49, 50, 28857, 3, 49, 51, 28857,
+	3, 49, 52, 28857, 3, 49, 53, 28857, 3, 49, 54, 28857,
+	3, 49, 55, 28857, 3, 49, 56, 28857, 3, 49, 57, 28857,
+	3, 50, 48, 28857, 3, 50, 49, 28857, 3, 50, 50, 28857,
+	3, 50, 51, 28857, 3, 50, 52, 28857, 3, 104, 80, 97,
+	2, 100, 97, 2, 65, 85, 3, 98, 97, 114, 2, 111,
+	86, 2, 112, 99, 2, 100, 109, 3, 100, 109, 50, 3,
+	100, 109, 51, 2, 73, 85, 2, 24179, 25104, 2, 26157, 21644,
+	2, 22823, 27491, 2, 26126, 27835, 4, 26666, 24335, 20250, 31038, 2,
+	112, 65, 2, 110, 65, 2, 956, 65, 2, 109, 65, 2,
+	107, 65, 2, 75, 66, 2, 77, 66, 2, 71, 66, 3,
+	99, 97, 108, 4, 107, 99, 97, 108, 2, 112, 70, 2,
+	110, 70, 2, 956, 70, 2, 956, 103, 2, 109, 103, 2,
+	107, 103, 2, 72, 122, 3, 107, 72, 122, 3, 77, 72,
+	122, 3, 71, 72, 122, 3, 84, 72, 122, 2, 956, 108,
+	2, 109, 108, 2, 100, 108, 2, 107, 108, 2, 102, 109,
+	2, 110, 109, 2, 956, 109, 2, 109, 109, 2, 99, 109,
+	2, 107, 109, 3, 109, 109, 50, 3, 99, 109, 50, 2,
+	109, 50, 3, 107, 109, 50, 3, 109, 109, 51, 3, 99,
+	109, 51, 2, 109, 51, 3, 107, 109, 51, 3, 109, 8725,
+	115, 4, 109, 8725, 115, 50, 2, 80, 97, 3, 107, 80,
+	97, 3, 77, 80, 97, 3, 71, 80, 97, 3, 114, 97,
+	100, 5, 114, 97, 100, 8725, 115, 6, 114, 97, 100, 8725,
+	115, 50, 2, 112, 115, 2, 110, 115, 2, 956, 115, 2,
+	109, 115, 2, 112, 86, 2, 110, 86, 2, 956, 86, 2,
+	109, 86, 2, 107, 86, 2, 77, 86, 2, 112, 87, 2,
+	110, 87, 2, 956, 87, 2, 109, 87, 2, 107, 87, 2,
+	77, 87, 2, 107, 937, 2, 77, 937, 4, 97, 46, 109,
+	46, 2, 66, 113, 2, 99, 99, 2, 99, 100, 4, 67,
+	8725, 107, 103, 3, 67, 111, 46, 2, 100, 66, 2, 71,
+	121, 2, 104, 97, 2, 72, 80, 2, 105, 110, 2, 75,
+	75, 2, 75, 77, 2, 107, 116, 2, 108, 109, 2, 108,
+	110, 3, 108, 111, 103, 2, 108, 120, 2, 109, 98, 3,
+	109, 105, 108, 3, 109, 111, 108, 2, 80, 72, 4, 112,
+	46, 109, 46, 3, 80, 80, 77, 2, 80, 82, 2, 115,
+	114, 2, 83, 118, 2, 87, 98, 3, 86, 8725, 109, 3,
+	65, 8725, 109, 2, 49, 26085, 2, 50, 26085, 2, 51, 26085,
+	2, 52, 26085, 2, 53, 26085, 2, 54, 26085, 2, 55, 26085,
+	2, 56, 26085, 2, 57, 26085, 3, 49, 48, 26085, 3, 49,
+	49, 26085, 3, 49, 50, 26085, 3, 49, 51, 26085, 3, 49,
+	52, 26085, 3, 49, 53, 26085, 3, 49, 54, 26085, 3, 49,
+	55, 26085, 3, 49, 56, 26085, 3, 49, 57, 26085, 3, 50,
+	48, 26085, 3, 50, 49, 26085, 3, 50, 50, 26085, 3, 50,
+	51, 26085, 3, 50, 52, 26085, 3, 50, 53, 26085, 3, 50,
+	54, 26085, 3, 50, 55, 26085, 3, 50, 56, 26085, 3, 50,
+	57, 26085, 3, 51, 48, 26085, 3, 51, 49, 26085, 3, 103,
+	97, 108, 1, 1098, 1, 1100, 1, 42863, 1, 294, 1, 339,
+	1, 42791, 1, 43831, 1, 619, 1, 43858, 1, 653, 1, 35912,
+	1, 26356, 1, 36040, 1, 28369, 1, 20018, 1, 21477, 1, 22865,
+	1, 21895, 1, 22856, 1, 25078, 1, 30313, 1, 32645, 1, 34367,
+	1, 34746, 1, 35064, 1, 37007, 1, 27138, 1, 27931, 1, 28889,
+	1, 29662, 1, 33853, 1, 37226, 1, 39409, 1, 20098, 1, 21365,
+	1, 27396, 1, 29211, 1, 34349, 1, 40478, 1, 23888, 1, 28651,
+	1, 34253, 1, 35172, 1, 25289, 1, 33240, 1, 34847, 1, 24266,
+	1, 26391, 1, 28010, 1, 29436, 1, 37070, 1, 20358, 1, 20919,
+	1, 21214, 1, 25796, 1, 27347, 1, 29200, 1, 30439, 1, 34310,
+	1, 34396, 1, 36335, 1, 38706, 1, 39791, 1, 40442, 1, 30860,
+	1, 31103, 1, 32160, 1, 33737, 1, 37636, 1, 35542, 1, 22751,
+	1, 24324, 1, 31840, 1, 32894, 1, 29282, 1, 30922, 1, 36034,
+	1, 38647, 1, 22744, 1, 23650, 1, 27155, 1, 28122, 1, 28431,
+	1, 32047, 1, 32311, 1, 38475, 1, 21202, 1, 32907, 1, 20956,
+	1, 20940, 1, 31260, 1, 32190, 1, 33777, 1, 38517, 1, 35712,
+	1, 25295, 1, 35582, 1, 20025, 1, 23527, 1, 24594, 1, 29575,
+	1, 30064, 1, 21271, 1, 30971, 1, 20415, 1, 24489, 1, 19981,
+	1, 27852, 1, 25976, 1, 32034, 1, 21443, 1, 22622, 1, 30465,
+	1, 33865, 1, 35498, 1, 27578, 1, 27784, 1, 25342, 1, 33509,
+	1, 25504, 1, 30053, 1, 20142, 1, 20841, 1, 20937, 1, 26753,
+	1, 31975, 1, 33391, 1, 35538, 1, 37327, 1, 21237, 1, 21570,
+	1, 24300, 1, 26053, 1, 28670, 1, 31018, 1, 38317, 1, 39530,
+	1, 40599, 1, 40654, 1, 26310, 1, 27511, 1, 36706, 1, 24180,
+	1, 24976, 1, 25088, 1, 25754, 1, 28451, 1, 29001, 1, 29833,
+	1, 31178, 1, 32244, 1, 32879, 1, 36646, 1, 34030, 1, 36899,
+	1, 37706, 1, 21015, 1, 21155, 1, 21693, 1, 28872, 1, 35010,
+	1, 24265, 1, 24565, 1, 25467, 1, 27566, 1, 31806, 1, 29557,
+	1, 20196, 1, 22265, 1, 23994, 1, 24604, 1, 29618, 1, 29801,
+	1, 32666, 1, 32838, 1, 37428, 1, 38646, 1, 38728, 1, 38936,
+	1, 20363, 1, 31150, 1, 37300, 1, 38584, 1, 24801, 1, 20102,
+	1, 20698, 1, 23534, 1, 23615, 1, 26009, 1, 29134, 1, 30274,
+	1, 34044, 1, 36988, 1, 26248, 1, 38446, 1, 21129, 1, 26491,
+	1, 26611, 1, 27969, 1, 28316, 1, 29705, 1, 30041, 1, 30827,
+	1, 32016, 1, 39006, 1, 25134, 1, 38520, 1, 20523, 1, 23833,
+	1, 28138, 1, 36650, 1, 24459, 1, 24900, 1, 26647, 1, 38534,
+	1, 21033, 1, 21519, 1, 23653, 1, 26131, 1, 26446, 1, 26792,
+	1, 27877, 1, 29702, 1, 30178, 1, 32633, 1, 35023, 1, 35041,
+	1, 38626, 1, 21311, 1, 28346, 1, 21533, 1, 29136, 1, 29848,
+	1, 34298, 1, 38563, 1, 40023, 1, 40607, 1, 26519, 1, 28107,
+	1, 33256, 1, 31520, 1, 31890, 1, 29376, 1, 28825, 1, 35672,
+	1, 20160, 1, 33590, 1, 21050, 1, 20999, 1, 24230, 1, 25299,
+	1, 31958, 1, 23429, 1, 27934, 1, 26292, 1, 36667, 1, 38477,
+	1, 24275, 1, 20800, 1, 21952, 1, 22618, 1, 26228, 1, 20958,
+	1, 29482, 1, 30410, 1, 31036, 1, 31070, 1, 31077, 1, 31119,
+	1, 38742, 1, 31934, 1, 34322, 1, 35576, 1, 36920, 1, 37117,
+	1, 39151, 1, 39164, 1, 39208, 1, 40372, 1, 37086, 1, 38583,
+	1, 20398, 1, 20711, 1, 20813, 1, 21193, 1, 21220, 1, 21329,
+	1, 21917, 1, 22022, 1, 22120, 1, 22592, 1, 22696, 1, 23652,
+	1, 24724, 1, 24936, 1, 24974, 1, 25074, 1, 25935, 1, 26082,
+	1, 26257, 1, 26757, 1, 28023, 1, 28186, 1, 28450, 1, 29038,
+	1, 29227, 1, 29730, 1, 30865, 1, 31049, 1, 31048, 1, 31056,
+	1, 31062, 1, 31117, 1, 31118, 1, 31296, 1, 31361, 1, 31680,
+	1, 32265, 1, 32321, 1, 32626, 1, 32773, 1, 33261, 1, 33401,
+	1, 33879, 1, 35088, 1, 35222, 1, 35585, 1, 35641, 1, 36051,
+	1, 36104, 1, 36790, 1, 38627, 1, 38911, 1, 38971, 1, 24693,
+	1, 148206, 1, 33304, 1, 20006, 1, 20917, 1, 20840, 1, 20352,
+	1, 20805, 1, 20864, 1, 21191, 1, 21242, 1, 21845, 1, 21913,
+	1, 21986, 1, 22707, 1, 22852, 1, 22868, 1, 23138, 1, 23336,
+	1, 24274, 1, 24281, 1, 24425, 1, 24493, 1, 24792, 1, 24910,
+	1, 24840, 1, 24928, 1, 25140, 1, 25540, 1, 25628, 1, 25682,
+	1, 25942, 1, 26395, 1, 26454, 1, 28379, 1, 28363, 1, 28702,
+	1, 30631, 1, 29237, 1, 29359, 1, 29809, 1, 29958, 1, 30011,
+	1, 30237, 1, 30239, 1, 30427, 1, 30452, 1, 30538, 1, 30528,
+	1, 30924, 1, 31409, 1, 31867, 1, 32091, 1, 32574, 1, 33618,
+	1, 33775, 1, 34681, 1, 35137, 1, 35206, 1, 35519, 1, 35531,
+	1, 35565, 1, 35722, 1, 36664, 1, 36978, 1, 37273, 1, 37494,
+	1, 38524, 1, 38875, 1, 38923, 1, 39698, 1, 141386, 1, 141380,
+	1, 144341, 1, 15261, 1, 16408, 1, 16441, 1, 152137, 1, 154832,
+	1, 163539, 1, 40771, 1, 40846, 2, 102, 102, 2, 102, 105,
+	2, 102, 108, 3, 102, 102, 105, 3, 102, 102, 108, 2,
+	115, 116, 2, 1396, 1398, 2, 1396, 1381, 2, 1396, 1387, 2,
+	1406, 1398, 2, 1396, 1389, 2, 1497, 1460, 2, 1522, 1463, 1,
+	1506, 1, 1492, 1, 1499, 1, 1500, 1, 1501, 1, 1512, 1,
+	1514, 2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468, 1473, 3,
+	1513, 1468, 1474, 2, 1488, 1463, 2, 1488, 1464, 2, 1488, 1468,
+	2, 1489, 1468, 2, 1490, 1468, 2, 1491, 1468, 2, 1492, 1468,
+	2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468, 2, 1497, 1468,
+	2, 1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502, 1468,
+	2, 1504, 1468, 2, 1505, 1468, 2, 1507, 1468, 2, 1508, 1468,
+	2, 1510, 1468, 2, 1511, 1468, 2, 1512, 1468, 2, 1513, 1468,
+	2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471, 2, 1499, 1471,
+	2, 1508, 1471, 2, 1488, 1500, 1, 1649, 1, 1659, 1, 1662,
+	1, 1664, 1, 1658, 1, 1663, 1, 1657, 1, 1700, 1, 1702,
+	1, 1668, 1, 1667, 1, 1670, 1, 1671, 1, 1677, 1, 1676,
+	1, 1678, 1, 1672, 1, 1688, 1, 1681, 1, 1705, 1, 1711,
+	1, 1715, 1, 1713, 1, 1722, 1, 1723, 1, 1729, 1, 1726,
+	1, 1746, 1, 1709, 1, 1735, 1, 1734, 1, 1736, 1, 1739,
+	1, 1733, 1, 1737, 1, 1744, 1, 1609, 3, 1610, 1620, 1575,
+	3, 1610, 1620, 1749, 3, 1610, 1620, 1608, 3, 1610, 1620, 1735,
+	3, 1610, 1620, 1734, 3, 1610, 1620, 1736, 3, 1610, 1620, 1744,
+	3, 1610, 1620, 1609, 1, 1740, 3, 1610, 1620, 1580, 3, 1610,
+	1620, 1581, 3, 1610, 1620, 1605, 3, 1610, 1620, 1610, 2, 1576,
+	1580, 2, 1576, 1581, 2, 1576, 1582, 2, 1576, 1605, 2, 1576,
+	1609, 2, 1576, 1610, 2, 1578, 1580, 2, 1578, 1581, 2, 1578,
+	1582, 2, 1578, 1605, 2, 1578, 1609, 2, 1578, 1610, 2, 1579,
+	1580, 2, 1579, 1605, 2, 1579, 1609, 2, 1579, 1610, 2, 1580,
+	1581, 2, 1580, 1605, 2, 1581, 1580, 2, 1581, 1605, 2, 1582,
+	1580, 2, 1582, 1581, 2, 1582, 1605, 2, 1587, 1580, 2, 1587,
+	1581, 2, 1587, 1582, 2, 1587, 1605, 2, 1589, 1581, 2, 1589,
+	1605, 2, 1590, 1580, 2, 1590, 1581, 2, 1590, 1582, 2, 1590,
+	1605, 2, 1591, 1581, 2, 1591, 1605, 2, 1592, 1605, 2, 1593,
+	1580, 2, 1593, 1605, 2, 1594, 1580, 2, 1594, 1605, 2, 1601,
+	1580, 2, 1601, 1581, 2, 1601, 1582, 2, 1601, 1605, 2, 1601,
+	1609, 2, 1601, 1610, 2, 1602, 1581, 2, 1602, 1605, 2, 1602,
+	1609, 2, 1602, 1610, 2, 1603, 1575, 2, 1603, 1580, 2, 1603,
+	1581, 2, 1603, 1582, 2, 1603, 1604, 2, 1603, 1605, 2, 1603,
+	1609, 2, 1603, 1610, 2, 1604, 1580, 2, 1604, 1581, 2, 1604,
+	1582, 2, 1604, 1605, 2, 1604, 1609, 2, 1604, 1610, 2, 1605,
+	1580, 2, 1605, 1581, 2, 1605, 1582, 2, 1605, 1605, 2, 1605,
+	1609, 2, 1605, 1610, 2, 1606, 1580, 2, 1606, 1581, 2, 1606,
+	1582, 2, 1606, 1605, 2, 1606, 1609, 2, 1606, 1610, 2, 1607,
+	1580, 2, 1607, 1605, 2, 1607, 1609, 2, 1607, 1610, 2, 1610,
+	1580, 2, 1610, 1581, 2, 1610, 1582, 2, 1610, 1605, 2, 1610,
+	1609, 2, 1610, 1610, 2, 1584, 1648, 2, 1585, 1648, 2, 1609,
+	1648, 3, 32, 1612, 1617, 3, 32, 1613, 1617, 3, 32, 1614,
+	1617, 3, 32, 1615, 1617, 3, 32, 1616, 1617, 3, 32, 1617,
+	1648, 3, 1610, 1620, 1585, 3, 1610, 1620, 1586, 3, 1610, 1620,
+	1606, 2, 1576, 1585, 2, 1576, 1586, 2, 1576, 1606, 2, 1578,
+	1585, 2, 1578, 1586, 2, 1578, 1606, 2, 1579, 1585, 2, 1579,
+	1586, 2, 1579, 1606, 2, 1605, 1575, 2, 1606, 1585, 2, 1606,
+	1586, 2, 1606, 1606, 2, 1610, 1585, 2, 1610, 1586, 2, 1610,
+	1606, 3, 1610, 1620, 1582, 3, 1610, 1620, 1607, 2, 1576, 1607,
+	2, 1578, 1607, 2, 1589, 1582, 2, 1604, 1607, 2, 1606, 1607,
+	2, 1607, 1648, 2, 1610, 1607, 2, 1579, 1607, 2, 1587, 1607,
+	2, 1588, 1605, 2, 1588, 1607, 3, 1600, 1614, 1617, 3, 1600,
+	1615, 1617, 3, 1600, 1616, 1617, 2, 1591, 1609, 2, 1591, 1610,
+	2, 1593, 1609, 2, 1593, 1610, 2, 1594, 1609, 2, 1594, 1610,
+	2, 1587, 1609, 2, 1587, 1610, 2, 1588, 1609, 2, 1588, 1610,
+	2, 1581, 1609, 2, 1581, 1610, 2, 1580, 1609, 2, 1580, 1610,
+	2, 1582, 1609, 2, 1582, 1610, 2, 1589, 1609, 2, 1589, 1610,
+	2, 1590, 1609, 2, 1590, 1610, 2, 1588, 1580, 2, 1588, 1581,
+	2, 1588, 1582, 2, 1588, 1585, 2, 1587, 1585, 2, 1589, 1585,
+	2, 1590, 1585, 2, 1575, 1611, 3, 1578, 1580, 1605, 3, 1578,
+	1581, 1580, 3, 1578, 1581, 1605, 3, 1578, 1582, 1605, 3, 1578,
+	1605, 1580, 3, 1578, 1605, 1581, 3, 1578, 1605, 1582, 3, 1580,
+	1605, 1581, 3, 1581, 1605, 1610, 3, 1581, 1605, 1609, 3, 1587,
+	1581, 1580, 3, 1587, 1580, 1581, 3, 1587, 1580, 1609, 3, 1587,
+	1605, 1581, 3, 1587, 1605, 1580, 3, 1587, 1605, 1605, 3, 1589,
+	1581, 1581, 3, 1589, 1605, 1605, 3, 1588, 1581, 1605, 3, 1588,
+	1580, 1610, 3, 1588, 1605, 1582, 3, 1588, 1605, 1605, 3, 1590,
+	1581, 1609, 3, 1590, 1582, 1605, 3, 1591, 1605, 1581, 3, 1591,
+	1605, 1605, 3, 1591, 1605, 1610, 3, 1593, 1580, 1605, 3, 1593,
+	1605, 1605, 3, 1593, 1605, 1609, 3, 1594, 1605, 1605, 3, 1594,
+	1605, 1610, 3, 1594, 1605, 1609, 3, 1601, 1582, 1605, 3, 1602,
+	1605, 1581, 3, 1602, 1605, 1605, 3, 1604, 1581, 1605, 3, 1604,
+	1581, 1610, 3, 1604, 1581, 1609, 3, 1604, 1580, 1580, 3, 1604,
+	1582, 1605, 3, 1604, 1605, 1581, 3, 1605, 1581, 1580, 3, 1605,
+	1581, 1605, 3, 1605, 1581, 1610, 3, 1605, 1580, 1581, 3, 1605,
+	1580, 1605, 3, 1605, 1582, 1580, 3, 1605, 1582, 1605, 3, 1605,
+	1580, 1582, 3, 1607, 1605, 1580, 3, 1607, 1605, 1605, 3, 1606,
+	1581, 1605, 3, 1606, 1581, 1609, 3, 1606, 1580, 1605, 3, 1606,
+	1580, 1609, 3, 1606, 1605, 1610, 3, 1606, 1605, 1609, 3, 1610,
+	1605, 1605, 3, 1576, 1582, 1610, 3, 1578, 1580, 1610, 3, 1578,
+	1580, 1609, 3, 1578, 1582, 1610, 3, 1578, 1582, 1609, 3, 1578,
+	1605, 1610, 3, 1578, 1605, 1609, 3, 1580, 1605, 1610, 3, 1580,
+	1581, 1609, 3, 1580, 1605, 1609, 3, 1587, 1582, 1609, 3, 1589,
+	1581, 1610, 3, 1588, 1581, 1610, 3, 1590, 1581, 1610, 3, 1604,
+	1580, 1610, 3, 1604, 1605, 1610, 3, 1610, 1581, 1610, 3, 1610,
+	1580, 1610, 3, 1610, 1605, 1610, 3, 1605, 1605, 1610, 3, 1602,
+	1605, 1610, 3, 1606, 1581, 1610, 3, 1593, 1605, 1610, 3, 1603,
+	1605, 1610, 3, 1606, 1580, 1581, 3, 1605, 1582, 1610, 3, 1604,
+	1580, 1605, 3, 1603, 1605, 1605, 3, 1580, 1581, 1610, 3, 1581,
+	1580, 1610, 3, 1605, 1580, 1610, 3, 1601, 1605, 1610, 3, 1576,
+	1581, 1610, 3, 1587, 1582, 1610, 3, 1606, 1580, 1610, 3, 1589,
+	1604, 1746, 3, 1602, 1604, 1746, 4, 1575, 1604, 1604, 1607, 4,
+	1575, 1603, 1576, 1585, 4, 1605, 1581, 1605, 1583, 4, 1589, 1604,
+	1593, 1605, 4, 1585, 1587, 1608, 1604, 4, 1593, 1604, 1610, 1607,
+	4, 1608, 1587, 1604, 1605, 3, 1589, 1604, 1609, 18, 1589, 1604,
+	1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32,
+	1608, 1587, 1604, 1605, 8, 1580, 1604, 32, 1580, 1604, 1575, 1604,
+	1607, 4, 1585, 1740, 1575, 1604, 1, 44, 1, 12289, 1, 12290,
+	1, 58, 1, 33, 1, 63, 1, 12310, 1, 12311, 1, 8212,
+	1, 8211, 1, 95, 1, 123, 1, 125, 1, 12308, 1, 12309,
+	1, 12304, 1, 12305, 1, 12298, 1, 12299, 1, 12300, 1, 12301,
+	1, 12302, 1, 12303, 1, 91, 1, 93, 1, 35, 1, 38,
+	1, 42, 1, 45, 1, 60, 1, 62, 1, 92, 1, 36,
+	1, 37, 1, 64, 2, 32, 1611, 2, 1600, 1611, 2, 32,
+	1612, 2, 32, 1613, 2, 32, 1614, 2, 1600, 1614, 2, 32,
+	1615, 2, 1600, 1615, 2, 32, 1616, 2, 1600, 1616, 2, 32,
+	1617, 2, 1600, 1617, 2, 32, 1618, 2, 1600, 1618, 1, 1569,
+	1, 1575, 1, 1576, 1, 1577, 1, 1578, 1, 1579, 1, 1580,
+	1, 1581, 1, 1582, 1, 1583, 1, 1584, 1, 1585, 1, 1586,
+	1, 1587, 1, 1588, 1, 1589, 1, 1590, 1, 1591, 1, 1592,
+	1, 1593, 1, 1594, 1, 1601, 1, 1602, 1, 1603, 1, 1604,
+	1, 1605, 1, 1606, 1, 1607, 1, 1608, 1, 1610, 3, 1604,
+	1575, 1619, 3, 1604, 1575, 1620, 3, 1604, 1575, 1621, 2, 1604,
+	1575, 1, 34, 1, 39, 1, 47, 1, 94, 1, 124, 1,
+	126, 1, 10629, 1, 10630, 1, 12539, 1, 12449, 1, 12451, 1,
+	12453, 1, 12455, 1, 12457, 1, 12515, 1, 12517, 1, 12519, 1,
+	12483, 1, 12540, 1, 12531, 1, 12441, 1, 12442, 1, 162, 1,
+	163, 1, 172, 1, 166, 1, 165, 1, 8361, 1, 9474, 1,
+	8592, 1, 8593, 1, 8594, 1, 8595, 1, 9632, 1, 9675, 1,
+	720, 1, 721, 1, 230, 1, 665, 1, 595, 1, 675, 1,
+	43878, 1, 677, 1, 676, 1, 598, 1, 599, 1, 7569, 1,
+	600, 1, 606, 1, 681, 1, 612, 1, 610, 1, 608, 1,
+	667, 1, 668, 1, 615, 1, 644, 1, 682, 1, 683, 1,
+	620, 1, 122628, 1, 42894, 1, 622, 1, 122629, 1, 654, 1,
+	122630, 1, 248, 1, 630, 1, 631, 1, 634, 1, 122632, 1,
+	637, 1, 638, 1, 640, 1, 680, 1, 678, 1, 43879, 1,
+	679, 1, 648, 1, 11377, 1, 655, 1, 673, 1, 674, 1,
+	664, 1, 448, 1, 449, 1, 450, 1, 122634, 1, 122654, 2,
+	69785, 69818, 2, 69787, 69818, 2, 69797, 69818, 2, 69937, 69927, 2,
+	69938, 69927, 2, 70471, 70462, 2, 70471, 70487, 2, 70841, 70842, 2,
+	70841, 70832, 2, 70841, 70845, 2, 71096, 71087, 2, 71097, 71087, 2,
+	71989, 71984, 2, 119127, 119141, 2, 119128, 119141, 3, 119128, 119141, 119150,
+	3, 119128, 119141, 119151, 3, 119128, 119141, 119152, 3, 119128, 119141, 119153,
+	3, 119128, 119141, 119154, 2, 119225, 119141, 2, 119226, 119141, 3, 119225,
+	119141, 119150, 3, 119226, 119141, 119150, 3, 119225, 119141, 119151, 3, 119226,
+	119141, 119151, 1, 305, 1, 567, 1, 913, 1, 914, 1, 916,
+	1, 917, 1, 918, 1, 919, 1, 921, 1, 922, 1, 923,
+	1, 924, 1, 925, 1, 926, 1, 927, 1, 929, 1, 932,
+	1, 934, 1, 935, 1, 936, 1, 8711, 1, 945, 1, 950,
+	1, 951, 1, 955, 1, 957, 1, 958, 1, 959, 1, 963,
+	1, 964, 1, 965, 1, 968, 1, 969, 1, 8706, 1, 988,
+	1, 989, 1, 1646, 1, 1697, 1, 1647, 2, 48, 46, 2,
+	48, 44, 2, 49, 44, 2, 50, 44, 2, 51, 44, 2,
+	52, 44, 2, 53, 44, 2, 54, 44, 2, 55, 44, 2,
+	56, 44, 2, 57, 44, 3, 40, 65, 41, 3, 40, 66,
+	41, 3, 40, 67, 41, 3, 40, 68, 41, 3, 40, 69,
+	41, 3, 40, 70, 41, 3, 40, 71, 41, 3, 40, 72,
+	41, 3, 40, 73, 41, 3, 40, 74, 41, 3, 40, 75,
+	41, 3, 40, 76, 41, 3, 40, 77, 41, 3, 40, 78,
+	41, 3, 40, 79, 41, 3, 40, 80, 41, 3, 40, 81,
+	41, 3, 40, 82, 41, 3, 40, 83, 41, 3, 40, 84,
+	41, 3, 40, 85, 41, 3, 40, 86, 41, 3, 40, 87,
+	41, 3, 40, 88, 41, 3, 40, 89, 41, 3, 40, 90,
+	41, 3, 12308, 83, 12309, 2, 67, 68, 2, 87, 90, 2,
+	72, 86, 2, 83, 68, 2, 83, 83, 3, 80, 80, 86,
+	2, 87, 67, 2, 77, 67, 2, 77, 68, 2, 77, 82,
+	2, 68, 74, 2, 12411, 12363, 2, 12467, 12467, 1, 23383, 1,
+	21452, 1, 22810, 1, 35299, 1, 20132, 1, 26144, 1, 28961, 1,
+	21069, 1, 24460, 1, 20877, 1, 26032, 1, 21021, 1, 32066, 1,
+	36009, 1, 22768, 1, 21561, 1, 28436, 1, 25237, 1, 25429, 1,
+	36938, 1, 25351, 1, 25171, 1, 31105, 1, 31354, 1, 21512, 1,
+	28288, 1, 30003, 1, 21106, 1, 21942, 1, 37197, 3, 12308, 26412,
+	12309, 3, 12308, 19977, 12309, 3, 12308, 20108, 12309, 3, 12308, 23433,
+	12309, 3, 12308, 28857, 12309, 3, 12308, 25171, 12309, 3, 12308, 30423,
+	12309, 3, 12308, 21213, 12309, 3, 12308, 25943, 12309, 1, 24471, 1,
+	21487, 1, 20029, 1, 20024, 1, 20033, 1, 131362, 1, 20320, 1,
+	20411, 1, 20482, 1, 20602, 1, 20633, 1, 20687, 1, 13470, 1,
+	132666, 1, 20820, 1, 20836, 1, 20855, 1, 132380, 1, 13497, 1,
+	20839, 1, 132427, 1, 20887, 1, 20900, 1, 20172, 1, 20908, 1,
+	168415, 1, 20995, 1, 13535, 1, 21051, 1, 21062, 1, 21111, 1,
+	13589, 1, 21253, 1, 21254, 1, 21321, 1, 21338, 1, 21363, 1,
+	21373, 1, 21375, 1, 133676, 1, 28784, 1, 21450, 1, 21471, 1,
+	133987, 1, 21483, 1, 21489, 1, 21510, 1, 21662, 1, 21560, 1,
+	21576, 1, 21608, 1, 21666, 1, 21750, 1, 21776, 1, 21843, 1,
+	21859, 1, 21892, 1, 21931, 1, 21939, 1, 21954, 1, 22294, 1,
+	22295, 1, 22097, 1, 22132, 1, 22766, 1, 22478, 1, 22516, 1,
+	22541, 1, 22411, 1, 22578, 1, 22577, 1, 22700, 1, 136420, 1,
+	22770, 1, 22775, 1, 22790, 1, 22818, 1, 22882, 1, 136872, 1,
+	136938, 1, 23020, 1, 23067, 1, 23079, 1, 23000, 1, 23142, 1,
+	14062, 1, 14076, 1, 23304, 1, 23358, 1, 137672, 1, 23491, 1,
+	23512, 1, 23539, 1, 138008, 1, 23551, 1, 23558, 1, 24403, 1,
+	14209, 1, 23648, 1, 23744, 1, 23693, 1, 138724, 1, 23875, 1,
+	138726, 1, 23918, 1, 23915, 1, 23932, 1, 24033, 1, 24034, 1,
+	14383, 1, 24061, 1, 24104, 1, 24125, 1, 24169, 1, 14434, 1,
+	139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1, 172946, 1,
+	140081, 1, 33281, 1, 24354, 1, 14535, 1, 144056, 1, 156122, 1,
+	24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1,
+	24569, 1, 24705, 1, 14650, 1, 14620, 1, 141012, 1, 24775, 1,
+	24904, 1, 24908, 1, 24954, 1, 25010, 1, 24996, 1, 25007, 1,
+	25054, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1,
+	25424, 1, 142092, 1, 25405, 1, 25340, 1, 25448, 1, 25475, 1,
+	25572, 1, 142321, 1, 25634, 1, 25541, 1, 25513, 1, 14894, 1,
+	25705, 1, 25726, 1, 25757, 1, 25719, 1, 14956, 1, 25964, 1,
+	143370, 1, 26083, 1, 26360, 1, 26185, 1, 15129, 1, 15112, 1,
+	15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1, 32941, 1,
+	17369, 1, 26401, 1, 26462, 1, 26451, 1, 144323, 1, 15177, 1,
+	26618, 1, 26501, 1, 26706, 1, 144493, 1, 26766, 1, 26655, 1,
+	26900, 1, 26946, 1, 27043, 1, 27114, 1, 27304, 1, 145059, 1,
+	27355, 1, 15384, 1, 27425, 1, 145575, 1, 27476, 1, 15438, 1,
+	27506, 1, 27551, 1, 27579, 1, 146061, 1, 138507, 1, 146170, 1,
+	27726, 1, 146620, 1, 27839, 1, 27853, 1, 27751, 1, 27926, 1,
+	27966, 1, 28009, 1, 28024, 1, 28037, 1, 146718, 1, 27956, 1,
+	28207, 1, 28270, 1, 15667, 1, 28359, 1, 147153, 1, 28153, 1,
+	28526, 1, 147294, 1, 147342, 1, 28614, 1, 28729, 1, 28699, 1,
+	15766, 1, 28746, 1, 28797, 1, 28791, 1, 28845, 1, 132389, 1,
+	28997, 1, 148067, 1, 29084, 1, 148395, 1, 29224, 1, 29264, 1,
+	149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524, 1, 29562, 1,
+	29579, 1, 16044, 1, 29605, 1, 16056, 1, 29767, 1, 29788, 1,
+	29829, 1, 29898, 1, 16155, 1, 29988, 1, 150582, 1, 30014, 1,
+	150674, 1, 139679, 1, 30224, 1, 151457, 1, 151480, 1, 151620, 1,
+	16380, 1, 16392, 1, 151795, 1, 151794, 1, 151833, 1, 151859, 1,
+	30494, 1, 30495, 1, 30603, 1, 16454, 1, 16534, 1, 152605, 1,
+	30798, 1, 16611, 1, 153126, 1, 153242, 1, 153285, 1, 31211, 1,
+	16687, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 31470, 1,
+	16898, 1, 154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1,
+	31954, 1, 17056, 1, 31976, 1, 31971, 1, 32000, 1, 155526, 1,
+	32099, 1, 17153, 1, 32199, 1, 32258, 1, 32325, 1, 17204, 1,
+	156200, 1, 156231, 1, 17241, 1, 156377, 1, 32634, 1, 156478, 1,
+	32661, 1, 32762, 1, 156890, 1, 156963, 1, 32864, 1, 157096, 1,
+	32880, 1, 144223, 1, 17365, 1, 32946, 1, 33027, 1, 17419, 1,
+	33086, 1, 23221, 1, 157607, 1, 157621, 1, 144275, 1, 144284, 1,
+	33284, 1, 36766, 1, 17515, 1, 33425, 1, 33419, 1, 33437, 1,
+	21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524, 1,
+	33565, 1, 33635, 1, 33709, 1, 33571, 1, 33725, 1, 33767, 1,
+	33619, 1, 33738, 1, 33740, 1, 33756, 1, 158774, 1, 159083, 1,
+	158933, 1, 17707, 1, 34033, 1, 34035, 1, 34070, 1, 160714, 1,
+	34148, 1, 159532, 1, 17757, 1, 17761, 1, 159665, 1, 159954, 1,
+	17771, 1, 34384, 1, 34407, 1, 34409, 1, 34473, 1, 34440, 1,
+	34574, 1, 34530, 1, 34600, 1, 34667, 1, 34694, 1, 17879, 1,
+	34785, 1, 34817, 1, 17913, 1, 34912, 1, 161383, 1, 35031, 1,
+	35038, 1, 17973, 1, 35066, 1, 13499, 1, 161966, 1, 162150, 1,
+	18110, 1, 18119, 1, 35488, 1, 162984, 1, 36011, 1, 36033, 1,
+	36123, 1, 36215, 1, 163631, 1, 133124, 1, 36299, 1, 36284, 1,
+	36336, 1, 133342, 1, 36564, 1, 165330, 1, 165357, 1, 37012, 1,
+	37105, 1, 37137, 1, 165678, 1, 37147, 1, 37432, 1, 37591, 1,
+	37592, 1, 37500, 1, 37881, 1, 37909, 1, 166906, 1, 38283, 1,
+	18837, 1, 38327, 1, 167287, 1, 18918, 1, 38595, 1, 23986, 1,
+	38691, 1, 168261, 1, 168474, 1, 19054, 1, 19062, 1, 38880, 1,
+	168970, 1, 19122, 1, 169110, 1, 38953, 1, 169398, 1, 39138, 1,
+	19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422, 1, 19406, 1,
+	170800, 1, 40000, 1, 40189, 1, 19662, 1, 19693, 1, 40295, 1,
+	172238, 1, 19704, 1, 172293, 1, 172558, 1, 172689, 1, 19798, 1,
+	40702, 1, 40709, 1, 40719, 1, 40726, 1, 173568,
+};
+
+/* Canonical compositions as { first, second, composite }, sorted by first
+ * and then by second (without Hangul syllables). */
+
+static const uint32_t normPairs[941][3] = {
+	{ 0x3c, 0x338, 0x226e },
+	{ 0x3d, 0x338, 0x2260 },
+	{ 0x3e, 0x338, 0x226f },
+	{ 0x41, 0x300, 0xc0 },
+	{ 0x41, 0x301, 0xc1 },
+	{ 0x41, 0x302, 0xc2 },
+	{ 0x41, 0x303, 0xc3 },
+	{ 0x41, 0x304, 0x100 },
+	{ 0x41, 0x306, 0x102 },
+	{ 0x41, 0x307, 0x226 },
+	{ 0x41, 0x308, 0xc4 },
+	{ 0x41, 0x309, 0x1ea2 },
+	{ 0x41, 0x30a, 0xc5 },
+	{ 0x41, 0x30c, 0x1cd },
+	{ 0x41, 0x30f, 0x200 },
+	{ 0x41, 0x311, 0x202 },
+	{ 0x41, 0x323, 0x1ea0 },
+	{ 0x41, 0x325, 0x1e00 },
+	{ 0x41, 0x328, 0x104 },
+	{ 0x42, 0x307, 0x1e02 },
+	{ 0x42, 0x323, 0x1e04 },
+	{ 0x42, 0x331, 0x1e06 },
+	{ 0x43, 0x301, 0x106 },
+	{ 0x43, 0x302, 0x108 },
+	{ 0x43, 0x307, 0x10a },
+	{ 0x43, 0x30c, 0x10c },
+	{ 0x43, 0x327, 0xc7 },
+	{ 0x44, 0x307, 0x1e0a },
+	{ 0x44, 0x30c, 0x10e },
+	{ 0x44, 0x323, 0x1e0c },
+	{ 0x44, 0x327, 0x1e10 },
+	{ 0x44, 0x32d, 0x1e12 },
+	{ 0x44, 0x331, 0x1e0e },
+	{ 0x45, 0x300, 0xc8 },
+	{ 0x45, 0x301, 0xc9 },
+	{ 0x45, 0x302, 0xca },
+	{ 0x45, 0x303, 0x1ebc },
+	{ 0x45, 0x304, 0x112 },
+	{ 0x45, 0x306, 0x114 },
+	{ 0x45, 0x307, 0x116 },
+	{ 0x45, 0x308, 0xcb },
+	{ 0x45, 0x309, 0x1eba },
+	{ 0x45, 0x30c, 0x11a },
+	{ 0x45, 0x30f, 0x204 },
+	{ 0x45, 0x311, 0x206 },
+	{ 0x45, 0x323, 0x1eb8 },
+	{ 0x45, 0x327, 0x228 },
+	{ 0x45, 0x328, 0x118 },
+	{ 0x45, 0x32d, 0x1e18 },
+	{ 0x45, 0x330, 0x1e1a },
+	{ 0x46, 0x307, 0x1e1e },
+	{ 0x47, 0x301, 0x1f4 },
+	{ 0x47, 0x302, 0x11c },
+	{ 0x47, 0x304, 0x1e20 },
+	{ 0x47, 0x306, 0x11e },
+	{ 0x47, 0x307, 0x120 },
+	{ 0x47, 0x30c, 0x1e6 },
+	{ 0x47, 0x327, 0x122 },
+	{ 0x48, 0x302, 0x124 },
+	{ 0x48, 0x307, 0x1e22 },
+	{ 0x48, 0x308, 0x1e26 },
+	{ 0x48, 0x30c, 0x21e },
+	{ 0x48, 0x323, 0x1e24 },
+	{ 0x48, 0x327, 0x1e28 },
+	{ 0x48, 0x32e, 0x1e2a },
+	{ 0x49, 0x300, 0xcc },
+	{ 0x49, 0x301, 0xcd },
+	{ 0x49, 0x302, 0xce },
+	{ 0x49, 0x303, 0x128 },
+	{ 0x49, 0x304, 0x12a },
+	{ 0x49, 0x306, 0x12c },
+	{ 0x49, 0x307, 0x130 },
+	{ 0x49, 0x308, 0xcf },
+	{ 0x49, 0x309, 0x1ec8 },
+	{ 0x49, 0x30c, 0x1cf },
+	{ 0x49, 0x30f, 0x208 },
+	{ 0x49, 0x311, 0x20a },
+	{ 0x49, 0x323, 0x1eca },
+	{ 0x49, 0x328, 0x12e },
+	{ 0x49, 0x330, 0x1e2c },
+	{ 0x4a, 0x302, 0x134 },
+	{ 0x4b, 0x301, 0x1e30 },
+	{ 0x4b, 0x30c, 0x1e8 },
+	{ 0x4b, 0x323, 0x1e32 },
+	{ 0x4b, 0x327, 0x136 },
+	{ 0x4b, 0x331, 0x1e34 },
+	{ 0x4c, 0x301, 0x139 },
+	{ 0x4c, 0x30c, 0x13d },
+	{ 0x4c, 0x323, 0x1e36 },
+	{ 0x4c, 0x327, 0x13b },
+	{ 0x4c, 0x32d, 0x1e3c },
+	{ 0x4c, 0x331, 0x1e3a },
+	{ 0x4d, 0x301, 0x1e3e },
+	{ 0x4d, 0x307, 0x1e40 },
+	{ 0x4d, 0x323, 0x1e42 },
+	{ 0x4e, 0x300, 0x1f8 },
+	{ 0x4e, 0x301, 0x143 },
+	{ 0x4e, 0x303, 0xd1 },
+	{ 0x4e, 0x307, 0x1e44 },
+	{ 0x4e, 0x30c, 0x147 },
+	{ 0x4e, 0x323, 0x1e46 },
+	{ 0x4e, 0x327, 0x145 },
+	{ 0x4e, 0x32d, 0x1e4a },
+	{ 0x4e, 0x331, 0x1e48 },
+	{ 0x4f, 0x300, 0xd2 },
+	{ 0x4f, 0x301, 0xd3 },
+	{ 0x4f, 0x302, 0xd4 },
+	{ 0x4f, 0x303, 0xd5 },
+	{ 0x4f, 0x304, 0x14c },
+	{ 0x4f, 0x306, 0x14e },
+	{ 0x4f, 0x307, 0x22e },
+	{ 0x4f, 0x308, 0xd6 },
+	{ 0x4f, 0x309, 0x1ece },
+	{ 0x4f, 0x30b, 0x150 },
+	{ 0x4f, 0x30c, 0x1d1 },
+	{ 0x4f, 0x30f, 0x20c },
+	{ 0x4f, 0x311, 0x20e },
+	{ 0x4f, 0x31b, 0x1a0 },
+	{ 0x4f, 0x323, 0x1ecc },
+	{ 0x4f, 0x328, 0x1ea },
+	{ 0x50, 0x301, 0x1e54 },
+	{ 0x50, 0x307, 0x1e56 },
+	{ 0x52, 0x301, 0x154 },
+	{ 0x52, 0x307, 0x1e58 },
+	{ 0x52, 0x30c, 0x158 },
+	{ 0x52, 0x30f, 0x210 },
+	{ 0x52, 0x311, 0x212 },
+	{ 0x52, 0x323, 0x1e5a },
+	{ 0x52, 0x327, 0x156 },
+	{ 0x52, 0x331, 0x1e5e },
+	{ 0x53, 0x301, 0x15a },
+	{ 0x53, 0x302, 0x15c },
+	{ 0x53, 0x307, 0x1e60 },
+	{ 0x53, 0x30c, 0x160 },
+	{ 0x53, 0x323, 0x1e62 },
+	{ 0x53, 0x326, 0x218 },
+	{ 0x53, 0x327, 0x15e },
+	{ 0x54, 0x307, 0x1e6a },
+	{ 0x54, 0x30c, 0x164 },
+	{ 0x54, 0x323, 0x1e6c },
+	{ 0x54, 0x326, 0x21a },
+	{ 0x54, 0x327, 0x162 },
+	{ 0x54, 0x32d, 0x1e70 },
+	{ 0x54, 0x331, 0x1e6e },
+	{ 0x55, 0x300, 0xd9 },
+	{ 0x55, 0x301, 0xda },
+	{ 0x55, 0x302, 0xdb },
+	{ 0x55, 0x303, 0x168 },
+	{ 0x55, 0x304, 0x16a },
+	{ 0x55, 0x306, 0x16c },
+	{ 0x55, 0x308, 0xdc },
+	{ 0x55, 0x309, 0x1ee6 },
+	{ 0x55, 0x30a, 0x16e },
+	{ 0x55, 0x30b, 0x170 },
+	{ 0x55, 0x30c, 0x1d3 },
+	{ 0x55, 0x30f, 0x214 },
+	{ 0x55, 0x311, 0x216 },
+	{ 0x55, 0x31b, 0x1af },
+	{ 0x55, 0x323, 0x1ee4 },
+	{ 0x55, 0x324, 0x1e72 },
+	{ 0x55, 0x328, 0x172 },
+	{ 0x55, 0x32d, 0x1e76 },
+	{ 0x55, 0x330, 0x1e74 },
+	{ 0x56, 0x303, 0x1e7c },
+	{ 0x56, 0x323, 0x1e7e },
+	{ 0x57, 0x300, 0x1e80 },
+	{ 0x57, 0x301, 0x1e82 },
+	{ 0x57, 0x302, 0x174 },
+	{ 0x57, 0x307, 0x1e86 },
+	{ 0x57, 0x308, 0x1e84 },
+	{ 0x57, 0x323, 0x1e88 },
+	{ 0x58, 0x307, 0x1e8a },
+	{ 0x58, 0x308, 0x1e8c },
+	{ 0x59, 0x300, 0x1ef2 },
+	{ 0x59, 0x301, 0xdd },
+	{ 0x59, 0x302, 0x176 },
+	{ 0x59, 0x303, 0x1ef8 },
+	{ 0x59, 0x304, 0x232 },
+	{ 0x59, 0x307, 0x1e8e },
+	{ 0x59, 0x308, 0x178 },
+	{ 0x59, 0x309, 0x1ef6 },
+	{ 0x59, 0x323, 0x1ef4 },
+	{ 0x5a, 0x301, 0x179 },
+	{ 0x5a, 0x302, 0x1e90 },
+	{ 0x5a, 0x307, 0x17b },
+	{ 0x5a, 0x30c, 0x17d },
+	{ 0x5a, 0x323, 0x1e92 },
+	{ 0x5a, 0x331, 0x1e94 },
+	{ 0x61, 0x300, 0xe0 },
+	{ 0x61, 0x301, 0xe1 },
+	{ 0x61, 0x302, 0xe2 },
+	{ 0x61, 0x303, 0xe3 },
+	{ 0x61, 0x304, 0x101 },
+	{ 0x61, 0x306, 0x103 },
+	{ 0x61, 0x307, 0x227 },
+	{ 0x61, 0x308, 0xe4 },
+	{ 0x61, 0x309, 0x1ea3 },
+	{ 0x61, 0x30a, 0xe5 },
+	{ 0x61, 0x30c, 0x1ce },
+	{ 0x61, 0x30f, 0x201 },
+	{ 0x61, 0x311, 0x203 },
+	{ 0x61, 0x323, 0x1ea1 },
+	{ 0x61, 0x325, 0x1e01 },
+	{ 0x61, 0x328, 0x105 },
+	{ 0x62, 0x307, 0x1e03 },
+	{ 0x62, 0x323, 0x1e05 },
+	{ 0x62, 0x331, 0x1e07 },
+	{ 0x63, 0x301, 0x107 },
+	{ 0x63, 0x302, 0x109 },
+	{ 0x63, 0x307, 0x10b },
+	{ 0x63, 0x30c, 0x10d },
+	{ 0x63, 0x327, 0xe7 },
+	{ 0x64, 0x307, 0x1e0b },
+	{ 0x64, 0x30c, 0x10f },
+	{ 0x64, 0x323, 0x1e0d },
+	{ 0x64, 0x327, 0x1e11 },
+	{ 0x64, 0x32d, 0x1e13 },
+	{ 0x64, 0x331, 0x1e0f },
+	{ 0x65, 0x300, 0xe8 },
+	{ 0x65, 0x301, 0xe9 },
+	{ 0x65, 0x302, 0xea },
+	{ 0x65, 0x303, 0x1ebd },
+	{ 0x65, 0x304, 0x113 },
+	{ 0x65, 0x306, 0x115 },
+	{ 0x65, 0x307, 0x117 },
+	{ 0x65, 0x308, 0xeb },
+	{ 0x65, 0x309, 0x1ebb },
+	{ 0x65, 0x30c, 0x11b },
+	{ 0x65, 0x30f, 0x205 },
+	{ 0x65, 0x311, 0x207 },
+	{ 0x65, 0x323, 0x1eb9 },
+	{ 0x65, 0x327, 0x229 },
+	{ 0x65, 0x328, 0x119 },
+	{ 0x65, 0x32d, 0x1e19 },
+	{ 0x65, 0x330, 0x1e1b },
+	{ 0x66, 0x307, 0x1e1f },
+	{ 0x67, 0x301, 0x1f5 },
+	{ 0x67, 0x302, 0x11d },
+	{ 0x67, 0x304, 0x1e21 },
+	{ 0x67, 0x306, 0x11f },
+	{ 0x67, 0x307, 0x121 },
+	{ 0x67, 0x30c, 0x1e7 },
+	{ 0x67, 0x327, 0x123 },
+	{ 0x68, 0x302, 0x125 },
+	{ 0x68, 0x307, 0x1e23 },
+	{ 0x68, 0x308, 0x1e27 },
+	{ 0x68, 0x30c, 0x21f },
+	{ 0x68, 0x323, 0x1e25 },
+	{ 0x68, 0x327, 0x1e29 },
+	{ 0x68, 0x32e, 0x1e2b },
+	{ 0x68, 0x331, 0x1e96 },
+	{ 0x69, 0x300, 0xec },
+	{ 0x69, 0x301, 0xed },
+	{ 0x69, 0x302, 0xee },
+	{ 0x69, 0x303, 0x129 },
+	{ 0x69, 0x304, 0x12b },
+	{ 0x69, 0x306, 0x12d },
+	{ 0x69, 0x308, 0xef },
+	{ 0x69, 0x309, 0x1ec9 },
+	{ 0x69, 0x30c, 0x1d0 },
+	{ 0x69, 0x30f, 0x209 },
+	{ 0x69, 0x311, 0x20b },
+	{ 0x69, 0x323, 0x1ecb },
+	{ 0x69, 0x328, 0x12f },
+	{ 0x69, 0x330, 0x1e2d },
+	{ 0x6a, 0x302, 0x135 },
+	{ 0x6a, 0x30c, 0x1f0 },
+	{ 0x6b, 0x301, 0x1e31 },
+	{ 0x6b, 0x30c, 0x1e9 },
+	{ 0x6b, 0x323, 0x1e33 },
+	{ 0x6b, 0x327, 0x137 },
+	{ 0x6b, 0x331, 0x1e35 },
+	{ 0x6c, 0x301, 0x13a },
+	{ 0x6c, 0x30c, 0x13e },
+	{ 0x6c, 0x323, 0x1e37 },
+	{ 0x6c, 0x327, 0x13c },
+	{ 0x6c, 0x32d, 0x1e3d },
+	{ 0x6c, 0x331, 0x1e3b },
+	{ 0x6d, 0x301, 0x1e3f },
+	{ 0x6d, 0x307, 0x1e41 },
+	{ 0x6d, 0x323, 0x1e43 },
+	{ 0x6e, 0x300, 0x1f9 },
+	{ 0x6e, 0x301, 0x144 },
+	{ 0x6e, 0x303, 0xf1 },
+	{ 0x6e, 0x307, 0x1e45 },
+	{ 0x6e, 0x30c, 0x148 },
+	{ 0x6e, 0x323, 0x1e47 },
+	{ 0x6e, 0x327, 0x146 },
+	{ 0x6e, 0x32d, 0x1e4b },
+	{ 0x6e, 0x331, 0x1e49 },
+	{ 0x6f, 0x300, 0xf2 },
+	{ 0x6f, 0x301, 0xf3 },
+	{ 0x6f, 0x302, 0xf4 },
+	{ 0x6f, 0x303, 0xf5 },
+	{ 0x6f, 0x304, 0x14d },
+	{ 0x6f, 0x306, 0x14f },
+	{ 0x6f, 0x307, 0x22f },
+	{ 0x6f, 0x308, 0xf6 },
+	{ 0x6f, 0x309, 0x1ecf },
+	{ 0x6f, 0x30b, 0x151 },
+	{ 0x6f, 0x30c, 0x1d2 },
+	{ 0x6f, 0x30f, 0x20d },
+	{ 0x6f, 0x311, 0x20f },
+	{ 0x6f, 0x31b, 0x1a1 },
+	{ 0x6f, 0x323, 0x1ecd },
+	{ 0x6f, 0x328, 0x1eb },
+	{ 0x70, 0x301, 0x1e55 },
+	{ 0x70, 0x307, 0x1e57 },
+	{ 0x72, 0x301, 0x155 },
+	{ 0x72, 0x307, 0x1e59 },
+	{ 0x72, 0x30c, 0x159 },
+	{ 0x72, 0x30f, 0x211 },
+	{ 0x72, 0x311, 0x213 },
+	{ 0x72, 0x323, 0x1e5b },
+	{ 0x72, 0x327, 0x157 },
+	{ 0x72, 0x331, 0x1e5f },
+	{ 0x73, 0x301, 0x15b },
+	{ 0x73, 0x302, 0x15d },
+	{ 0x73, 0x307, 0x1e61 },
+	{ 0x73, 0x30c, 0x161 },
+	{ 0x73, 0x323, 0x1e63 },
+	{ 0x73, 0x326, 0x219 },
+	{ 0x73, 0x327, 0x15f },
+	{ 0x74, 0x307, 0x1e6b },
+	{ 0x74, 0x308, 0x1e97 },
+	{ 0x74, 0x30c, 0x165 },
+	{ 0x74, 0x323, 0x1e6d },
+	{ 0x74, 0x326, 0x21b },
+	{ 0x74, 0x327, 0x163 },
+	{ 0x74, 0x32d, 0x1e71 },
+	{ 0x74, 0x331, 0x1e6f },
+	{ 0x75, 0x300, 0xf9 },
+	{ 0x75, 0x301, 0xfa },
+	{ 0x75, 0x302, 0xfb },
+	{ 0x75, 0x303, 0x169 },
+	{ 0x75, 0x304, 0x16b },
+	{ 0x75, 0x306, 0x16d },
+	{ 0x75, 0x308, 0xfc },
+	{ 0x75, 0x309, 0x1ee7 },
+	{ 0x75, 0x30a, 0x16f },
+	{ 0x75, 0x30b, 0x171 },
+	{ 0x75, 0x30c, 0x1d4 },
+	{ 0x75, 0x30f, 0x215 },
+	{ 0x75, 0x311, 0x217 },
+	{ 0x75, 0x31b, 0x1b0 },
+	{ 0x75, 0x323, 0x1ee5 },
+	{ 0x75, 0x324, 0x1e73 },
+	{ 0x75, 0x328, 0x173 },
+	{ 0x75, 0x32d, 0x1e77 },
+	{ 0x75, 0x330, 0x1e75 },
+	{ 0x76, 0x303, 0x1e7d },
+	{ 0x76, 0x323, 0x1e7f },
+	{ 0x77, 0x300, 0x1e81 },
+	{ 0x77, 0x301, 0x1e83 },
+	{ 0x77, 0x302, 0x175 },
+	{ 0x77, 0x307, 0x1e87 },
+	{ 0x77, 0x308, 0x1e85 },
+	{ 0x77, 0x30a, 0x1e98 },
+	{ 0x77, 0x323, 0x1e89 },
+	{ 0x78, 0x307, 0x1e8b },
+	{ 0x78, 0x308, 0x1e8d },
+	{ 0x79, 0x300, 0x1ef3 },
+	{ 0x79, 0x301, 0xfd },
+	{ 0x79, 0x302, 0x177 },
+	{ 0x79, 0x303, 0x1ef9 },
+	{ 0x79, 0x304, 0x233 },
+	{ 0x79, 0x307, 0x1e8f },
+	{ 0x79, 0x308, 0xff },
+	{ 0x79, 0x309, 0x1ef7 },
+	{ 0x79, 0x30a, 0x1e99 },
+	{ 0x79, 0x323, 0x1ef5 },
+	{ 0x7a, 0x301, 0x17a },
+	{ 0x7a, 0x302, 0x1e91 },
+	{ 0x7a, 0x307, 0x17c },
+	{ 0x7a, 0x30c, 0x17e },
+	{ 0x7a, 0x323, 0x1e93 },
+	{ 0x7a, 0x331, 0x1e95 },
+	{ 0xa8, 0x300, 0x1fed },
+	{ 0xa8, 0x301, 0x385 },
+	{ 0xa8, 0x342, 0x1fc1 },
+	{ 0xc2, 0x300, 0x1ea6 },
+	{ 0xc2, 0x301, 0x1ea4 },
+	{ 0xc2, 0x303, 0x1eaa },
+	{ 0xc2, 0x309, 0x1ea8 },
+	{ 0xc4, 0x304, 0x1de },
+	{ 0xc5, 0x301, 0x1fa },
+	{ 0xc6, 0x301, 0x1fc },
+	{ 0xc6, 0x304, 0x1e2 },
+	{ 0xc7, 0x301, 0x1e08 },
+	{ 0xca, 0x300, 0x1ec0 },
+	{ 0xca, 0x301, 0x1ebe },
+	{ 0xca, 0x303, 0x1ec4 },
+	{ 0xca, 0x309, 0x1ec2 },
+	{ 0xcf, 0x301, 0x1e2e },
+	{ 0xd4, 0x300, 0x1ed2 },
+	{ 0xd4, 0x301, 0x1ed0 },
+	{ 0xd4, 0x303, 0x1ed6 },
+	{ 0xd4, 0x309, 0x1ed4 },
+	{ 0xd5, 0x301, 0x1e4c },
+	{ 0xd5, 0x304, 0x22c },
+	{ 0xd5, 0x308, 0x1e4e },
+	{ 0xd6, 0x304, 0x22a },
+	{ 0xd8, 0x301, 0x1fe },
+	{ 0xdc, 0x300, 0x1db },
+	{ 0xdc, 0x301, 0x1d7 },
+	{ 0xdc, 0x304, 0x1d5 },
+	{ 0xdc, 0x30c, 0x1d9 },
+	{ 0xe2, 0x300, 0x1ea7 },
+	{ 0xe2, 0x301, 0x1ea5 },
+	{ 0xe2, 0x303, 0x1eab },
+	{ 0xe2, 0x309, 0x1ea9 },
+	{ 0xe4, 0x304, 0x1df },
+	{ 0xe5, 0x301, 0x1fb },
+	{ 0xe6, 0x301, 0x1fd },
+	{ 0xe6, 0x304, 0x1e3 },
+	{ 0xe7, 0x301, 0x1e09 },
+	{ 0xea, 0x300, 0x1ec1 },
+	{ 0xea, 0x301, 0x1ebf },
+	{ 0xea, 0x303, 0x1ec5 },
+	{ 0xea, 0x309, 0x1ec3 },
+	{ 0xef, 0x301, 0x1e2f },
+	{ 0xf4, 0x300, 0x1ed3 },
+	{ 0xf4, 0x301, 0x1ed1 },
+	{ 0xf4, 0x303, 0x1ed7 },
+	{ 0xf4, 0x309, 0x1ed5 },
+	{ 0xf5, 0x301, 0x1e4d },
+	{ 0xf5, 0x304, 0x22d },
+	{ 0xf5, 0x308, 0x1e4f },
+	{ 0xf6, 0x304, 0x22b },
+	{ 0xf8, 0x301, 0x1ff },
+	{ 0xfc, 0x300, 0x1dc },
+	{ 0xfc, 0x301, 0x1d8 },
+	{ 0xfc, 0x304, 0x1d6 },
+	{ 0xfc, 0x30c, 0x1da },
+	{ 0x102, 0x300, 0x1eb0 },
+	{ 0x102, 0x301, 0x1eae },
+	{ 0x102, 0x303, 0x1eb4 },
+	{ 0x102, 0x309, 0x1eb2 },
+	{ 0x103, 0x300, 0x1eb1 },
+	{ 0x103, 0x301, 0x1eaf },
+	{ 0x103, 0x303, 0x1eb5 },
+	{ 0x103, 0x309, 0x1eb3 },
+	{ 0x112, 0x300, 0x1e14 },
+	{ 0x112, 0x301, 0x1e16 },
+	{ 0x113, 0x300, 0x1e15 },
+	{ 0x113, 0x301, 0x1e17 },
+	{ 0x14c, 0x300, 0x1e50 },
+	{ 0x14c, 0x301, 0x1e52 },
+	{ 0x14d, 0x300, 0x1e51 },
+	{ 0x14d, 0x301, 0x1e53 },
+	{ 0x15a, 0x307, 0x1e64 },
+	{ 0x15b, 0x307, 0x1e65 },
+	{ 0x160, 0x307, 0x1e66 },
+	{ 0x161, 0x307, 0x1e67 },
+	{ 0x168, 0x301, 0x1e78 },
+	{ 0x169, 0x301, 0x1e79 },
+	{ 0x16a, 0x308, 0x1e7a },
+	{ 0x16b, 0x308, 0x1e7b },
+	{ 0x17f, 0x307, 0x1e9b },
+	{ 0x1a0, 0x300, 0x1edc },
+	{ 0x1a0, 0x301, 0x1eda },
+	{ 0x1a0, 0x303, 0x1ee0 },
+	{ 0x1a0, 0x309, 0x1ede },
+	{ 0x1a0, 0x323, 0x1ee2 },
+	{ 0x1a1, 0x300, 0x1edd },
+	{ 0x1a1, 0x301, 0x1edb },
+	{ 0x1a1, 0x303, 0x1ee1 },
+	{ 0x1a1, 0x309, 0x1edf },
+	{ 0x1a1, 0x323, 0x1ee3 },
+	{ 0x1af, 0x300, 0x1eea },
+	{ 0x1af, 0x301, 0x1ee8 },
+	{ 0x1af, 0x303, 0x1eee },
+	{ 0x1af, 0x309, 0x1eec },
+	{ 0x1af, 0x323, 0x1ef0 },
+	{ 0x1b0, 0x300, 0x1eeb },
+	{ 0x1b0, 0x301, 0x1ee9 },
+	{ 0x1b0, 0x303, 0x1eef },
+	{ 0x1b0, 0x309, 0x1eed },
+	{ 0x1b0, 0x323, 0x1ef1 },
+	{ 0x1b7, 0x30c, 0x1ee },
+	{ 0x1ea, 0x304, 0x1ec },
+	{ 0x1eb, 0x304, 0x1ed },
+	{ 0x226, 0x304, 0x1e0 },
+	{ 0x227, 0x304, 0x1e1 },
+	{ 0x228, 0x306, 0x1e1c },
+	{ 0x229, 0x306, 0x1e1d },
+	{ 0x22e, 0x304, 0x230 },
+	{ 0x22f, 0x304, 0x231 },
+	{ 0x292, 0x30c, 0x1ef },
+	{ 0x391, 0x300, 0x1fba },
+	{ 0x391, 0x301, 0x386 },
+	{ 0x391, 0x304, 0x1fb9 },
+	{ 0x391, 0x306, 0x1fb8 },
+	{ 0x391, 0x313, 0x1f08 },
+	{ 0x391, 0x314, 0x1f09 },
+	{ 0x391, 0x345, 0x1fbc },
+	{ 0x395, 0x300, 0x1fc8 },
+	{ 0x395, 0x301, 0x388 },
+	{ 0x395, 0x313, 0x1f18 },
+	{ 0x395, 0x314, 0x1f19 },
+	{ 0x397, 0x300, 0x1fca },
+	{ 0x397, 0x301, 0x389 },
+	{ 0x397, 0x313, 0x1f28 },
+	{ 0x397, 0x314, 0x1f29 },
+	{ 0x397, 0x345, 0x1fcc },
+	{ 0x399, 0x300, 0x1fda },
+	{ 0x399, 0x301, 0x38a },
+	{ 0x399, 0x304, 0x1fd9 },
+	{ 0x399, 0x306, 0x1fd8 },
+	{ 0x399, 0x308, 0x3aa },
+	{ 0x399, 0x313, 0x1f38 },
+	{ 0x399, 0x314, 0x1f39 },
+	{ 0x39f, 0x300, 0x1ff8 },
+	{ 0x39f, 0x301, 0x38c },
+	{ 0x39f, 0x313, 0x1f48 },
+	{ 0x39f, 0x314, 0x1f49 },
+	{ 0x3a1, 0x314, 0x1fec },
+	{ 0x3a5, 0x300, 0x1fea },
+	{ 0x3a5, 0x301, 0x38e },
+	{ 0x3a5, 0x304, 0x1fe9 },
+	{ 0x3a5, 0x306, 0x1fe8 },
+	{ 0x3a5, 0x308, 0x3ab },
+	{ 0x3a5, 0x314, 0x1f59 },
+	{ 0x3a9, 0x300, 0x1ffa },
+	{ 0x3a9, 0x301, 0x38f },
+	{ 0x3a9, 0x313, 0x1f68 },
+	{ 0x3a9, 0x314, 0x1f69 },
+	{ 0x3a9, 0x345, 0x1ffc },
+	{ 0x3ac, 0x345, 0x1fb4 },
+	{ 0x3ae, 0x345, 0x1fc4 },
+	{ 0x3b1, 0x300, 0x1f70 },
+	{ 0x3b1, 0x301, 0x3ac },
+	{ 0x3b1, 0x304, 0x1fb1 },
+	{ 0x3b1, 0x306, 0x1fb0 },
+	{ 0x3b1, 0x313, 0x1f00 },
+	{ 0x3b1, 0x314, 0x1f01 },
+	{ 0x3b1, 0x342, 0x1fb6 },
+	{ 0x3b1, 0x345, 0x1fb3 },
+	{ 0x3b5, 0x300, 0x1f72 },
+	{ 0x3b5, 0x301, 0x3ad },
+	{ 0x3b5, 0x313, 0x1f10 },
+	{ 0x3b5, 0x314, 0x1f11 },
+	{ 0x3b7, 0x300, 0x1f74 },
+	{ 0x3b7, 0x301, 0x3ae },
+	{ 0x3b7, 0x313, 0x1f20 },
+	{ 0x3b7, 0x314, 0x1f21 },
+	{ 0x3b7, 0x342, 0x1fc6 },
+	{ 0x3b7, 0x345, 0x1fc3 },
+	{ 0x3b9, 0x300, 0x1f76 },
+	{ 0x3b9, 0x301, 0x3af },
+	{ 0x3b9, 0x304, 0x1fd1 },
+	{ 0x3b9, 0x306, 0x1fd0 },
+	{ 0x3b9, 0x308, 0x3ca },
+	{ 0x3b9, 0x313, 0x1f30 },
+	{ 0x3b9, 0x314, 0x1f31 },
+	{ 0x3b9, 0x342, 0x1fd6 },
+	{ 0x3bf, 0x300, 0x1f78 },
+	{ 0x3bf, 0x301, 0x3cc },
+	{ 0x3bf, 0x313, 0x1f40 },
+	{ 0x3bf, 0x314, 0x1f41 },
+	{ 0x3c1, 0x313, 0x1fe4 },
+	{ 0x3c1, 0x314, 0x1fe5 },
+	{ 0x3c5, 0x300, 0x1f7a },
+	{ 0x3c5, 0x301, 0x3cd },
+	{ 0x3c5, 0x304, 0x1fe1 },
+	{ 0x3c5, 0x306, 0x1fe0 },
+	{ 0x3c5, 0x308, 0x3cb },
+	{ 0x3c5, 0x313, 0x1f50 },
+	{ 0x3c5, 0x314, 0x1f51 },
+	{ 0x3c5, 0x342, 0x1fe6 },
+	{ 0x3c9, 0x300, 0x1f7c },
+	{ 0x3c9, 0x301, 0x3ce },
+	{ 0x3c9, 0x313, 0x1f60 },
+	{ 0x3c9, 0x314, 0x1f61 },
+	{ 0x3c9, 0x342, 0x1ff6 },
+	{ 0x3c9, 0x345, 0x1ff3 },
+	{ 0x3ca, 0x300, 0x1fd2 },
+	{ 0x3ca, 0x301, 0x390 },
+	{ 0x3ca, 0x342, 0x1fd7 },
+	{ 0x3cb, 0x300, 0x1fe2 },
+	{ 0x3cb, 0x301, 0x3b0 },
+	{ 0x3cb, 0x342, 0x1fe7 },
+	{ 0x3ce, 0x345, 0x1ff4 },
+	{ 0x3d2, 0x301, 0x3d3 },
+	{ 0x3d2, 0x308, 0x3d4 },
+	{ 0x406, 0x308, 0x407 },
+	{ 0x410, 0x306, 0x4d0 },
+	{ 0x410, 0x308, 0x4d2 },
+	{ 0x413, 0x301, 0x403 },
+	{ 0x415, 0x300, 0x400 },
+	{ 0x415, 0x306, 0x4d6 },
+	{ 0x415, 0x308, 0x401 },
+	{ 0x416, 0x306, 0x4c1 },
+	{ 0x416, 0x308, 0x4dc },
+	{ 0x417, 0x308, 0x4de },
+	{ 0x418, 0x300, 0x40d },
+	{ 0x418, 0x304, 0x4e2 },
+	{ 0x418, 0x306, 0x419 },
+	{ 0x418, 0x308, 0x4e4 },
+	{ 0x41a, 0x301, 0x40c },
+	{ 0x41e, 0x308, 0x4e6 },
+	{ 0x423, 0x304, 0x4ee },
+	{ 0x423, 0x306, 0x40e },
+	{ 0x423, 0x308, 0x4f0 },
+	{ 0x423, 0x30b, 0x4f2 },
+	{ 0x427, 0x308, 0x4f4 },
+	{ 0x42b, 0x308, 0x4f8 },
+	{ 0x42d, 0x308, 0x4ec },
+	{ 0x430, 0x306, 0x4d1 },
+	{ 0x430, 0x308, 0x4d3 },
+	{ 0x433, 0x301, 0x453 },
+	{ 0x435, 0x300, 0x450 },
+	{ 0x435, 0x306, 0x4d7 },
+	{ 0x435, 0x308, 0x451 },
+	{ 0x436, 0x306, 0x4c2 },
+	{ 0x436, 0x308, 0x4dd },
+	{ 0x437, 0x308, 0x4df },
+	{ 0x438, 0x300, 0x45d },
+	{ 0x438, 0x304, 0x4e3 },
+	{ 0x438, 0x306, 0x439 },
+	{ 0x438, 0x308, 0x4e5 },
+	{ 0x43a, 0x301, 0x45c },
+	{ 0x43e, 0x308, 0x4e7 },
+	{ 0x443, 0x304, 0x4ef },
+	{ 0x443, 0x306, 0x45e },
+	{ 0x443, 0x308, 0x4f1 },
+	{ 0x443, 0x30b, 0x4f3 },
+	{ 0x447, 0x308, 0x4f5 },
+	{ 0x44b, 0x308, 0x4f9 },
+	{ 0x44d, 0x308, 0x4ed },
+	{ 0x456, 0x308, 0x457 },
+	{ 0x474, 0x30f, 0x476 },
+	{ 0x475, 0x30f, 0x477 },
+	{ 0x4d8, 0x308, 0x4da },
+	{ 0x4d9, 0x308, 0x4db },
+	{ 0x4e8, 0x308, 0x4ea },
+	{ 0x4e9, 0x308, 0x4eb },
+	{ 0x627, 0x653, 0x622 },
+	{ 0x627, 0x654, 0x623 },
+	{ 0x627, 0x655, 0x625 },
+	{ 0x648, 0x654, 0x624 },
+	{ 0x64a, 0x654, 0x626 },
+	{ 0x6c1, 0x654, 0x6c2 },
+	{ 0x6d2, 0x654, 0x6d3 },
+	{ 0x6d5, 0x654, 0x6c0 },
+	{ 0x928, 0x93c, 0x929 },
+	{ 0x930, 0x93c, 0x931 },
+	{ 0x933, 0x93c, 0x934 },
+	{ 0x9c7, 0x9be, 0x9cb },
+	{ 0x9c7, 0x9d7, 0x9cc },
+	{ 0xb47, 0xb3e, 0xb4b },
+	{ 0xb47, 0xb56, 0xb48 },
+	{ 0xb47, 0xb57, 0xb4c },
+	{ 0xb92, 0xbd7, 0xb94 },
+	{ 0xbc6, 0xbbe, 0xbca },
+	{ 0xbc6, 0xbd7, 0xbcc },
+	{ 0xbc7, 0xbbe, 0xbcb },
+	{ 0xc46, 0xc56, 0xc48 },
+	{ 0xcbf, 0xcd5, 0xcc0 },
+	{ 0xcc6, 0xcc2, 0xcca },
+	{ 0xcc6, 0xcd5, 0xcc7 },
+	{ 0xcc6, 0xcd6, 0xcc8 },
+	{ 0xcca, 0xcd5, 0xccb },
+	{ 0xd46, 0xd3e, 0xd4a },
+	{ 0xd46, 0xd57, 0xd4c },
+	{ 0xd47, 0xd3e, 0xd4b },
+	{ 0xdd9, 0xdca, 0xdda },
+	{ 0xdd9, 0xdcf, 0xddc },
+	{ 0xdd9, 0xddf, 0xdde },
+	{ 0xddc, 0xdca, 0xddd },
+	{ 0x1025, 0x102e, 0x1026 },
+	{ 0x1b05, 0x1b35, 0x1b06 },
+	{ 0x1b07, 0x1b35, 0x1b08 },
+	{ 0x1b09, 0x1b35, 0x1b0a },
+	{ 0x1b0b, 0x1b35, 0x1b0c },
+	{ 0x1b0d, 0x1b35, 0x1b0e },
+	{ 0x1b11, 0x1b35, 0x1b12 },
+	{ 0x1b3a, 0x1b35, 0x1b3b },
+	{ 0x1b3c, 0x1b35, 0x1b3d },
+	{ 0x1b3e, 0x1b35, 0x1b40 },
+	{ 0x1b3f, 0x1b35, 0x1b41 },
+	{ 0x1b42, 0x1b35, 0x1b43 },
+	{ 0x1e36, 0x304, 0x1e38 },
+	{ 0x1e37, 0x304, 0x1e39 },
+	{ 0x1e5a, 0x304, 0x1e5c },
+	{ 0x1e5b, 0x304, 0x1e5d },
+	{ 0x1e62, 0x307, 0x1e68 },
+	{ 0x1e63, 0x307, 0x1e69 },
+	{ 0x1ea0, 0x302, 0x1eac },
+	{ 0x1ea0, 0x306, 0x1eb6 },
+	{ 0x1ea1, 0x302, 0x1ead },
+	{ 0x1ea1, 0x306, 0x1eb7 },
+	{ 0x1eb8, 0x302, 0x1ec6 },
+	{ 0x1eb9, 0x302, 0x1ec7 },
+	{ 0x1ecc, 0x302, 0x1ed8 },
+	{ 0x1ecd, 0x302, 0x1ed9 },
+	{ 0x1f00, 0x300, 0x1f02 },
+	{ 0x1f00, 0x301, 0x1f04 },
+	{ 0x1f00, 0x342, 0x1f06 },
+	{ 0x1f00, 0x345, 0x1f80 },
+	{ 0x1f01, 0x300, 0x1f03 },
+	{ 0x1f01, 0x301, 0x1f05 },
+	{ 0x1f01, 0x342, 0x1f07 },
+	{ 0x1f01, 0x345, 0x1f81 },
+	{ 0x1f02, 0x345, 0x1f82 },
+	{ 0x1f03, 0x345, 0x1f83 },
+	{ 0x1f04, 0x345, 0x1f84 },
+	{ 0x1f05, 0x345, 0x1f85 },
+	{ 0x1f06, 0x345, 0x1f86 },
+	{ 0x1f07, 0x345, 0x1f87 },
+	{ 0x1f08, 0x300, 0x1f0a },
+	{ 0x1f08, 0x301, 0x1f0c },
+	{ 0x1f08, 0x342, 0x1f0e },
+	{ 0x1f08, 0x345, 0x1f88 },
+	{ 0x1f09, 0x300, 0x1f0b },
+	{ 0x1f09, 0x301, 0x1f0d },
+	{ 0x1f09, 0x342, 0x1f0f },
+	{ 0x1f09, 0x345, 0x1f89 },
+	{ 0x1f0a, 0x345, 0x1f8a },
+	{ 0x1f0b, 0x345, 0x1f8b },
+	{ 0x1f0c, 0x345, 0x1f8c },
+	{ 0x1f0d, 0x345, 0x1f8d },
+	{ 0x1f0e, 0x345, 0x1f8e },
+	{ 0x1f0f, 0x345, 0x1f8f },
+	{ 0x1f10, 0x300, 0x1f12 },
+	{ 0x1f10, 0x301, 0x1f14 },
+	{ 0x1f11, 0x300, 0x1f13 },
+	{ 0x1f11, 0x301, 0x1f15 },
+	{ 0x1f18, 0x300, 0x1f1a },
+	{ 0x1f18, 0x301, 0x1f1c },
+	{ 0x1f19, 0x300, 0x1f1b },
+	{ 0x1f19, 0x301, 0x1f1d },
+	{ 0x1f20, 0x300, 0x1f22 },
+	{ 0x1f20, 0x301, 0x1f24 },
+	{ 0x1f20, 0x342, 0x1f26 },
+	{ 0x1f20, 0x345, 0x1f90 },
+	{ 0x1f21, 0x300, 0x1f23 },
+	{ 0x1f21, 0x301, 0x1f25 },
+	{ 0x1f21, 0x342, 0x1f27 },
+	{ 0x1f21, 0x345, 0x1f91 },
+	{ 0x1f22, 0x345, 0x1f92 },
+	{ 0x1f23, 0x345, 0x1f93 },
+	{ 0x1f24, 0x345, 0x1f94 },
+	{ 0x1f25, 0x345, 0x1f95 },
+	{ 0x1f26, 0x345, 0x1f96 },
+	{ 0x1f27, 0x345, 0x1f97 },
+	{ 0x1f28, 0x300, 0x1f2a },
+	{ 0x1f28, 0x301, 0x1f2c },
+	{ 0x1f28, 0x342, 0x1f2e },
+	{ 0x1f28, 0x345, 0x1f98 },
+	{ 0x1f29, 0x300, 0x1f2b },
+	{ 0x1f29, 0x301, 0x1f2d },
+	{ 0x1f29, 0x342, 0x1f2f },
+	{ 0x1f29, 0x345, 0x1f99 },
+	{ 0x1f2a, 0x345, 0x1f9a },
+	{ 0x1f2b, 0x345, 0x1f9b },
+	{ 0x1f2c, 0x345, 0x1f9c },
+	{ 0x1f2d, 0x345, 0x1f9d },
+	{ 0x1f2e, 0x345, 0x1f9e },
+	{ 0x1f2f, 0x345, 0x1f9f },
+	{ 0x1f30, 0x300, 0x1f32 },
+	{ 0x1f30, 0x301, 0x1f34 },
+	{ 0x1f30, 0x342, 0x1f36 },
+	{ 0x1f31, 0x300, 0x1f33 },
+	{ 0x1f31, 0x301, 0x1f35 },
+	{ 0x1f31, 0x342, 0x1f37 },
+	{ 0x1f38, 0x300, 0x1f3a },
+	{ 0x1f38, 0x301, 0x1f3c },
+	{ 0x1f38, 0x342, 0x1f3e },
+	{ 0x1f39, 0x300, 0x1f3b },
+	{ 0x1f39, 0x301, 0x1f3d },
+	{ 0x1f39, 0x342, 0x1f3f },
+	{ 0x1f40, 0x300, 0x1f42 },
+	{ 0x1f40, 0x301, 0x1f44 },
+	{ 0x1f41, 0x300, 0x1f43 },
+	{ 0x1f41, 0x301, 0x1f45 },
+	{ 0x1f48, 0x300, 0x1f4a },
+	{ 0x1f48, 0x301, 0x1f4c },
+	{ 0x1f49, 0x300, 0x1f4b },
+	{ 0x1f49, 0x301, 0x1f4d },
+	{ 0x1f50, 0x300, 0x1f52 },
+	{ 0x1f50, 0x301, 0x1f54 },
+	{ 0x1f50, 0x342, 0x1f56 },
+	{ 0x1f51, 0x300, 0x1f53 },
+	{ 0x1f51, 0x301, 0x1f55 },
+	{ 0x1f51, 0x342, 0x1f57 },
+	{ 0x1f59, 0x300, 0x1f5b },
+	{ 0x1f59, 0x301, 0x1f5d },
+	{ 0x1f59, 0x342, 0x1f5f },
+	{ 0x1f60, 0x300, 0x1f62 },
+	{ 0x1f60, 0x301, 0x1f64 },
+	{ 0x1f60, 0x342, 0x1f66 },
+	{ 0x1f60, 0x345, 0x1fa0 },
+	{ 0x1f61, 0x300, 0x1f63 },
+	{ 0x1f61, 0x301, 0x1f65 },
+	{ 0x1f61, 0x342, 0x1f67 },
+	{ 0x1f61, 0x345, 0x1fa1 },
+	{ 0x1f62, 0x345, 0x1fa2 },
+	{ 0x1f63, 0x345, 0x1fa3 },
+	{ 0x1f64, 0x345, 0x1fa4 },
+	{ 0x1f65, 0x345, 0x1fa5 },
+	{ 0x1f66, 0x345, 0x1fa6 },
+	{ 0x1f67, 0x345, 0x1fa7 },
+	{ 0x1f68, 0x300, 0x1f6a },
+	{ 0x1f68, 0x301, 0x1f6c },
+	{ 0x1f68, 0x342, 0x1f6e },
+	{ 0x1f68, 0x345, 0x1fa8 },
+	{ 0x1f69, 0x300, 0x1f6b },
+	{ 0x1f69, 0x301, 0x1f6d },
+	{ 0x1f69, 0x342, 0x1f6f },
+	{ 0x1f69, 0x345, 0x1fa9 },
+	{ 0x1f6a, 0x345, 0x1faa },
+	{ 0x1f6b, 0x345, 0x1fab },
+	{ 0x1f6c, 0x345, 0x1fac },
+	{ 0x1f6d, 0x345, 0x1fad },
+	{ 0x1f6e, 0x345, 0x1fae },
+	{ 0x1f6f, 0x345, 0x1faf },
+	{ 0x1f70, 0x345, 0x1fb2 },
+	{ 0x1f74, 0x345, 0x1fc2 },
+	{ 0x1f7c, 0x345, 0x1ff2 },
+	{ 0x1fb6, 0x345, 0x1fb7 },
+	{ 0x1fbf, 0x300, 0x1fcd },
+	{ 0x1fbf, 0x301, 0x1fce },
+	{ 0x1fbf, 0x342, 0x1fcf },
+	{ 0x1fc6, 0x345, 0x1fc7 },
+	{ 0x1ff6, 0x345, 0x1ff7 },
+	{ 0x1ffe, 0x300, 0x1fdd },
+	{ 0x1ffe, 0x301, 0x1fde },
+	{ 0x1ffe, 0x342, 0x1fdf },
+	{ 0x2190, 0x338, 0x219a },
+	{ 0x2192, 0x338, 0x219b },
+	{ 0x2194, 0x338, 0x21ae },
+	{ 0x21d0, 0x338, 0x21cd },
+	{ 0x21d2, 0x338, 0x21cf },
+	{ 0x21d4, 0x338, 0x21ce },
+	{ 0x2203, 0x338, 0x2204 },
+	{ 0x2208, 0x338, 0x2209 },
+	{ 0x220b, 0x338, 0x220c },
+	{ 0x2223, 0x338, 0x2224 },
+	{ 0x2225, 0x338, 0x2226 },
+	{ 0x223c, 0x338, 0x2241 },
+	{ 0x2243, 0x338, 0x2244 },
+	{ 0x2245, 0x338, 0x2247 },
+	{ 0x2248, 0x338, 0x2249 },
+	{ 0x224d, 0x338, 0x226d },
+	{ 0x2261, 0x338, 0x2262 },
+	{ 0x2264, 0x338, 0x2270 },
+	{ 0x2265, 0x338, 0x2271 },
+	{ 0x2272, 0x338, 0x2274 },
+	{ 0x2273, 0x338, 0x2275 },
+	{ 0x2276, 0x338, 0x2278 },
+	{ 0x2277, 0x338, 0x2279 },
+	{ 0x227a, 0x338, 0x2280 },
+	{ 0x227b, 0x338, 0x2281 },
+	{ 0x227c, 0x338, 0x22e0 },
+	{ 0x227d, 0x338, 0x22e1 },
+	{ 0x2282, 0x338, 0x2284 },
+	{ 0x2283, 0x338, 0x2285 },
+	{ 0x2286, 0x338, 0x2288 },
+	{ 0x2287, 0x338, 0x2289 },
+	{ 0x2291, 0x338, 0x22e2 },
+	{ 0x2292, 0x338, 0x22e3 },
+	{ 0x22a2, 0x338, 0x22ac },
+	{ 0x22a8, 0x338, 0x22ad },
+	{ 0x22a9, 0x338, 0x22ae },
+	{ 0x22ab, 0x338, 0x22af },
+	{ 0x22b2, 0x338, 0x22ea },
+	{ 0x22b3, 0x338, 0x22eb },
+	{ 0x22b4, 0x338, 0x22ec },
+	{ 0x22b5, 0x338, 0x22ed },
+	{ 0x3046, 0x3099, 0x3094 },
+	{ 0x304b, 0x3099, 0x304c },
+	{ 0x304d, 0x3099, 0x304e },
+	{ 0x304f, 0x3099, 0x3050 },
+	{ 0x3051, 0x3099, 0x3052 },
+	{ 0x3053, 0x3099, 0x3054 },
+	{ 0x3055, 0x3099, 0x3056 },
+	{ 0x3057, 0x3099, 0x3058 },
+	{ 0x3059, 0x3099, 0x305a },
+	{ 0x305b, 0x3099, 0x305c },
+	{ 0x305d, 0x3099, 0x305e },
+	{ 0x305f, 0x3099, 0x3060 },
+	{ 0x3061, 0x3099, 0x3062 },
+	{ 0x3064, 0x3099, 0x3065 },
+	{ 0x3066, 0x3099, 0x3067 },
+	{ 0x3068, 0x3099, 0x3069 },
+	{ 0x306f, 0x3099, 0x3070 },
+	{ 0x306f, 0x309a, 0x3071 },
+	{ 0x3072, 0x3099, 0x3073 },
+	{ 0x3072, 0x309a, 0x3074 },
+	{ 0x3075, 0x3099, 0x3076 },
+	{ 0x3075, 0x309a, 0x3077 },
+	{ 0x3078, 0x3099, 0x3079 },
+	{ 0x3078, 0x309a, 0x307a },
+	{ 0x307b, 0x3099, 0x307c },
+	{ 0x307b, 0x309a, 0x307d },
+	{ 0x309d, 0x3099, 0x309e },
+	{ 0x30a6, 0x3099, 0x30f4 },
+	{ 0x30ab, 0x3099, 0x30ac },
+	{ 0x30ad, 0x3099, 0x30ae },
+	{ 0x30af, 0x3099, 0x30b0 },
+	{ 0x30b1, 0x3099, 0x30b2 },
+	{ 0x30b3, 0x3099, 0x30b4 },
+	{ 0x30b5, 0x3099, 0x30b6 },
+	{ 0x30b7, 0x3099, 0x30b8 },
+	{ 0x30b9, 0x3099, 0x30ba },
+	{ 0x30bb, 0x3099, 0x30bc },
+	{ 0x30bd, 0x3099, 0x30be },
+	{ 0x30bf, 0x3099, 0x30c0 },
+	{ 0x30c1, 0x3099, 0x30c2 },
+	{ 0x30c4, 0x3099, 0x30c5 },
+	{ 0x30c6, 0x3099, 0x30c7 },
+	{ 0x30c8, 0x3099, 0x30c9 },
+	{ 0x30cf, 0x3099, 0x30d0 },
+	{ 0x30cf, 0x309a, 0x30d1 },
+	{ 0x30d2, 0x3099, 0x30d3 },
+	{ 0x30d2, 0x309a, 0x30d4 },
+	{ 0x30d5, 0x3099, 0x30d6 },
+	{ 0x30d5, 0x309a, 0x30d7 },
+	{ 0x30d8, 0x3099, 0x30d9 },
+	{ 0x30d8, 0x309a, 0x30da },
+	{ 0x30db, 0x3099, 0x30dc },
+	{ 0x30db, 0x309a, 0x30dd },
+	{ 0x30ef, 0x3099, 0x30f7 },
+	{ 0x30f0, 0x3099, 0x30f8 },
+	{ 0x30f1, 0x3099, 0x30f9 },
+	{ 0x30f2, 0x3099, 0x30fa },
+	{ 0x30fd, 0x3099, 0x30fe },
+	{ 0x11099, 0x110ba, 0x1109a },
+	{ 0x1109b, 0x110ba, 0x1109c },
+	{ 0x110a5, 0x110ba, 0x110ab },
+	{ 0x11131, 0x11127, 0x1112e },
+	{ 0x11132, 0x11127, 0x1112f },
+	{ 0x11347, 0x1133e, 0x1134b },
+	{ 0x11347, 0x11357, 0x1134c },
+	{ 0x114b9, 0x114b0, 0x114bc },
+	{ 0x114b9, 0x114ba, 0x114bb },
+	{ 0x114b9, 0x114bd, 0x114be },
+	{ 0x115b8, 0x115af, 0x115ba },
+	{ 0x115b9, 0x115af, 0x115bb },
+	{ 0x11935, 0x11930, 0x11938 },
+};
+
+#endif